@@ -35,12 +35,15 @@ list(APPEND MAIN_SOURCE_FILES
   opm/grid/cpgrid/CpGridUtilities.cpp
   opm/grid/cpgrid/DataHandleWrappers.cpp
   opm/grid/cpgrid/GridHelpers.cpp
+  opm/grid/cpgrid/GridSnapshot.cpp
+  opm/grid/cpgrid/ImplicitRefinedLevel.cpp
   opm/grid/cpgrid/Iterators.cpp
   opm/grid/cpgrid/Indexsets.cpp
   opm/grid/cpgrid/LgrHelpers.cpp
   opm/grid/cpgrid/LgrOutputHelpers.cpp
   opm/grid/cpgrid/NestedRefinementUtilities.cpp
   opm/grid/cpgrid/PartitionTypeIndicator.cpp
+  opm/grid/cpgrid/PillarSlab.cpp
   opm/grid/cpgrid/processEclipseFormat.cpp
   opm/grid/common/GeometryHelpers.cpp
   opm/grid/common/GridPartitioning.cpp
@@ -69,6 +72,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/grid/utility/compressedToCartesian.cpp
   opm/grid/utility/cartesianToCompressed.cpp
   opm/grid/utility/StopWatch.cpp
+  opm/grid/utility/PhaseStatistics.cpp
   opm/grid/utility/WachspressCoord.cpp
 )
 
@@ -94,6 +98,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_graphofgrid_parallel.cpp
   tests/test_gridutilities.cpp
   tests/test_minpvprocessor.cpp
+  tests/test_phasestatistics.cpp
   tests/test_polyhedralgrid.cpp
   tests/test_process_grdecl.cpp
   tests/test_quadratures.cpp
@@ -116,6 +121,8 @@ list(APPEND TEST_SOURCE_FILES
   tests/cpgrid/lgr/autoRefine_test.cpp
   tests/cpgrid/lgr/global_refine_test.cpp
   tests/cpgrid/lgr/id_entity_entityrep_test.cpp
+  tests/cpgrid/lgr/implicit_refined_level_test.cpp
+  tests/cpgrid/lgr/index_pair_map_test.cpp
   tests/cpgrid/lgr/level_and_grid_cartesianIndexMappers_test.cpp
   tests/cpgrid/lgr/lgrs_sharing_faces_test.cpp
   tests/cpgrid/lgr/logicalCartesianSize_and_refinement_test.cpp
@@ -170,6 +177,7 @@ list(APPEND TEST_DATA_FILES
 # find tutorials examples -name '*.c*' -printf '\t%p\n' | sort
 list(APPEND EXAMPLE_SOURCE_FILES
   examples/finitevolume/finitevolume.cc
+  examples/grid_benchmark.cpp
   examples/griditer.cpp
 )
 
@@ -196,6 +204,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/grid/common/p2pcommunicator_impl.hh
   opm/grid/common/WellConnections.hpp
   opm/grid/cpgrid/CartesianIndexMapper.hpp
+  opm/grid/cpgrid/CommunicationPlan.hpp
   opm/grid/cpgrid/CpGridData.hpp
   opm/grid/cpgrid/CpGridDataTraits.hpp
   opm/grid/cpgrid/CpGridUtilities.hpp
@@ -206,14 +215,17 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/grid/cpgrid/Entity.hpp
   opm/grid/cpgrid/EntityRep.hpp
   opm/grid/cpgrid/Geometry.hpp
+  opm/grid/cpgrid/GeometryArrays.hpp
   opm/grid/cpgrid/GlobalIdMapping.hpp
   opm/grid/cpgrid/GridHelpers.hpp
+  opm/grid/cpgrid/ImplicitRefinedLevel.hpp
   opm/grid/cpgrid/LevelCartesianIndexMapper.hpp
   opm/grid/cpgrid/NestedRefinementUtilities.hpp
   opm/grid/CpGrid.hpp
   opm/grid/cpgrid/Indexsets.hpp
   opm/grid/cpgrid/Intersection.hpp
   opm/grid/cpgrid/Iterators.hpp
+  opm/grid/cpgrid/IndexPairMap.hpp
   opm/grid/cpgrid/LgrHelpers.hpp
   opm/grid/cpgrid/LgrOutputHelpers.hpp
   opm/grid/cpgrid/ElementMarkHandle.hpp
@@ -223,7 +235,9 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/grid/cpgrid/PartitionIteratorRule.hpp
   opm/grid/cpgrid/PartitionTypeIndicator.hpp
   opm/grid/cpgrid/PersistentContainer.hpp
+  opm/grid/cpgrid/PillarSlab.hpp
   opm/grid/common/CartesianIndexMapper.hpp
+  opm/grid/common/FaceNeighbours.hpp
   opm/grid/common/GridEnums.hpp
   opm/grid/common/LevelCartesianIndexMapper.hpp
   opm/grid/common/MetisPartition.hpp
@@ -281,6 +295,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/grid/utility/RegionMapping.hpp
   opm/grid/utility/SparseTable.hpp
   opm/grid/utility/StopWatch.hpp
+  opm/grid/utility/PhaseStatistics.hpp
   opm/grid/utility/VariableSizeCommunicator.hpp
   opm/grid/utility/VelocityInterpolation.hpp
   opm/grid/utility/WachspressCoord.hpp
@@ -0,0 +1,555 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file grid_benchmark.cpp
+ * @brief Times grid construction, load balancing, refinement and iteration.
+ *
+ * Usage: grid_benchmark [-n NX NY NZ] [-r REPETITIONS] [-o FILE] [DECK.DATA ...]
+ *
+ * Runs the benchmarks on three synthetic corner-point models of the given
+ * size (faulted, pinched and one with sparse ACTNUM) and on all decks given
+ * on the command line, e.g. the .DATA files in tests. The timings (maximum
+ * over all processes) are written as JSON to FILE, or to standard output.
+ */
+
+#include <config.h>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/MinpvProcessor.hpp>
+#include <opm/grid/common/GridEnums.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/utility/PhaseStatistics.hpp>
+#include <opm/grid/utility/StopWatch.hpp>
+
+#if HAVE_OPM_COMMON
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+    std::array<int, 3> dims = {40, 40, 20};
+    int repetitions = 3;
+    std::string output;
+    std::vector<std::string> decks;
+};
+
+/// Corner-point description of a model together with the storage it refers to.
+struct Model
+{
+    std::string name;
+    std::string source;
+    std::array<int, 3> dims{};
+    std::vector<double> coord;
+    std::vector<double> zcorn;
+    std::vector<int> actnum;
+    // Input for the MINPV processing.
+    std::vector<double> thickness;
+    std::vector<double> pore_volume;
+    std::vector<double> min_pore_volume;
+    double z_tolerance = 0.0;
+    double max_gap = 1e20;
+
+    grdecl data() const
+    {
+        grdecl g;
+        std::copy(dims.begin(), dims.end(), g.dims);
+        g.coord = coord.data();
+        g.zcorn = zcorn.data();
+        g.actnum = actnum.empty() ? nullptr : actnum.data();
+        return g;
+    }
+};
+
+/// Timings of one phase of one model.
+struct Timing
+{
+    std::string phase;
+    std::string method;
+    std::vector<double> seconds;
+    std::string error;
+};
+
+struct Case
+{
+    std::string name;
+    std::string source;
+    std::array<int, 3> dims{};
+    int active_cells = 0;
+    std::vector<Timing> timings;
+};
+
+std::size_t zcornIndex(const std::array<int, 3>& dims, int i2, int j2, int k2)
+{
+    return i2 + 2 * static_cast<std::size_t>(dims[0]) * (j2 + 2 * static_cast<std::size_t>(dims[1]) * k2);
+}
+
+/// Create a model with vertical pillars and a dipping top surface. The
+/// layer thickness of cell (i, j, k) is given by thickness(i, j, k), the
+/// vertical shift of the column (i, j) by shift(i, j).
+Model layeredModel(const std::string& name, const std::array<int, 3>& dims,
+                   const std::function<double(int, int, int)>& thickness,
+                   const std::function<double(int, int)>& shift)
+{
+    const auto [nx, ny, nz] = dims;
+    const double dx = 100.0;
+    const double dy = 100.0;
+    Model model;
+    model.name = name;
+    model.source = "synthetic";
+    model.dims = dims;
+    model.coord.reserve(6 * static_cast<std::size_t>(nx + 1) * (ny + 1));
+    for (int j = 0; j <= ny; ++j) {
+        for (int i = 0; i <= nx; ++i) {
+            model.coord.insert(model.coord.end(), {i * dx, j * dy, 0.0, i * dx, j * dy, 1.0e4});
+        }
+    }
+    model.zcorn.resize(8 * static_cast<std::size_t>(nx) * ny * nz);
+    for (int j2 = 0; j2 < 2 * ny; ++j2) {
+        for (int i2 = 0; i2 < 2 * nx; ++i2) {
+            const int i = i2 / 2;
+            const int j = j2 / 2;
+            // Depth of the pillar the corner is on, such that the top
+            // surface is continuous apart from the shifts.
+            double z = 2000.0 + 2.0 * ((i2 + 1) / 2) + 1.0 * ((j2 + 1) / 2) + shift(i, j);
+            for (int k = 0; k < nz; ++k) {
+                model.zcorn[zcornIndex(dims, i2, j2, 2 * k)] = z;
+                z += thickness(i, j, k);
+                model.zcorn[zcornIndex(dims, i2, j2, 2 * k + 1)] = z;
+            }
+        }
+    }
+    model.actnum.assign(static_cast<std::size_t>(nx) * ny * nz, 1);
+    model.thickness.resize(model.actnum.size());
+    for (int k = 0; k < nz; ++k) {
+        for (int j = 0; j < ny; ++j) {
+            for (int i = 0; i < nx; ++i) {
+                model.thickness[i + nx * (j + static_cast<std::size_t>(ny) * k)] = thickness(i, j, k);
+            }
+        }
+    }
+    model.pore_volume.resize(model.thickness.size());
+    std::ranges::transform(model.thickness, model.pore_volume.begin(),
+                           [&](double h) { return 0.2 * dx * dy * h; });
+    // Cells thinner than 1cm are removed.
+    model.min_pore_volume.assign(model.thickness.size(), 0.2 * dx * dy * 0.01);
+    return model;
+}
+
+/// Model with a fault in the I and one in the J direction.
+Model faultedModel(const std::array<int, 3>& dims)
+{
+    return layeredModel("faulted", dims,
+                        [](int, int, int k) { return 2.0 + 0.5 * (k % 3); },
+                        [&dims](int i, int j) {
+                            return (i >= dims[0] / 2 ? 3.5 : 0.0) + (j >= dims[1] / 3 ? 1.3 : 0.0);
+                        });
+}
+
+/// Model where every fourth layer is pinched out, completely in every
+/// second column and almost in the others.
+Model pinchedModel(const std::array<int, 3>& dims)
+{
+    return layeredModel("pinched", dims,
+                        [](int i, int j, int k) {
+                            if (k % 4 == 3) {
+                                return (i + j) % 2 == 0 ? 0.0 : 1.0e-3;
+                            }
+                            return 2.0;
+                        },
+                        [](int, int) { return 0.0; });
+}
+
+/// Model in which only about 30% of the cells are active.
+Model sparseModel(const std::array<int, 3>& dims)
+{
+    auto model = layeredModel("sparse", dims,
+                              [](int, int, int) { return 2.0; },
+                              [](int, int) { return 0.0; });
+    std::uint32_t state = 12345;
+    for (auto& active : model.actnum) {
+        state = state * 1664525u + 1013904223u;
+        active = (state >> 16) % 10 < 3;
+    }
+    return model;
+}
+
+#if HAVE_OPM_COMMON
+Model deckModel(const Opm::EclipseState& ecl_state, const std::string& filename)
+{
+    const auto& ecl_grid = ecl_state.getInputGrid();
+    Model model;
+    model.name = filename;
+    model.source = "deck";
+    model.dims = {static_cast<int>(ecl_grid.getNX()),
+                  static_cast<int>(ecl_grid.getNY()),
+                  static_cast<int>(ecl_grid.getNZ())};
+    model.coord = ecl_grid.getCOORD();
+    model.zcorn = ecl_grid.getZCORN();
+    model.actnum = ecl_grid.getACTNUM();
+    model.thickness.resize(ecl_grid.getCartesianSize());
+    for (std::size_t c = 0; c < model.thickness.size(); ++c) {
+        model.thickness[c] = ecl_grid.getCellThickness(c);
+    }
+    model.pore_volume = ecl_state.fieldProps().porv(true);
+    model.min_pore_volume = ecl_grid.getMinpvVector();
+    model.z_tolerance = ecl_grid.isPinchActive() ? ecl_grid.getPinchThresholdThickness() : 0.0;
+    model.max_gap = ecl_grid.getPinchMaxEmptyGap();
+    return model;
+}
+#endif
+
+/// Time body repetitions times, running setup untimed before each
+/// repetition. If comm is given, all its processes have to call this
+/// and the maximum time over them is recorded. Errors are recorded
+/// instead of timings. With comm, the processes agree on success after
+/// setup and after body, such that all of them stop together and no
+/// process waits in a reduction that the others skip.
+Timing timePhase(const std::string& phase, const std::string& method, int repetitions,
+                 const std::function<void()>& setup,
+                 const std::function<void()>& body,
+                 const Dune::CpGrid::Communication* comm = nullptr)
+{
+    Timing timing{phase, method, {}, {}};
+    auto run = [&timing](const std::function<void()>& f) {
+        try {
+            f();
+            return 1;
+        }
+        catch (const std::exception& e) {
+            timing.error = e.what();
+            return 0;
+        }
+    };
+    auto allSucceeded = [&timing, comm](int ok) {
+        if (comm) {
+            ok = comm->min(ok);
+            if (!ok && timing.error.empty()) {
+                timing.error = "failed on another process";
+            }
+        }
+        return ok != 0;
+    };
+    for (int r = 0; r < repetitions; ++r) {
+        // The agreement after setup also synchronizes the processes before timing.
+        if (!allSucceeded(run(setup))) {
+            break;
+        }
+        Opm::time::StopWatch clock;
+        clock.start();
+        const int ok = run(body);
+        clock.stop();
+        if (!allSucceeded(ok)) {
+            break;
+        }
+        const double seconds = clock.secsSinceStart();
+        timing.seconds.push_back(comm ? comm->max(seconds) : seconds);
+    }
+    if (!timing.error.empty()) {
+        timing.seconds.clear();
+    }
+    return timing;
+}
+
+std::vector<std::pair<std::string, int>> partitionMethods()
+{
+    std::vector<std::pair<std::string, int>> methods = {{"simple", Dune::PartitionMethod::simple}};
+#ifdef HAVE_ZOLTAN
+    methods.emplace_back("zoltan", Dune::PartitionMethod::zoltan);
+#endif
+#ifdef HAVE_METIS
+    methods.emplace_back("metis", Dune::PartitionMethod::metis);
+#endif
+#ifdef HAVE_ZOLTAN
+    methods.emplace_back("zoltanGoG", Dune::PartitionMethod::zoltanGoG);
+    methods.emplace_back("zoltanGoGDistributed", Dune::PartitionMethod::zoltanGoGDistributed);
+#endif
+    methods.emplace_back("spaceFillingCurve", Dune::PartitionMethod::spaceFillingCurve);
+    return methods;
+}
+
+/// Run all benchmarks on a model. process builds the grid from the model.
+Case benchmarkModel(const Model& model, int repetitions,
+                    const Dune::CpGrid::Communication& comm,
+                    const std::function<void(Dune::CpGrid&)>& process)
+{
+    Case result{model.name, model.source, model.dims, 0, {}};
+    const bool root = comm.rank() == 0;
+    auto noSetup = [] {};
+
+    if (root) {
+        const grdecl g = model.data();
+        result.timings.push_back(timePhase("process_grdecl", "", repetitions, noSetup, [&g] {
+            processed_grid output{};
+            const int ok = process_grdecl(/* pinchActive = */ 0, /* edge_conformal = */ 0,
+                                          /* tol = */ 0.0, &g, /* is_aquifer_cell = */ nullptr,
+                                          &output);
+            free_processed_grid(&output);
+            if (!ok) {
+                throw std::runtime_error("process_grdecl failed");
+            }
+        }));
+
+        std::vector<double> zcorn;
+        const Opm::MinpvProcessor mp(model.dims[0], model.dims[1], model.dims[2]);
+        result.timings.push_back(timePhase("MinpvProcessor::process", "", repetitions,
+                                           [&] { zcorn = model.zcorn; },
+                                           [&] {
+                                               mp.process(model.thickness, model.z_tolerance,
+                                                          model.max_gap, model.pore_volume,
+                                                          model.min_pore_volume, model.actnum,
+                                                          /* mergeMinPVCells = */ false,
+                                                          zcorn.data());
+                                           }));
+    }
+
+    std::unique_ptr<Dune::CpGrid> grid;
+    auto newGrid = [&] {
+        grid = std::make_unique<Dune::CpGrid>();
+    };
+    result.timings.push_back(timePhase("processEclipseFormat", "", repetitions, newGrid,
+                                       [&] { process(*grid); }, &comm));
+    if (!result.timings.back().error.empty()) {
+        return result;
+    }
+    result.active_cells = comm.sum(grid->size(0));
+
+    result.timings.push_back(timePhase("leaf iteration", "", repetitions, noSetup, [&] {
+        double volume = 0.0;
+        int num_neighbours = 0;
+        for (const auto& element : elements(grid->leafGridView())) {
+            volume += element.geometry().volume();
+            for (const auto& intersection : intersections(grid->leafGridView(), element)) {
+                num_neighbours += intersection.neighbor();
+            }
+        }
+        if (volume < 0.0 || num_neighbours < 0) {
+            throw std::runtime_error("Invalid grid");
+        }
+    }, &comm));
+
+    for (const auto& [name, method] : partitionMethods()) {
+        result.timings.push_back(timePhase("loadBalance", name, repetitions,
+                                           [&] { newGrid(); process(*grid); },
+                                           [&, method = method] { grid->loadBalance(/* overlapLayers = */ 1, method); },
+                                           &comm));
+    }
+    grid.reset();
+
+    if (root) {
+        // Refinement is done on a serial grid, the first of the cells in
+        // the refined box are at the origin.
+        const std::array<int, 3> endIJK = {std::max(1, std::min(4, model.dims[0] / 2)),
+                                           std::max(1, std::min(4, model.dims[1] / 3)),
+                                           std::max(1, std::min(2, model.dims[2]))};
+        result.timings.push_back(timePhase("addLgrsUpdateLeafView", "", repetitions,
+                                           [&] {
+                                               grid = std::make_unique<Dune::CpGrid>(Dune::MPIHelper::getLocalCommunicator());
+                                               process(*grid);
+                                           },
+                                           [&] {
+                                               grid->addLgrsUpdateLeafView({std::array<int, 3>{2, 2, 2}},
+                                                                           {std::array<int, 3>{0, 0, 0}},
+                                                                           {endIJK}, {"LGR1"});
+                                           }));
+    }
+    return result;
+}
+
+std::string jsonString(const std::string& value)
+{
+    std::ostringstream out;
+    Opm::PhaseStatistics::writeJsonString(out, value);
+    return out.str();
+}
+
+void writeJson(std::ostream& out, const std::vector<Case>& cases,
+               int processes, int threads, int repetitions)
+{
+    out.precision(9);
+    out << "{\n"
+        << "  \"benchmark\": \"opm-grid\",\n"
+        << "  \"processes\": " << processes << ",\n"
+        << "  \"threads\": " << threads << ",\n"
+        << "  \"repetitions\": " << repetitions << ",\n"
+        << "  \"cases\": [";
+    for (std::size_t c = 0; c < cases.size(); ++c) {
+        const auto& model = cases[c];
+        out << (c == 0 ? "\n" : ",\n")
+            << "    {\n"
+            << "      \"name\": " << jsonString(model.name) << ",\n"
+            << "      \"source\": " << jsonString(model.source) << ",\n"
+            << "      \"dimensions\": [" << model.dims[0] << ", " << model.dims[1]
+            << ", " << model.dims[2] << "],\n"
+            << "      \"active_cells\": " << model.active_cells << ",\n"
+            << "      \"timings\": [";
+        for (std::size_t t = 0; t < model.timings.size(); ++t) {
+            const auto& timing = model.timings[t];
+            out << (t == 0 ? "\n" : ",\n")
+                << "        {\"phase\": " << jsonString(timing.phase);
+            if (!timing.method.empty()) {
+                out << ", \"method\": " << jsonString(timing.method);
+            }
+            if (!timing.error.empty()) {
+                out << ", \"error\": " << jsonString(timing.error) << "}";
+                continue;
+            }
+            out << ", \"seconds\": [";
+            for (std::size_t r = 0; r < timing.seconds.size(); ++r) {
+                out << (r == 0 ? "" : ", ") << timing.seconds[r];
+            }
+            const auto total = std::accumulate(timing.seconds.begin(), timing.seconds.end(), 0.0);
+            out << "], \"min\": " << *std::ranges::min_element(timing.seconds)
+                << ", \"mean\": " << total / timing.seconds.size() << "}";
+        }
+        out << "\n      ]\n"
+            << "    }";
+    }
+    out << "\n  ]\n"
+        << "}\n";
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options options;
+    auto usage = [argv] {
+        std::cerr << "Usage: " << argv[0]
+                  << " [-n NX NY NZ] [-r REPETITIONS] [-o FILE] [DECK.DATA ...]" << std::endl;
+        std::exit(EXIT_FAILURE);
+    };
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-n" && i + 3 < argc) {
+            for (int d = 0; d < 3; ++d) {
+                options.dims[d] = std::atoi(argv[++i]);
+            }
+            if (*std::ranges::min_element(options.dims) < 1) {
+                usage();
+            }
+        }
+        else if (arg == "-r" && i + 1 < argc) {
+            options.repetitions = std::atoi(argv[++i]);
+            if (options.repetitions < 1) {
+                usage();
+            }
+        }
+        else if (arg == "-o" && i + 1 < argc) {
+            options.output = argv[++i];
+        }
+        else if (!arg.empty() && arg[0] == '-') {
+            usage();
+        }
+        else {
+            options.decks.push_back(arg);
+        }
+    }
+    return options;
+}
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+try
+{
+    const auto& helper = Dune::MPIHelper::instance(argc, argv);
+    const auto options = parseOptions(argc, argv);
+    const Dune::CpGrid::Communication comm(helper.getCommunicator());
+
+    std::vector<Case> cases;
+    for (const auto& model : {faultedModel(options.dims),
+                              pinchedModel(options.dims),
+                              sparseModel(options.dims)}) {
+        cases.push_back(benchmarkModel(model, options.repetitions, comm,
+                                       [&model](Dune::CpGrid& grid) {
+                                           grid.processEclipseFormat(model.data(),
+                                                                     /* remove_ij_boundary = */ false);
+                                       }));
+    }
+
+    if (!options.decks.empty()) {
+#if HAVE_OPM_COMMON
+        Opm::Parser parser;
+        for (const auto& filename : options.decks) {
+            Opm::EclipseState ecl_state(parser.parseFile(filename));
+            const auto model = deckModel(ecl_state, filename);
+            cases.push_back(benchmarkModel(model, options.repetitions, comm,
+                                           [&ecl_state](Dune::CpGrid& grid) {
+                                               grid.processEclipseFormat(&ecl_state.getInputGrid(),
+                                                                         &ecl_state,
+                                                                         /* periodic_extension = */ false,
+                                                                         /* turn_normals = */ false,
+                                                                         /* clip_z = */ false);
+                                           }));
+        }
+#else
+        std::cerr << "Decks can only be read if opm-common is available." << std::endl;
+        return EXIT_FAILURE;
+#endif
+    }
+
+    if (comm.rank() == 0) {
+#ifdef _OPENMP
+        const int threads = omp_get_max_threads();
+#else
+        const int threads = 1;
+#endif
+        if (options.output.empty()) {
+            writeJson(std::cout, cases, comm.size(), threads, options.repetitions);
+        }
+        else {
+            std::ofstream out(options.output);
+            writeJson(out, cases, comm.size(), threads, options.repetitions);
+            if (!out) {
+                std::cerr << "Could not write " << options.output << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Program threw an exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -46,23 +46,35 @@
 
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 
+#include <opm/grid/common/FaceNeighbours.hpp>
 #include <opm/grid/common/GridEnums.hpp>
 
+#include <opm/grid/cpgrid/CommunicationPlan.hpp>
 #include <opm/grid/cpgrid/CpGridDataTraits.hpp>
 #include <opm/grid/cpgrid/DefaultGeometryPolicy.hpp>
+#include <opm/grid/cpgrid/GeometryArrays.hpp>
 #include <opm/grid/cpgrid/OrientedEntityTable.hpp>
+#include <opm/grid/cpgrid/PillarSlab.hpp>
 
 #include <opm/grid/cpgpreprocess/preprocess.h>
 
 #include <opm/grid/utility/OpmWellType.hpp>
+#include <opm/grid/utility/PhaseStatistics.hpp>
 
+#include <iosfwd>
+#include <memory>
 #include <set>
+#include <string>
 
 namespace Opm
 {
 struct NNCdata;
 class EclipseGrid;
 class EclipseState;
+namespace Lgr
+{
+template<class T> class IndexPairMap;
+}
 }
 
 namespace Dune
@@ -79,6 +91,7 @@ namespace Dune
     template<int, PartitionIteratorType> class Iterator;
     class LevelGlobalIdSet;
     class GlobalIdSet;
+    class ImplicitRefinedLevel;
     class Intersection;
     class IntersectionIterator;
     class IndexSet;
@@ -320,8 +333,11 @@ namespace Dune
 
         /// Read the Eclipse grid format ('grdecl').
         ///
+        /// Like createCartesian() this may be called on all processes, but
+        /// only rank 0 processes the input and stores the grid.
+        ///
         /// \param[in] input_data the data in grdecl format, declared in
-        /// preprocess.h.
+        /// preprocess.h. Only used on rank 0.
         ///
         /// \param[in] remove_ij_boundary if true, will remove (i, j)
         /// boundaries. Used internally.
@@ -337,6 +353,51 @@ namespace Dune
                                   bool turn_normals = false,
                                   bool edge_conformal = false);
 
+        /// Build a distributed grid from slabs of the Eclipse grid format ('grdecl').
+        ///
+        /// Called on all processes, each with its own slab of pillar rows
+        /// (see cpgrid::partitionPillarSlabs() and cpgrid::extractPillarSlab()).
+        /// The grid is never assembled on a single process, hence there is
+        /// no global view afterwards and scatterData()/gatherData() are not
+        /// available. Cells in the owned rows are interior, cells in the halo
+        /// rows overlap. Cell ids equal those of the grid built by
+        /// processEclipseFormat() from the whole model.
+        ///
+        /// \param[in] input_data The data of the stored rows of the slab.
+        ///
+        /// \param[in] slab The rows owned and stored by this process.
+        ///
+        /// \param[in] turn_normals if true, all normals will be turned. This is
+        /// intended for handling inputs with wrong orientations.
+        ///
+        /// \param[in] edge_conformal Whether or not to construct an
+        /// edge-conformal grid.  Typically useful in geo-mechanical
+        /// applications.
+        void processDistributedEclipseFormat(const grdecl& input_data,
+                                             const cpgrid::PillarSlab& slab,
+                                             bool turn_normals = false,
+                                             bool edge_conformal = false);
+
+        /// Write the processed grid to a binary snapshot file.
+        ///
+        /// Only supported for a grid that is neither distributed nor
+        /// refined. As the grid is only stored on rank 0, only rank 0
+        /// writes the file.
+        ///
+        /// \param[in] filename The file to write.
+        void writeSnapshot(const std::string& filename) const;
+
+        /// Read a grid from a snapshot written by writeSnapshot().
+        ///
+        /// Replaces processEclipseFormat(): has to be called on all
+        /// processes, but only rank 0 reads the file and stores the grid.
+        /// The file is memory mapped and its arrays are copied once into
+        /// the grid. If the file is invalid, all processes throw and the
+        /// grid is left unchanged.
+        ///
+        /// \param[in] filename The file to read.
+        void readSnapshot(const std::string& filename);
+
         //@}
 
         /// \name Cartesian grid extensions.
@@ -512,6 +573,16 @@ namespace Dune
         /// @param [in] nxnynz      Refinement factors in x-, y-, and z-direction.
         void autoRefine(const std::array<int,3>& nxnynz);
 
+        /// @brief Global refinement as in autoRefine(), stored implicitly.
+        ///
+        ///        The grid itself is not modified. The returned level only keeps the level zero grid,
+        ///        the refinement factors and one volume correction per parent cell. Geometry and
+        ///        neighbors of the refined cells are computed on demand from their parent cells,
+        ///        which avoids the memory of the explicitly stored refined level and leaf grids.
+        ///        Only available before any refinement has been done.
+        /// @param [in] nxnynz      Refinement factors in x-, y-, and z-direction. Each must be odd and positive.
+        cpgrid::ImplicitRefinedLevel autoRefineImplicitly(const std::array<int,3>& nxnynz) const;
+
         // @brief TO BE DONE
         const std::map<std::string,int>& getLgrNameToLevel() const;
 
@@ -603,8 +674,8 @@ namespace Dune
 
     private:
         void updateCornerHistoryLevels(const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                       const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                       const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                       const Opm::Lgr::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                       const std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                        const int& corner_count,
                                        const std::vector<std::array<int,2>>& preAdaptGrid_corner_history,
                                        const int& preAdaptMaxLevel,
@@ -1082,6 +1153,46 @@ namespace Dune
             return ret;
         }
 
+        /// \brief Repartitions an already distributed grid according to new cell weights.
+        ///
+        /// Meant for changes of the computational load during a simulation. Starting
+        /// from the current owners, cells at the boundaries of overloaded processes
+        /// are moved to less loaded neighbouring processes (see Dune::diffusePartition),
+        /// such that most cells keep their owner and no process is left without cells.
+        /// Both the new owners and the new overlap are computed on the distributed view
+        /// with communication between neighbouring processes only. The new distributed
+        /// view is then set up from the old one: each cell is sent by its old owner to
+        /// the processes storing it afterwards and copied locally if it stays. Only the
+        /// processes exchanging cells communicate. If this fails, the grid keeps its old
+        /// distributed view. The global grid is not needed, but if rank 0 has it, the
+        /// interfaces for scatterData() and gatherData() are set up again.
+        /// \param cellWeights The load of each cell of the distributed view. Only the
+        ///                    values of owned cells are used.
+        /// \param imbalanceTol The accepted ratio of the largest to the average load.
+        /// \param ownersFirst Order owner cells before copy/overlap cells.
+        /// \param addCornerCells Add corner cells to the overlap layer.
+        /// \param overlapLayers The number of layers of cells of the overlap region (default: 1).
+        /// \return Whether the grid was repartitioned, i.e. whether any cell changed its owner.
+        /// \warning Needs the distributed view of a grid distributed with loadBalance() and
+        ///          does not support local refinement. Entities and indices of the old
+        ///          distributed view become invalid.
+        bool repartition(const std::vector<double>& cellWeights, double imbalanceTol = 1.1,
+                         bool ownersFirst = false, bool addCornerCells = false, int overlapLayers = 1);
+
+        /// \brief Repartitions an already distributed grid and moves the attached data.
+        ///
+        /// Repartitions as above. Then the data handle gathers the data of each cell
+        /// from the entity of its old owner and scatters it to the corresponding
+        /// entities of the new distributed view. Cells staying on their owner are copied
+        /// locally, only cells stored on other processes afterwards are communicated.
+        /// \param data A data handle describing how to move the data. Only data
+        ///             attached to cells is moved.
+        /// \tparam DataHandle The type implementing DUNE's DataHandle interface.
+        template<class DataHandle>
+        bool repartition(DataHandle& data, const std::vector<double>& cellWeights,
+                         double imbalanceTol = 1.1, bool ownersFirst = false,
+                         bool addCornerCells = false, int overlapLayers = 1);
+
         /// \brief Partitions the grid using Zoltan without decomposing and distributing it among processes.
         /// \param wells The wells of the eclipse.
         /// \param possibleFutureConnections An optional unordered_map<string, set<array<int,3>>>
@@ -1125,6 +1236,46 @@ namespace Dune
         template<class DataHandle>
         void communicate (DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const;
 
+        /// \brief Create a persistent plan for communicating data of fixed size.
+        ///
+        /// For data that is exchanged many times the plan avoids negotiating message
+        /// sizes and allocating buffers on each call, see cpgrid::CommunicationPlan.
+        /// The plan refers to the current view of the grid and has to be recreated
+        /// after load balancing or refinement.
+        /// \tparam DataHandle The type of the data handle describing the data.
+        /// \param data The data handle describing the data. Has to adhere to the Dune::DataHandleIF
+        ///             interface and must have a fixed size.
+        /// \param iftype The interface to use for the communication.
+        /// \param dir The direction of the communication along the interface (forward or backward).
+        template<class DataHandle>
+        cpgrid::CommunicationPlan<DataHandle>
+        communicationPlan(DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const;
+
+        /// \brief Start communicating objects for all codims without waiting for the messages.
+        ///
+        /// Data of fixed size is gathered and the messages are posted. Work that does
+        /// not depend on the received data, e.g. on interior cells, can be done before
+        /// finishing the communication with finishCommunicate(). Data of variable size
+        /// is communicated before returning.
+        /// \tparam DataHandle The type of the data handle describing the data.
+        /// \param data The data handle describing the data. Has to adhere to the
+        ///             Dune::DataHandleIF interface and must outlive the communication.
+        /// \param iftype The interface to use for the communication.
+        /// \param dir The direction of the communication along the interface (forward or backward).
+        /// \return The pending communication. It is finished at the latest when it is destroyed.
+        template<class DataHandle>
+        cpgrid::PendingCommunication<DataHandle>
+        startCommunicate(DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const;
+
+        /// \brief Finish a communication started with startCommunicate().
+        ///
+        /// Waits for the messages and scatters the received data.
+        template<class DataHandle>
+        void finishCommunicate(cpgrid::PendingCommunication<DataHandle>& communication) const
+        {
+            communication.finish();
+        }
+
         /// \brief Get the collective communication object.
         const typename CpGridTraits::Communication& comm () const;
         //@}
@@ -1258,6 +1409,33 @@ namespace Dune
         /// \param cell The index identifying the face.
         const Vector& cellCentroid(int cell) const;
 
+        /// \brief Get the cell and face geometry of the leaf grid view as structure of arrays.
+        ///
+        /// The arrays hold the same values as cellVolume(), cellCentroid(),
+        /// faceArea(), faceCentroid() and faceNormal(). They are created on the
+        /// first call, which is not thread safe, and kept for later calls.
+        const cpgrid::GeometryArrays& geometryArrays() const;
+
+        /// \brief Get the flat face-cell adjacency of the leaf grid view.
+        ///
+        /// Contains the cells, face index, face tag and orientation of all
+        /// interior faces and the cell-to-face relation in compressed row
+        /// format. It is created on the first call, which is not thread safe,
+        /// and shared with all later callers.
+        std::shared_ptr<const FaceNeighbours> faceNeighbours() const;
+
+        /// \brief Get wall time, peak memory increase and counters of the grid setup phases.
+        ///
+        /// Filled by processEclipseFormat(), createCartesian() and loadBalance(),
+        /// e.g. "process_grdecl", "buildTopo", "buildGeom", "partitioning",
+        /// "addOverlapLayer", "distributeGlobalGrid" and
+        /// "computeCommunicationInterfaces". The values are those of the
+        /// calling process only.
+        const Opm::PhaseStatistics& phaseStatistics() const;
+
+        /// \brief Write phaseStatistics() as JSON.
+        void writePhaseStatistics(std::ostream& os) const;
+
         /// \brief An iterator over the centroids of the geometry of the entities.
         /// \tparam codim The co-dimension of the entities.
         template<int codim>
@@ -1475,6 +1653,31 @@ namespace Dune
                     const std::vector<int>& input_cell_part = {},
                     int level = -1);
 
+        /// \brief Set up the repartitioned distributed view, see repartition().
+        /// \return The distributed view before repartitioning and an interface for moving
+        ///         cell data to the new view (send indices refer to the old view, receive
+        ///         indices to the new one), or nullptrs if no cell changed its owner.
+        std::pair<std::shared_ptr<cpgrid::CpGridData>, std::shared_ptr<InterfaceMap>>
+        repartitionGrid(const std::vector<double>& cellWeights, double imbalanceTol,
+                        bool ownersFirst, bool addCornerCells, int overlapLayers);
+
+        /// \brief Replaces the distributed view by one with new owners and overlap.
+        ///
+        /// Each cell is sent by its owner to the processes storing it afterwards. Used
+        /// by repartitionGrid() and by scatterGrid() to add the overlap to a view of
+        /// owned cells only.
+        /// \param new_part For each cell of the distributed view the rank of its new owner.
+        /// \param processes For each cell of the distributed view the ranks of the processes
+        ///                  storing it afterwards. Only used for owned cells.
+        /// \param ownersFirst Order owner cells before copy/overlap cells.
+        /// \param phase The phase of the statistics getting the counters.
+        /// \return The old distributed view and an interface for moving cell data to the
+        ///         new one, see repartitionGrid().
+        std::pair<std::shared_ptr<cpgrid::CpGridData>, std::shared_ptr<InterfaceMap>>
+        migrateDistributedView(const std::vector<int>& new_part,
+                               const std::vector<std::vector<int>>& processes,
+                               bool ownersFirst, const std::string& phase);
+
         /** @brief The data stored in the grid.
          *
          * All the data of all grids are stored there and
@@ -1564,6 +1767,20 @@ namespace Dune
         current_data_->back()->communicate(data, iftype, dir);
     }
 
+    template<class DataHandle>
+    cpgrid::CommunicationPlan<DataHandle>
+    CpGrid::communicationPlan(DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const
+    {
+        return current_data_->back()->communicationPlan(data, iftype, dir);
+    }
+
+    template<class DataHandle>
+    cpgrid::PendingCommunication<DataHandle>
+    CpGrid::startCommunicate(DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const
+    {
+        return current_data_->back()->startCommunicate(data, iftype, dir);
+    }
+
 
     template<class DataHandle>
     void CpGrid::scatterData([[maybe_unused]] DataHandle& handle) const
@@ -1580,6 +1797,26 @@ namespace Dune
 #endif
     }
 
+    template<class DataHandle>
+    bool CpGrid::repartition(DataHandle& data, const std::vector<double>& cellWeights,
+                             double imbalanceTol, bool ownersFirst,
+                             bool addCornerCells, int overlapLayers)
+    {
+        auto [old_data, migration] = repartitionGrid(cellWeights, imbalanceTol, ownersFirst,
+                                                     addCornerCells, overlapLayers);
+        if (!old_data) {
+            return false;
+        }
+#if HAVE_MPI
+        if (data.contains(3, 0)) {
+            cpgrid::Entity2IndexDataHandle<DataHandle, 0> data_wrapper(*old_data, *distributed_data_[0], data);
+            distributed_data_[0]->communicateCodim<0>(data_wrapper, ForwardCommunication, *migration);
+        }
+#endif
+        global_id_set_ptr_->eraseIdSet(*old_data);
+        return true;
+    }
+
     template<class DataHandle>
     void CpGrid::gatherData([[maybe_unused]] DataHandle& handle) const
     {
@@ -1659,5 +1896,6 @@ namespace Dune
 #include "cpgrid/Intersection.hpp"
 #include "cpgrid/Geometry.hpp"
 #include "cpgrid/Indexsets.hpp"
+#include "cpgrid/ImplicitRefinedLevel.hpp"
 
 #endif // OPM_CPGRID_HEADER
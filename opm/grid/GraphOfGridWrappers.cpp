@@ -29,6 +29,11 @@
 #include <opm/grid/common/ZoltanPartition.hpp> // function scatterExportInformation
 #include <opm/grid/common/ZoltanGraphFunctions.hpp> // makeImportAndExportLists when allowDistributedWells==true
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
 namespace Opm {
 
 #if HAVE_MPI
@@ -194,7 +199,14 @@ void extendGIDtoRank(const GraphOfGrid<Dune::CpGrid>& gog,
                      std::vector<int>& gIDtoRank,
                      const int& root)
 {
-    for (const auto& w : gog.getWells())
+    extendGIDtoRank(gog.getWells(), gIDtoRank, root);
+}
+
+void extendGIDtoRank(const std::list<std::set<int>>& wells,
+                     std::vector<int>& gIDtoRank,
+                     const int& root)
+{
+    for (const auto& w : wells)
     {
         auto wellRank = gIDtoRank[*w.begin()];
         if (wellRank!=root)
@@ -374,6 +386,65 @@ void extendAndSortExportAndImportLists(const GraphOfGrid<Dune::CpGrid>& gog,
 }
 #endif // HAVE_MPI
 
+namespace Impl {
+
+namespace {
+// Spread the lowest 21 bits of x such that two zero bits follow each of them.
+std::uint64_t spreadBits(std::uint64_t x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+} // end anonymous namespace
+
+std::uint64_t mortonKey(std::array<std::uint32_t,3> coords)
+{
+    return spreadBits(coords[0]) << 2 | spreadBits(coords[1]) << 1 | spreadBits(coords[2]);
+}
+
+std::uint64_t hilbertKey(std::array<std::uint32_t,3> coords)
+{
+    // Transform the coordinates into the transposed Hilbert index, see
+    // J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004).
+    // Interleaving the bits of the result gives the index.
+    constexpr std::uint32_t highestBit = 1u << 20;
+    for (auto& c : coords) {
+        c &= 0x1fffff;
+    }
+    for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+        const std::uint32_t p = q - 1;
+        for (int i = 0; i < 3; ++i) {
+            if (coords[i] & q) {
+                coords[0] ^= p; // invert
+            } else {
+                const std::uint32_t t = (coords[0] ^ coords[i]) & p; // exchange
+                coords[0] ^= t;
+                coords[i] ^= t;
+            }
+        }
+    }
+    // Gray encode
+    coords[1] ^= coords[0];
+    coords[2] ^= coords[1];
+    std::uint32_t t = 0;
+    for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+        if (coords[2] & q) {
+            t ^= q - 1;
+        }
+    }
+    for (auto& c : coords) {
+        c ^= t;
+    }
+    return mortonKey(coords);
+}
+
+} // end namespace Impl
+
 std::vector<int> getWellRanks(const std::vector<int>& gIDtoRank,
                               const Dune::cpgrid::WellConnections& wellConnections)
 {
@@ -750,6 +821,73 @@ applySerialZoltan (const Dune::CpGrid& grid,
     Zoltan_Destroy(&zz);
     return std::make_tuple(rc, gIDtoRank);
 }
+
+/// \brief Make import and export lists and the distribution of wells from gIDtoRank
+///
+/// gIDtoRank is only relevant on root, where it has to cover all cells.
+std::tuple<std::vector<int>,
+           std::vector<std::pair<std::string, bool>>,
+           std::vector<std::tuple<int,int,char> >,
+           std::vector<std::tuple<int,int,char,int> >,
+           Dune::cpgrid::WellConnections>
+makeListsFromGIDtoRank(const Dune::CpGrid& grid,
+                       std::vector<int> gIDtoRank,
+                       const std::vector<Dune::cpgrid::OpmWellType> * wells,
+                       const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                       Dune::cpgrid::WellConnections wellConnections,
+                       const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                       int root,
+                       bool allowDistributedWells)
+{
+    using AttributeSet = Dune::cpgrid::CpGridData::AttributeSet;
+    std::vector<std::tuple<int, int, char>> myExportList;
+    std::vector<std::tuple<int, int, char, int>> myImportList;
+    std::vector<std::vector<int>> exportedCells;
+
+    if (cc.rank() == root) {
+        // prepare exportedCells for communication
+        exportedCells = makeExportListsFromGIDtoRank(gIDtoRank, cc.size());
+        myImportList.reserve(exportedCells[root].size());
+        for (const auto& cell : exportedCells[root]) {
+            myImportList.emplace_back(cell, root, static_cast<char>(AttributeSet::owner), -1);
+        }
+        // exclude root's own cells from communication
+        exportedCells[root].resize(0);
+    }
+    // communicate and create import+export lists
+    auto importedCells = Opm::Impl::communicateExportedCells(exportedCells, cc, root);
+    if (cc.rank() == root) {
+        myExportList.reserve(grid.numCells());
+        for (int i = 0; i < grid.numCells(); ++i) {
+            myExportList.emplace_back(i, gIDtoRank[i], static_cast<char>(AttributeSet::owner));
+        }
+    } else {
+        myImportList.reserve(importedCells.size());
+        for (const auto& cell : importedCells) {
+            myImportList.emplace_back(cell, root, static_cast<char>(AttributeSet::owner), -1);
+        }
+    }
+
+    // get the distribution of wells
+    std::vector<std::pair<std::string, bool>> parallel_wells;
+    if (wells) {
+        if (allowDistributedWells) {
+            // wells can be split among several processes
+            auto wellsOnProc = Dune::cpgrid::perforatingWellIndicesOnProc(gIDtoRank, *wells, possibleFutureConnections, grid);
+            parallel_wells = Dune::cpgrid::computeParallelWells(wellsOnProc, *wells, cc, root);
+        } else {
+            // each well is guaranteed to be on a single process
+            auto wellRanks = getWellRanks(gIDtoRank, wellConnections);
+            parallel_wells = wellsOnThisRank(*wells, wellRanks, cc, root);
+        }
+    }
+
+    return std::make_tuple(std::move(gIDtoRank),
+                           std::move(parallel_wells),
+                           std::move(myExportList),
+                           std::move(myImportList),
+                           std::move(wellConnections));
+}
 } // end anonymous namespace
 
 std::tuple<std::vector<int>,
@@ -772,10 +910,6 @@ zoltanSerialPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
     bool partitionIsEmpty = cc.rank() != root;
     int rc = ZOLTAN_OK;
     std::vector<int> gIDtoRank;
-    using AttributeSet = Dune::cpgrid::CpGridData::AttributeSet;
-    std::vector<std::tuple<int, int, char>> myExportList;
-    std::vector<std::tuple<int, int, char, int>> myImportList;
-    std::vector<std::vector<int>> exportedCells;
     auto wellConnections = partitionIsEmpty || !wells ? Dune::cpgrid::WellConnections()
                                                       : Dune::cpgrid::WellConnections(*wells, possibleFutureConnections, grid);
 
@@ -805,49 +939,616 @@ zoltanSerialPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
         }
     }
 
-    if (cc.rank() == root) {
-        // prepare exportedCells for communication
-        exportedCells = makeExportListsFromGIDtoRank(gIDtoRank, cc.size());
-        myImportList.reserve(exportedCells[root].size());
-        for (const auto& cell : exportedCells[root]) {
-            myImportList.emplace_back(cell, root, static_cast<char>(AttributeSet::owner), -1);
+    return makeListsFromGIDtoRank(grid,
+                                  std::move(gIDtoRank),
+                                  wells,
+                                  possibleFutureConnections,
+                                  std::move(wellConnections),
+                                  cc,
+                                  root,
+                                  allowDistributedWells);
+}
+
+namespace Impl {
+
+namespace {
+// Block holding the vertices [begin, end) of the sorted vertex IDs of gog
+GraphOfGridBlock makeGraphOfGridBlock(const GraphOfGrid<Dune::CpGrid>& gog,
+                                      const std::vector<int>& sortedGIDs,
+                                      const std::vector<int>& blockBegin,
+                                      int begin,
+                                      int end)
+{
+    // rank of the (nonempty) block containing a vertex
+    auto rankOf = [&sortedGIDs, &blockBegin](int gID) {
+        const int pos = std::ranges::lower_bound(sortedGIDs, gID) - sortedGIDs.begin();
+        assert(pos < (int)sortedGIDs.size() && sortedGIDs[pos] == gID);
+        return static_cast<int>(std::ranges::upper_bound(blockBegin, pos) - blockBegin.begin()) - 1;
+    };
+
+    GraphOfGridBlock block;
+    block.gIDs.assign(sortedGIDs.begin() + begin, sortedGIDs.begin() + end);
+    block.weights.reserve(end - begin);
+    block.edgeOffsets.reserve(end - begin + 1);
+    for (const auto& gID : block.gIDs) {
+        const auto& vertex = gog.getVertex(gID);
+        block.weights.push_back(vertex.weight);
+        for (const auto& [nbor, weight] : vertex.edges) {
+            block.nborGIDs.push_back(nbor);
+            block.nborRanks.push_back(rankOf(nbor));
+            block.edgeWeights.push_back(weight);
         }
-        // exclude root's own cells from communication
-        exportedCells[root].resize(0);
+        block.edgeOffsets.push_back(block.nborGIDs.size());
     }
-    // communicate and create import+export lists
-    auto importedCells = Opm::Impl::communicateExportedCells(exportedCells, cc, root);
+    return block;
+}
+
+void sendGraphOfGridBlock(const GraphOfGridBlock& block,
+                          int dest,
+                          const Dune::cpgrid::CpGridDataTraits::Communication& cc)
+{
+    int tag = 41; // a random number
+    const int sizes[2] = { block.size(), static_cast<int>(block.nborGIDs.size()) };
+    MPI_Send(sizes, 2, MPI_INT, dest, tag, cc);
+    MPI_Send(block.gIDs.data(), sizes[0], MPI_INT, dest, tag + 1, cc);
+    MPI_Send(block.weights.data(), sizes[0], MPI_FLOAT, dest, tag + 2, cc);
+    MPI_Send(block.edgeOffsets.data(), sizes[0] + 1, MPI_INT, dest, tag + 3, cc);
+    MPI_Send(block.nborGIDs.data(), sizes[1], MPI_INT, dest, tag + 4, cc);
+    MPI_Send(block.nborRanks.data(), sizes[1], MPI_INT, dest, tag + 5, cc);
+    MPI_Send(block.edgeWeights.data(), sizes[1], MPI_FLOAT, dest, tag + 6, cc);
+}
+
+GraphOfGridBlock receiveGraphOfGridBlock(int source,
+                                         const Dune::cpgrid::CpGridDataTraits::Communication& cc)
+{
+    int tag = 41; // a random number
+    int sizes[2];
+    MPI_Recv(sizes, 2, MPI_INT, source, tag, cc, MPI_STATUS_IGNORE);
+    GraphOfGridBlock block;
+    block.gIDs.resize(sizes[0]);
+    block.weights.resize(sizes[0]);
+    block.edgeOffsets.resize(sizes[0] + 1);
+    block.nborGIDs.resize(sizes[1]);
+    block.nborRanks.resize(sizes[1]);
+    block.edgeWeights.resize(sizes[1]);
+    MPI_Recv(block.gIDs.data(), sizes[0], MPI_INT, source, tag + 1, cc, MPI_STATUS_IGNORE);
+    MPI_Recv(block.weights.data(), sizes[0], MPI_FLOAT, source, tag + 2, cc, MPI_STATUS_IGNORE);
+    MPI_Recv(block.edgeOffsets.data(), sizes[0] + 1, MPI_INT, source, tag + 3, cc, MPI_STATUS_IGNORE);
+    MPI_Recv(block.nborGIDs.data(), sizes[1], MPI_INT, source, tag + 4, cc, MPI_STATUS_IGNORE);
+    MPI_Recv(block.nborRanks.data(), sizes[1], MPI_INT, source, tag + 5, cc, MPI_STATUS_IGNORE);
+    MPI_Recv(block.edgeWeights.data(), sizes[1], MPI_FLOAT, source, tag + 6, cc, MPI_STATUS_IGNORE);
+    return block;
+}
+} // end anonymous namespace
+
+GraphOfGridBlock scatterGraphOfGrid(const GraphOfGrid<Dune::CpGrid>& gog,
+                                    const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                    int root)
+{
+    if (cc.rank() != root) {
+        return receiveGraphOfGridBlock(root, cc);
+    }
+
+    const int size = cc.size();
+    std::vector<int> sortedGIDs;
+    sortedGIDs.reserve(gog.size());
+    for (const auto& vertex : gog) {
+        sortedGIDs.push_back(vertex.first);
+    }
+    std::ranges::sort(sortedGIDs);
+    const long long n = sortedGIDs.size();
+    std::vector<int> blockBegin(size + 1);
+    for (int p = 0; p <= size; ++p) {
+        blockBegin[p] = n * p / size;
+    }
+
+    // Blocks are built and sent one at a time, such that root never
+    // holds more than the graph and a single block of the other ranks.
+    GraphOfGridBlock myBlock;
+    for (int p = 0; p < size; ++p) {
+        auto block = makeGraphOfGridBlock(gog, sortedGIDs, blockBegin, blockBegin[p], blockBegin[p + 1]);
+        if (p == root) {
+            myBlock = std::move(block);
+        } else {
+            sendGraphOfGridBlock(block, p, cc);
+        }
+    }
+    return myBlock;
+}
+
+std::vector<int> gatherGraphOfGridParts(const std::list<std::set<int>>& wells,
+                                        const GraphOfGridBlock& block,
+                                        const std::vector<int>& parts,
+                                        int numCells,
+                                        const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                        int root)
+{
+    assert((int)parts.size() == block.size());
+    const int size = cc.size();
+    int myNumVertices = block.size();
+    std::vector<int> numVertices(size, 0);
+    cc.gather(&myNumVertices, numVertices.data(), 1, root);
+    std::vector<int> displ(size, 0);
+    std::partial_sum(numVertices.begin(), numVertices.end() - 1, displ.begin() + 1);
+
+    const int total = cc.rank() == root ? displ.back() + numVertices.back() : 0;
+    std::vector<int> gIDs(total);
+    std::vector<int> allParts(total);
+    cc.gatherv(block.gIDs.data(), myNumVertices, gIDs.data(), numVertices.data(), displ.data(), root);
+    cc.gatherv(parts.data(), myNumVertices, allParts.data(), numVertices.data(), displ.data(), root);
+
+    std::vector<int> gIDtoRank;
     if (cc.rank() == root) {
-        myExportList.reserve(grid.numCells());
-        for (int i = 0; i < grid.numCells(); ++i) {
-            myExportList.emplace_back(i, gIDtoRank[i], static_cast<char>(AttributeSet::owner));
+        gIDtoRank.resize(numCells, root);
+        for (int i = 0; i < total; ++i) {
+            gIDtoRank[gIDs[i]] = allParts[i];
+        }
+        // partitioner sees only one cell per well, modify remaining
+        extendGIDtoRank(wells, gIDtoRank, root);
+    }
+    return gIDtoRank;
+}
+
+} // end namespace Impl
+
+namespace {
+// Zoltan callbacks for the part of a GraphOfGrid stored on this rank.
+// As local IDs are not used, vertices are found by binary search in the sorted gIDs.
+int blockVertexIndex(const Impl::GraphOfGridBlock& block, int gID)
+{
+    auto pos = std::ranges::lower_bound(block.gIDs, gID);
+    if (pos == block.gIDs.end() || *pos != gID) {
+        return -1;
+    }
+    return pos - block.gIDs.begin();
+}
+
+int getGraphOfGridBlockNumVertices(void* pBlock, int *err)
+{
+    const auto& block = *static_cast<const Impl::GraphOfGridBlock*>(pBlock);
+    *err = ZOLTAN_OK;
+    return block.size();
+}
+
+void getGraphOfGridBlockVerticesList(void* pBlock,
+                    [[maybe_unused]] int dimGlobalID,
+                    [[maybe_unused]] int dimLocalID,
+                                     ZOLTAN_ID_PTR gIDs,
+                    [[maybe_unused]] ZOLTAN_ID_PTR lIDs,
+                    [[maybe_unused]] int weightDim,
+                                     float *objWeights,
+                                     int *err)
+{
+    assert(dimGlobalID==1); // ID is a single int
+    assert(weightDim==1); // vertex weight is a single float
+    const auto& block = *static_cast<const Impl::GraphOfGridBlock*>(pBlock);
+    for (int i = 0; i < block.size(); ++i)
+    {
+        gIDs[i] = block.gIDs[i];
+        objWeights[i] = block.weights[i];
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getGraphOfGridBlockNumEdges(void *pBlock,
+                [[maybe_unused]] int dimGlobalID,
+                [[maybe_unused]] int dimLocalID,
+                                 int numCells,
+                                 ZOLTAN_ID_PTR gIDs,
+                [[maybe_unused]] ZOLTAN_ID_PTR lIDs,
+                                 int *numEdges,
+                                 int *err)
+{
+    assert(dimGlobalID==1); // ID is a single int
+    const auto& block = *static_cast<const Impl::GraphOfGridBlock*>(pBlock);
+    for (int i = 0; i < numCells; ++i)
+    {
+        int v = blockVertexIndex(block, gIDs[i]);
+        if (v == -1)
+        {
+            std::ostringstream ostr;
+            ostr << "getGraphOfGridBlockNumEdges error: Vertex with ID " << gIDs[i] << " is not on this rank.";
+            OpmLog::error(ostr.str());
+            *err = ZOLTAN_FATAL;
+            return;
+        }
+        numEdges[i] = block.edgeOffsets[v + 1] - block.edgeOffsets[v];
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getGraphOfGridBlockEdgeList(void *pBlock,
+                [[maybe_unused]] int dimGlobalID,
+                [[maybe_unused]] int dimLocalID,
+                                 int numCells,
+                                 ZOLTAN_ID_PTR gIDs,
+                [[maybe_unused]] ZOLTAN_ID_PTR lIDs,
+                                 int *numEdges,
+                                 ZOLTAN_ID_PTR nborGIDs,
+                                 int *nborProc,
+                [[maybe_unused]] int weightDim,
+                                 float *edgeWeights,
+                                 int *err)
+{
+    assert(dimGlobalID==1); // ID is a single int
+    assert(weightDim==1); // edge weight is a single float
+    const auto& block = *static_cast<const Impl::GraphOfGridBlock*>(pBlock);
+    int id = 0;
+    for (int i = 0; i < numCells; ++i)
+    {
+        int v = blockVertexIndex(block, gIDs[i]);
+        if (v == -1 || block.edgeOffsets[v + 1] - block.edgeOffsets[v] != numEdges[i])
+        {
+            std::ostringstream ostr;
+            ostr << "getGraphOfGridBlockEdgeList error: Vertex with ID " << gIDs[i]
+                 << " is not on this rank or its number of edges disagrees with Zoltan.";
+            OpmLog::error(ostr.str());
+            *err = ZOLTAN_FATAL;
+            return;
+        }
+        for (int e = block.edgeOffsets[v]; e < block.edgeOffsets[v + 1]; ++e)
+        {
+            nborGIDs[id] = block.nborGIDs[e];
+            nborProc[id] = block.nborRanks[e];
+            edgeWeights[id] = block.edgeWeights[e];
+            ++id;
+        }
+    }
+    *err = ZOLTAN_OK;
+}
+} // end anonymous namespace
+
+std::tuple<std::vector<int>,
+           std::vector<std::pair<std::string, bool>>,
+           std::vector<std::tuple<int,int,char> >,
+           std::vector<std::tuple<int,int,char,int> >,
+           Dune::cpgrid::WellConnections>
+zoltanDistributedPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
+                                             const std::vector<Dune::cpgrid::OpmWellType> * wells,
+                                             const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                             const double* transmissibilities,
+                                             const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                             Dune::EdgeWeightMethod edgeWeightMethod,
+                                             int root,
+                                             const double zoltanImbalanceTol,
+                                             bool allowDistributedWells,
+                                             const std::map<std::string, std::string>& params)
+{
+    float ver = 0;
+    struct Zoltan_Struct *zz;
+    int changes, numGidEntries, numLidEntries, numImport, numExport;
+    ZOLTAN_ID_PTR importGlobalGids, importLocalGids, exportGlobalGids, exportLocalGids;
+    int *importProcs, *importToPart, *exportProcs, *exportToPart;
+    int argc=0;
+    char** argv = 0 ;
+    int rc = Zoltan_Initialize(argc, argv, &ver);
+    if (rc != ZOLTAN_OK) {
+        OPM_THROW(std::runtime_error, "Could not initialize Zoltan!");
+    }
+    zz = Zoltan_Create(cc);
+    if (zz == nullptr) {
+        OPM_THROW(std::runtime_error, "Could not create Zoltan data structures!");
+    }
+    setDefaultZoltanParameters(zz);
+    Zoltan_Set_Param(zz, "IMBALANCE_TOL", std::to_string(zoltanImbalanceTol).c_str());
+    int layers = 0; // extra layers of cells attached to wells to distance them from boundary
+    for (const auto& [key, value] : params)
+    {
+        if (key=="EnvelopeWellLayers")
+            layers = std::stoi(value);
+        else
+            Zoltan_Set_Param(zz, key.c_str(), value.c_str());
+    }
+
+    // root process has the whole grid, other ranks nothing
+    bool partitionIsEmpty = cc.rank()!=root;
+
+    auto wellConnections = partitionIsEmpty || !wells ? Dune::cpgrid::WellConnections()
+                                                      : Dune::cpgrid::WellConnections(*wells, possibleFutureConnections, grid);
+    // Prepare graph and contract well cells on root, then spread it over all ranks.
+    // Only the contracted wells are kept afterwards, root's graph is released before
+    // the partitioner runs, such that root only holds its block during partitioning.
+    Impl::GraphOfGridBlock block;
+    std::list<std::set<int>> contractedWells;
+    {
+        GraphOfGrid gog(grid, transmissibilities, edgeWeightMethod);
+        if (!allowDistributedWells){
+            // skip cell contraction if wells can be distributed over multiple processes
+            addWellConnections(gog, wellConnections);
+            gog.addNeighboringCellsToWells(layers);
+        }
+        block = Impl::scatterGraphOfGrid(gog, cc, root);
+        contractedWells = gog.getWells();
+    }
+
+    // call partitioner
+    Zoltan_Set_Num_Obj_Fn(zz, getGraphOfGridBlockNumVertices, &block);
+    Zoltan_Set_Obj_List_Fn(zz, getGraphOfGridBlockVerticesList, &block);
+    Zoltan_Set_Num_Edges_Multi_Fn(zz, getGraphOfGridBlockNumEdges, &block);
+    Zoltan_Set_Edge_List_Multi_Fn(zz, getGraphOfGridBlockEdgeList, &block);
+    rc = Zoltan_LB_Partition(zz, /* input (all remaining fields are output) */
+                             &changes,        /* 1 if partitioning was changed, 0 otherwise */
+                             &numGidEntries,  /* Number of integers used for a global ID */
+                             &numLidEntries,  /* Number of integers used for a local ID */
+                             &numImport,      /* Number of vertices to be sent to me */
+                             &importGlobalGids,  /* Global IDs of vertices to be sent to me */
+                             &importLocalGids,   /* Local IDs of vertices to be sent to me */
+                             &importProcs,    /* Process rank for source of each incoming vertex */
+                             &importToPart,   /* New partition for each incoming vertex */
+                             &numExport,      /* Number of vertices I must send to other processes*/
+                             &exportGlobalGids,  /* Global IDs of the vertices I must send */
+                             &exportLocalGids,   /* Local IDs of the vertices I must send */
+                             &exportProcs,    /* Process to which I send each of the vertices */
+                             &exportToPart);  /* Partition to which each vertex will belong */
+    if (rc == ZOLTAN_WARN) {
+        OpmLog::warning("Zoltan_LB_Partition returned with warning");
+    } else if (rc == ZOLTAN_MEMERR) {
+        OPM_THROW(std::runtime_error, "Memory allocation failure in Zoltan_LB_Partition");
+    } else if (rc == ZOLTAN_FATAL) {
+        OPM_THROW(std::runtime_error, "Error returned from Zoltan_LB_Partition");
+    }
+
+    // vertices that are not exported stay on this rank
+    std::vector<int> parts(block.size(), cc.rank());
+    for (int i = 0; i < numExport; ++i) {
+        parts[blockVertexIndex(block, exportGlobalGids[i])] = exportToPart[i];
+    }
+    Zoltan_LB_Free_Part(&exportGlobalGids, &exportLocalGids, &exportProcs, &exportToPart);
+    Zoltan_LB_Free_Part(&importGlobalGids, &importLocalGids, &importProcs, &importToPart);
+    Zoltan_Destroy(&zz);
+
+    auto gIDtoRank = Impl::gatherGraphOfGridParts(contractedWells, block, parts, grid.numCells(), cc, root);
+    return makeListsFromGIDtoRank(grid,
+                                  std::move(gIDtoRank),
+                                  wells,
+                                  possibleFutureConnections,
+                                  std::move(wellConnections),
+                                  cc,
+                                  root,
+                                  allowDistributedWells);
+}
+namespace Impl {
+
+std::vector<int> cutCurve(const std::vector<float>& weights,
+                          int numParts,
+                          const Dune::cpgrid::CpGridDataTraits::Communication& cc)
+{
+    const double myWeight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    const auto [before, total] = exclusiveSum(myWeight, cc);
+
+    // a vertex belongs to the piece containing the middle of its weight
+    std::vector<int> parts(weights.size(), 0);
+    double position = before;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        const double middle = position + 0.5 * weights[i];
+        if (total > 0) {
+            parts[i] = std::min(static_cast<int>(middle * numParts / total), numParts - 1);
+        }
+        position += weights[i];
+    }
+    return parts;
+}
+
+} // end namespace Impl
+
+namespace {
+/// \brief Keys of cells along a space-filling curve
+///
+/// The centroids are scaled uniformly to fill the 21 bits available for
+/// each coordinate, IJK coordinates are used as they are.
+std::vector<std::uint64_t> curveKeys(const Dune::CpGrid& grid,
+                                     const std::vector<int>& cells,
+                                     bool morton,
+                                     bool useIJK)
+{
+    const int numCells = cells.size();
+    std::array<double, 3> lower;
+    lower.fill(0.0);
+    double scale = 1.0;
+    if (useIJK) {
+        const auto& dims = grid.logicalCartesianSize();
+        if (*std::ranges::max_element(dims) > (1 << 21)) {
+            OPM_THROW(std::logic_error, "Logical Cartesian grid too large for space-filling curve.");
         }
     } else {
-        myImportList.reserve(importedCells.size());
-        for (const auto& cell : importedCells) {
-            myImportList.emplace_back(cell, root, static_cast<char>(AttributeSet::owner), -1);
+        std::array<double, 3> upper;
+        lower.fill(std::numeric_limits<double>::max());
+        upper.fill(std::numeric_limits<double>::lowest());
+        for (const int cell : cells) {
+            const auto& centroid = grid.cellCentroid(cell);
+            for (int d = 0; d < 3; ++d) {
+                lower[d] = std::min(lower[d], centroid[d]);
+                upper[d] = std::max(upper[d], centroid[d]);
+            }
+        }
+        double extent = 0.0;
+        for (int d = 0; d < 3; ++d) {
+            extent = std::max(extent, upper[d] - lower[d]);
+        }
+        if (extent > 0.0) {
+            scale = ((1 << 21) - 1) / extent;
         }
     }
 
-    // get the distribution of wells
-    std::vector<std::pair<std::string, bool>> parallel_wells;
-    if (wells) {
-        if (allowDistributedWells) {
-            // wells can be split among several processes
-            auto wellsOnProc = Dune::cpgrid::perforatingWellIndicesOnProc(gIDtoRank, *wells, possibleFutureConnections, grid);
-            parallel_wells = Dune::cpgrid::computeParallelWells(wellsOnProc, *wells, cc, root);
+    std::vector<std::uint64_t> keys(numCells);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < numCells; ++i) {
+        std::array<std::uint32_t, 3> coords;
+        if (useIJK) {
+            std::array<int, 3> ijk;
+            grid.getIJK(cells[i], ijk);
+            std::ranges::copy(ijk, coords.begin());
         } else {
-            // each well is guaranteed to be on a single process
-            auto wellRanks = getWellRanks(gIDtoRank, wellConnections);
-            parallel_wells = wellsOnThisRank(*wells, wellRanks, cc, root);
+            const auto& centroid = grid.cellCentroid(cells[i]);
+            for (int d = 0; d < 3; ++d) {
+                coords[d] = static_cast<std::uint32_t>((centroid[d] - lower[d]) * scale);
+            }
         }
+        keys[i] = morton ? Impl::mortonKey(coords) : Impl::hilbertKey(coords);
     }
+    return keys;
+}
+/// \brief Group the cells that have to end up on the same rank
+///
+/// The cells of each well, and the given number of layers of face
+/// neighbours around it, are merged into one group. Wells that touch
+/// after adding a layer are merged as well, like GraphOfGrid::addWell
+/// does, but without building the edges of the graph. Each cell is
+/// mapped to the smallest cell of its group.
+std::vector<int> wellGroups(const Dune::CpGrid& grid,
+                            const Dune::cpgrid::WellConnections& wellConnections,
+                            int layers)
+{
+    const int numCells = grid.numCells();
+    std::vector<int> group(numCells);
+    std::iota(group.begin(), group.end(), 0);
+    auto find = [&group](int cell) {
+        while (group[cell] != cell) {
+            group[cell] = group[group[cell]];
+            cell = group[cell];
+        }
+        return cell;
+    };
+    // the smaller cell stays the representative of the merged group
+    auto unite = [&group, &find](int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a != b) {
+            group[std::max(a, b)] = std::min(a, b);
+        }
+    };
 
-    return std::make_tuple(std::move(gIDtoRank),
-                           std::move(parallel_wells),
-                           std::move(myExportList),
-                           std::move(myImportList),
-                           std::move(wellConnections));
+    std::vector<char> inWell(numCells, false);
+    std::vector<int> wellCells;
+    for (const auto& well : wellConnections) {
+        for (const int cell : well) {
+            unite(*well.begin(), cell);
+            if (!inWell[cell]) {
+                inWell[cell] = true;
+                wellCells.push_back(cell);
+            }
+        }
+    }
+
+    std::vector<std::pair<int, int>> layer;
+    for (int l = 0; l < layers; ++l) {
+        // collect the whole layer first, such that a layer only grows by one cell
+        layer.clear();
+        for (const int cell : wellCells) {
+            for (int f = 0; f < grid.numCellFaces(cell); ++f) {
+                const int face = grid.cellFace(cell, f);
+                for (int side = 0; side < 2; ++side) {
+                    const int other = grid.faceCell(face, side);
+                    if (other != -1 && other != cell) {
+                        layer.emplace_back(cell, other);
+                    }
+                }
+            }
+        }
+        for (const auto& [cell, other] : layer) {
+            unite(cell, other);
+            if (!inWell[other]) {
+                inWell[other] = true;
+                wellCells.push_back(other);
+            }
+        }
+    }
+
+    for (int cell = 0; cell < numCells; ++cell) {
+        group[cell] = find(cell);
+    }
+    return group;
+}
+} // end anonymous namespace
+
+std::tuple<std::vector<int>,
+           std::vector<std::pair<std::string, bool>>,
+           std::vector<std::tuple<int,int,char> >,
+           std::vector<std::tuple<int,int,char,int> >,
+           Dune::cpgrid::WellConnections>
+spaceFillingCurvePartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
+                                             const std::vector<Dune::cpgrid::OpmWellType> * wells,
+                                             const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                             const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                             int root,
+                                             bool allowDistributedWells,
+                                             const std::map<std::string, std::string>& params)
+{
+    bool morton = false;
+    bool useIJK = false;
+    int layers = 0; // extra layers of cells attached to wells to distance them from boundary
+    for (const auto& [key, value] : params)
+    {
+        if (key == "SFC_CURVE") {
+            if (value != "HILBERT" && value != "MORTON") {
+                OPM_THROW(std::invalid_argument, "Unknown space-filling curve " + value);
+            }
+            morton = value == "MORTON";
+        } else if (key == "SFC_COORDINATES") {
+            if (value != "CENTROID" && value != "IJK") {
+                OPM_THROW(std::invalid_argument, "Unknown space-filling curve coordinates " + value);
+            }
+            useIJK = value == "IJK";
+        } else if (key == "EnvelopeWellLayers") {
+            layers = std::stoi(value);
+        }
+    }
+
+    // root process has the whole grid, other ranks nothing
+    bool partitionIsEmpty = cc.rank()!=root;
+
+    auto wellConnections = partitionIsEmpty || !wells ? Dune::cpgrid::WellConnections()
+                                                      : Dune::cpgrid::WellConnections(*wells, possibleFutureConnections, grid);
+
+    // The curve is ordered and cut on root, where all cells are. Sending it to
+    // the other ranks to cut it there would cost more than the cut itself.
+    std::vector<int> gIDtoRank;
+    if (!partitionIsEmpty) {
+        // skip cell contraction if wells can be distributed over multiple processes
+        const auto group = allowDistributedWells ? wellGroups(grid, Dune::cpgrid::WellConnections(), 0)
+                                                 : wellGroups(grid, wellConnections, layers);
+        // a group is placed on the curve at its smallest cell and weighs as many cells as it has
+        std::vector<int> gIDs;
+        std::vector<float> groupWeight(grid.numCells(), 0.f);
+        for (int cell = 0; cell < grid.numCells(); ++cell) {
+            if (group[cell] == cell) {
+                gIDs.push_back(cell);
+            }
+            groupWeight[group[cell]] += 1.f;
+        }
+        const auto keys = curveKeys(grid, gIDs, morton, useIJK);
+        std::vector<std::pair<std::uint64_t, int>> order(gIDs.size());
+        for (std::size_t i = 0; i < gIDs.size(); ++i) {
+            order[i] = {keys[i], gIDs[i]};
+        }
+        std::ranges::sort(order);
+
+        std::vector<float> weights;
+        weights.reserve(order.size());
+        for (const auto& entry : order) {
+            weights.push_back(groupWeight[entry.second]);
+        }
+        const auto parts = Impl::cutCurve(weights, cc.size(),
+                                          Dune::cpgrid::CpGridDataTraits::Communication(MPI_COMM_SELF));
+        std::vector<int> groupRank(grid.numCells(), root);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            groupRank[order[i].second] = parts[i];
+        }
+        gIDtoRank.resize(grid.numCells());
+        for (int cell = 0; cell < grid.numCells(); ++cell) {
+            gIDtoRank[cell] = groupRank[group[cell]];
+        }
+    }
+    return makeListsFromGIDtoRank(grid,
+                                  std::move(gIDtoRank),
+                                  wells,
+                                  possibleFutureConnections,
+                                  std::move(wellConnections),
+                                  cc,
+                                  root,
+                                  allowDistributedWells);
 }
 #endif // HAVE_MPI
 
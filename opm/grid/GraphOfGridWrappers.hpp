@@ -32,6 +32,11 @@
 #include <opm/grid/common/WellConnections.hpp>
 #include <opm/grid/common/ZoltanGraphFunctions.hpp> // defines Zoltan and null-callback-functions
 
+#include <array>
+#include <cstdint>
+#include <list>
+#include <set>
+
 namespace Opm {
 /*
   This file contains wrappers for GraphOfGrid that satisfy interface
@@ -131,6 +136,13 @@ void extendGIDtoRank(const GraphOfGrid<Dune::CpGrid>& gog,
                      std::vector<int>& gIDtoRank,
                      const int& root = -1);
 
+/// \brief Correct gIDtoRank's data about well cells, given the contracted wells
+///
+/// Same as above, for use when the graph itself is not available anymore.
+void extendGIDtoRank(const std::list<std::set<int>>& wells,
+                     std::vector<int>& gIDtoRank,
+                     const int& root = -1);
+
 #if HAVE_MPI
 namespace Impl{
 /// \brief Add cells to the import list and sort it
@@ -198,6 +210,20 @@ void extendAndSortExportAndImportLists(const GraphOfGrid<Dune::CpGrid>& gog,
 std::vector<int> getWellRanks(const std::vector<int>& gIDtoRank,
                               const Dune::cpgrid::WellConnections& wellConnections);
 
+namespace Impl{
+/// \brief Position of a lattice point along the 3D Morton (Z-order) curve
+///
+/// Interleaves the bits of the coordinates. Only the lowest 21 bits
+/// of each coordinate are used.
+std::uint64_t mortonKey(std::array<std::uint32_t,3> coords);
+
+/// \brief Position of a lattice point along the 3D Hilbert curve
+///
+/// Only the lowest 21 bits of each coordinate are used. In contrast to
+/// the Morton curve, points with consecutive keys are face neighbors.
+std::uint64_t hilbertKey(std::array<std::uint32_t,3> coords);
+} // end namespace Impl
+
 #if HAVE_MPI
 /// \brief Get rank-specific information about which wells are present
 ///
@@ -274,6 +300,84 @@ zoltanPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
                                   const std::map<std::string,std::string>& params,
                                   int level);
 
+namespace Impl{
+/// \brief Part of a GraphOfGrid stored on one rank
+///
+/// The vertices are a contiguous range of the sorted vertex IDs of the
+/// graph. Edges are stored in compressed row format, i.e. the edges of
+/// the i-th vertex are stored at [edgeOffsets[i], edgeOffsets[i+1]).
+/// For each edge, the rank holding the neighboring vertex is stored.
+struct GraphOfGridBlock
+{
+    std::vector<int> gIDs;
+    std::vector<float> weights;
+    std::vector<int> edgeOffsets{0};
+    std::vector<int> nborGIDs;
+    std::vector<int> nborRanks;
+    std::vector<float> edgeWeights;
+
+    int size() const
+    {
+        return gIDs.size();
+    }
+};
+
+/// \brief Split the graph on root into contiguous blocks and send one to each rank
+///
+/// Vertices are sorted by their global ID and split into blocks of
+/// (nearly) equal numbers of vertices. Vertices representing contracted
+/// wells stay whole, hence wells end up on a single rank.
+/// Only root's graph is read, other ranks are expected to have an empty graph.
+/// Root builds and sends the blocks one after another, so besides the graph
+/// it holds at most one block of another rank at a time.
+/// \return The block of this rank.
+GraphOfGridBlock scatterGraphOfGrid(const GraphOfGrid<Dune::CpGrid>& gog,
+                                    const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                    int root);
+
+/// \brief Collect the parts of all blocks on root
+///
+/// \param wells The contracted wells of the graph on root, ignored on other ranks
+/// \param block This rank's block as returned by scatterGraphOfGrid
+/// \param parts For each vertex of block the rank it is assigned to
+/// \param numCells Number of cells of the grid
+/// \return On root, a vector indexed by global ID storing the rank of each
+///         cell, including contracted well cells. Empty on other ranks.
+std::vector<int> gatherGraphOfGridParts(const std::list<std::set<int>>& wells,
+                                        const GraphOfGridBlock& block,
+                                        const std::vector<int>& parts,
+                                        int numCells,
+                                        const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                        int root);
+} // end namespace Impl
+
+/// \brief Call Zoltan partitioner on GraphOfGrid distributed over all ranks
+///
+/// In contrast to zoltanPartitioningWithGraphOfGrid, where the whole graph
+/// stays on root while Zoltan runs on all ranks, root sends contiguous
+/// blocks of the graph to all ranks before Zoltan is called. Hence, the
+/// partitioner's work and memory are spread over the ranks.
+/// As the unpartitioned grid only exists on root, root still assembles the
+/// graph, but releases it before partitioning and keeps only its own block
+/// and the list of contracted wells.
+/// GraphOfGrid represents a well by one vertex, so wells can not be
+/// spread over several processes. If allowDistributedWells is true,
+/// wells are not contracted.
+std::tuple<std::vector<int>, std::vector<std::pair<std::string, bool>>,
+           std::vector<std::tuple<int,int,char> >,
+           std::vector<std::tuple<int,int,char,int> >,
+           Dune::cpgrid::WellConnections>
+zoltanDistributedPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
+                                             const std::vector<Dune::cpgrid::OpmWellType> * wells,
+                                             const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                             const double* transmissibilities,
+                                             const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                             Dune::EdgeWeightMethod edgeWeightMethod,
+                                             int root,
+                                             const double zoltanImbalanceTol,
+                                             bool allowDistributedWells,
+                                             const std::map<std::string,std::string>& params);
+
 /// \brief Make complete export lists from a vector holding destination rank for each global ID
 ///
 /// Intended to use on the root, as other ranks can not construct gIDtoRank.
@@ -302,6 +406,46 @@ zoltanSerialPartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
                                         const double zoltanImbalanceTol,
                                         bool allowDistributedWells,
                                         const std::map<std::string,std::string>& params);
+
+namespace Impl{
+/// \brief Cut a curve into pieces of (nearly) equal weight
+///
+/// The vertices of the curve are stored in contiguous blocks ordered by
+/// rank. Each rank only needs the prefix sum of the weights of the lower
+/// ranks, hence the cut is computed in parallel. With a communicator of
+/// a single rank, the whole curve is cut on that rank.
+/// \param weights The weights of the vertices of this rank's block
+/// \param numParts The number of pieces
+/// \return For each vertex of the block the piece it belongs to
+std::vector<int> cutCurve(const std::vector<float>& weights,
+                          int numParts,
+                          const Dune::cpgrid::CpGridDataTraits::Communication& cc);
+} // end namespace Impl
+
+/// \brief Partition GraphOfGrid along a space-filling curve
+///
+/// Root orders the cells along a 3D Hilbert or Morton curve through the
+/// cell centroids or the logical Cartesian (IJK) coordinates, and cuts
+/// the curve into pieces of equal number of cells, one per rank. Neither
+/// the edges of the graph nor a graph partitioner are used, which makes
+/// this much faster than Zoltan at the price of a larger edge-cut. Unless
+/// allowDistributedWells is true, the cells of a well and its envelope
+/// are kept together at the position of the well's smallest cell and end
+/// up on a single rank.
+/// Supported params are "SFC_CURVE" (HILBERT or MORTON, default HILBERT),
+/// "SFC_COORDINATES" (CENTROID or IJK, default CENTROID) and
+/// "EnvelopeWellLayers". Other params are ignored.
+std::tuple<std::vector<int>, std::vector<std::pair<std::string, bool>>,
+           std::vector<std::tuple<int,int,char> >,
+           std::vector<std::tuple<int,int,char,int> >,
+           Dune::cpgrid::WellConnections>
+spaceFillingCurvePartitioningWithGraphOfGrid(const Dune::CpGrid& grid,
+                                             const std::vector<Dune::cpgrid::OpmWellType> * wells,
+                                             const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                             const Dune::cpgrid::CpGridDataTraits::Communication& cc,
+                                             int root,
+                                             bool allowDistributedWells,
+                                             const std::map<std::string,std::string>& params);
 #endif // HAVE_MPI
 
 } // end namespace Opm
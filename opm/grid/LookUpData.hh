@@ -39,9 +39,13 @@
 #include <opm/grid/common/CartesianIndexMapper.hpp>
 #include <opm/grid/cpgrid/Entity.hpp>
 
+#include <opm/common/ErrorMacros.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -70,11 +74,25 @@ public:
     ///                                      true (search field property in refined grid; LGR-id/level required)
     ///                                      Currently, isFieldPropInLgr_ == false means that all the field
     ///                                      properties are given in the unrefined grid (level 0).
+    ///
+    /// For CpGrid, the field property index of each leaf cell is computed here. The object has to be
+    /// constructed again after the leaf grid view changed, e.g. by adapt() or loadBalance(). Lookups
+    /// by leaf index throw a std::logic_error otherwise.
     explicit LookUpData(const GridView& gridView, bool isFieldPropInLgr = false) :
         gridView_(gridView),
         elemMapper_(gridView, Dune::mcmgElementLayout()),
         isFieldPropInLgr_(isFieldPropInLgr)
     {
+        if constexpr (std::is_same_v<Grid, Dune::CpGrid>) {
+            // Origin or LGR index of each leaf cell, computed once and shared by all field properties.
+            const int numElements = gridView_.size(0);
+            leafData_ = &gridView_.grid().currentLeafData();
+            fieldPropIdxOnLeaf_.resize(numElements);
+            for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+                const auto& elem = Dune::cpgrid::Entity<0>(gridView_.grid().currentLeafData(), elemIdx, true);
+                fieldPropIdxOnLeaf_[elemIdx] = this->getFieldPropIdx<Grid>(elem);
+            }
+        }
     }
 
     /// \brief: Get field propertry for an element or index in the leaf grid view, from a vector and element index.
@@ -102,7 +120,25 @@ public:
                                                    const bool& needsTranslation,
                                                    std::function<void(IntType, int)> valueCheck = [](IntType, int){}) const;
 
+    /// \brief: Get several field properties of type double from field properties manager by name.
+    ///
+    ///         All properties are gathered with the same leaf cell -> field property index table,
+    ///         one pass over the leaf cells per property. Returns one vector per entry of propStrings.
+    std::vector<std::vector<double>> assignMultipleFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                          const std::vector<std::string>& propStrings) const;
+
+    /// \brief: Get several field properties of type int from field properties manager by name.
+    ///
+    ///         needsTranslation[i] tells whether propStrings[i] gets translated (value - 1), e.g. for SATNUM.
+    template<typename IntType>
+    std::vector<std::vector<IntType>> assignMultipleFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                        const std::vector<std::string>& propStrings,
+                                                                        const std::vector<bool>& needsTranslation) const;
+
     /// \brief: Get property of type double from field properties manager by name, via element or its index.
+    ///
+    ///         Looks up the property by name in each call. Use assignFieldPropsDoubleOnLeaf() or
+    ///         assignMultipleFieldPropsDoubleOnLeaf() to get the values of all leaf cells.
     template<typename ElemOrIndex>
     double fieldPropDouble(const FieldPropsManager& fieldPropsManager,
                            const std::string& propString,
@@ -158,6 +194,10 @@ protected:
     const GridView& gridView_;
     Dune::MultipleCodimMultipleGeomTypeMapper<GridView> elemMapper_;
     bool isFieldPropInLgr_;
+    /// Only for CpGrid: index used for retrieving field properties of each leaf cell.
+    std::vector<int> fieldPropIdxOnLeaf_;
+    /// Only for CpGrid: the leaf grid data that fieldPropIdxOnLeaf_ was computed for.
+    const Dune::cpgrid::CpGridData* leafData_ = nullptr;
 }; // end LookUpData class
 
 /// LookUpCartesianData - To search field properties of leaf grid view elements via CartesianIndex (cartesianMapper)
@@ -178,6 +218,10 @@ public:
     ///                                    true (search field property in refined grid; LGR-id/level required)
     ///                                    Currently, isFieldPropInLgr_ == false means that all the field
     ///                                    properties are given in the unrefined grid (level 0).
+    ///
+    /// For CpGrid, the Cartesian index of each leaf cell is computed here. The object has to be
+    /// constructed again after the leaf grid view changed, e.g. by adapt() or loadBalance(). Lookups
+    /// by leaf index throw a std::logic_error otherwise.
     explicit LookUpCartesianData(const GridView& gridView,
                                  const Dune::CartesianIndexMapper<Grid>& mapper,
                                  bool isFieldPropInLgr = false) :
@@ -186,6 +230,16 @@ public:
         cartMapper_(&mapper),
         isFieldPropInLgr_(isFieldPropInLgr)
     {
+        if constexpr (std::is_same_v<Grid, Dune::CpGrid>) {
+            // Cartesian index of the origin or LGR cell of each leaf cell, computed once and shared by all field properties.
+            const int numElements = gridView_.size(0);
+            leafData_ = &gridView_.grid().currentLeafData();
+            fieldPropCartesianIdxOnLeaf_.resize(numElements);
+            for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+                const auto& elem = Dune::cpgrid::Entity<0>(gridView_.grid().currentLeafData(), elemIdx, true);
+                fieldPropCartesianIdxOnLeaf_[elemIdx] = this->getFieldPropCartesianIdx<Grid>(elem);
+            }
+        }
     }
 
     /// \brief: Get field property for an element in the leaf grid view, from a vector, via Cartesian Index.
@@ -211,7 +265,25 @@ public:
                                                    const bool& needsTranslation,
                                                    std::function<void(IntType, int)> valueCheck = [](IntType, int){}) const;
 
+    /// \brief: Get several field properties of type double from field properties manager by name.
+    ///
+    ///         All properties are gathered with the same leaf cell -> Cartesian index table,
+    ///         one pass over the leaf cells per property. Returns one vector per entry of propStrings.
+    std::vector<std::vector<double>> assignMultipleFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                          const std::vector<std::string>& propStrings) const;
+
+    /// \brief: Get several field properties of type int from field properties manager by name.
+    ///
+    ///         needsTranslation[i] tells whether propStrings[i] gets translated (value - 1), e.g. for SATNUM.
+    template<typename IntType>
+    std::vector<std::vector<IntType>> assignMultipleFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                        const std::vector<std::string>& propStrings,
+                                                                        const std::vector<bool>& needsTranslation) const;
+
     /// \brief: Get property of type double from field properties manager by name, via element or its index.
+    ///
+    ///         Looks up the property by name in each call. Use assignFieldPropsDoubleOnLeaf() or
+    ///         assignMultipleFieldPropsDoubleOnLeaf() to get the values of all leaf cells.
     template<typename ElemOrIndex>
     double fieldPropDouble(const FieldPropsManager& fieldPropsManager,
                            const std::string& propString,
@@ -272,6 +344,10 @@ protected:
     Dune::MultipleCodimMultipleGeomTypeMapper<GridView> elemMapper_;
     const Dune::CartesianIndexMapper<Grid>* cartMapper_;
     bool isFieldPropInLgr_;
+    /// Only for CpGrid: Cartesian index used for retrieving field properties of each leaf cell.
+    std::vector<int> fieldPropCartesianIdxOnLeaf_;
+    /// Only for CpGrid: the leaf grid data that fieldPropCartesianIdxOnLeaf_ was computed for.
+    const Dune::cpgrid::CpGridData* leafData_ = nullptr;
 }; // end LookUpCartesianData class
 }
 // end namespace Opm
@@ -345,6 +421,51 @@ std::vector<IntType> Opm::LookUpData<Grid,GridView>::assignFieldPropsIntOnLeaf(c
     return fieldPropOnLeaf;
 }
 
+template<typename Grid, typename GridView>
+std::vector<std::vector<double>>
+Opm::LookUpData<Grid,GridView>::assignMultipleFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                     const std::vector<std::string>& propStrings) const
+{
+    std::vector<std::vector<double>> fieldPropsOnLeaf(propStrings.size());
+    const int numElements = gridView_.size(0);
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        if ( (propStrings[prop] == "PORV") && (gridView_.grid().maxLevel() > 0)) {
+            // Pore volume of refined cells is scaled by the cell volumes, see assignFieldPropsDoubleOnLeaf().
+            fieldPropsOnLeaf[prop] = this->assignFieldPropsDoubleOnLeaf(fieldPropsManager, propStrings[prop]);
+            continue;
+        }
+        const auto& fieldProp = fieldPropsManager.get_double(propStrings[prop]);
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            fieldPropOnLeaf[elemIdx] = fieldProp[this->getFieldPropIdx<Grid>(elemIdx)];
+        }
+    }
+    return fieldPropsOnLeaf;
+}
+
+template<typename Grid, typename GridView>
+template<typename IntType>
+std::vector<std::vector<IntType>>
+Opm::LookUpData<Grid,GridView>::assignMultipleFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                  const std::vector<std::string>& propStrings,
+                                                                  const std::vector<bool>& needsTranslation) const
+{
+    assert(propStrings.size() == needsTranslation.size());
+    std::vector<std::vector<IntType>> fieldPropsOnLeaf(propStrings.size());
+    const int numElements = gridView_.size(0);
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        const auto& fieldProp = fieldPropsManager.get_int(propStrings[prop]);
+        const int translation = needsTranslation[prop];
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            fieldPropOnLeaf[elemIdx] = fieldProp[this->getFieldPropIdx<Grid>(elemIdx)] - translation;
+        }
+    }
+    return fieldPropsOnLeaf;
+}
+
 template<typename Grid, typename GridView>
 template<typename ElemOrIndex>
 double Opm::LookUpData<Grid,GridView>::fieldPropDouble(const FieldPropsManager& fieldPropsManager,
@@ -379,14 +500,12 @@ auto Opm::LookUpData<Grid,GridView>::getFieldPropIdx(const IndexType& elementOrI
     if constexpr (std::is_same_v<GridType, Dune::CpGrid>) {
         static_assert(std::is_same_v<Grid,GridType>);
         if constexpr (isIntegral) {
-            const auto& elem = Dune::cpgrid::Entity<0>(gridView_.grid().currentLeafData(), elementOrIndex, true);
-            if (isFieldPropInLgr_ && elem.level()) { // level > 0 == true ; level == 0 == false
-                // In case some LGRs do not have refined field properties, the next line need to be modified.
-                return elem.getLevelElem().index();
-            }
-            else {
-                return elem.getOrigin().index();
+            if (leafData_ != &gridView_.grid().currentLeafData() ||
+                static_cast<std::size_t>(elementOrIndex) >= fieldPropIdxOnLeaf_.size()) {
+                OPM_THROW(std::logic_error, "LookUpData was constructed for another leaf grid view. "
+                          "Construct it again after the grid changed.");
             }
+            return fieldPropIdxOnLeaf_[elementOrIndex];
         } else {
             static_assert(std::is_same_v<IndexType, Dune::cpgrid::Entity<0>>);
             if (isFieldPropInLgr_ && elementOrIndex.level()) { // level > 0 == true ; level == 0 == false
@@ -458,6 +577,46 @@ std::vector<IntType> Opm::LookUpCartesianData<Grid,GridView>::assignFieldPropsIn
     return fieldPropOnLeaf;
 }
 
+template<typename Grid, typename GridView>
+std::vector<std::vector<double>>
+Opm::LookUpCartesianData<Grid,GridView>::assignMultipleFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                     const std::vector<std::string>& propStrings) const
+{
+    std::vector<std::vector<double>> fieldPropsOnLeaf(propStrings.size());
+    const int numElements = gridView_.size(0);
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        const auto& fieldProp = fieldPropsManager.get_double(propStrings[prop]);
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            fieldPropOnLeaf[elemIdx] = fieldProp[this->getFieldPropCartesianIdx<Grid>(elemIdx)];
+        }
+    }
+    return fieldPropsOnLeaf;
+}
+
+template<typename Grid, typename GridView>
+template<typename IntType>
+std::vector<std::vector<IntType>>
+Opm::LookUpCartesianData<Grid,GridView>::assignMultipleFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                  const std::vector<std::string>& propStrings,
+                                                                  const std::vector<bool>& needsTranslation) const
+{
+    assert(propStrings.size() == needsTranslation.size());
+    std::vector<std::vector<IntType>> fieldPropsOnLeaf(propStrings.size());
+    const int numElements = gridView_.size(0);
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        const auto& fieldProp = fieldPropsManager.get_int(propStrings[prop]);
+        const int translation = needsTranslation[prop];
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            fieldPropOnLeaf[elemIdx] = fieldProp[this->getFieldPropCartesianIdx<Grid>(elemIdx)] - translation;
+        }
+    }
+    return fieldPropsOnLeaf;
+}
+
 template<typename Grid, typename GridView>
 template<typename ElemOrIndex>
 double Opm::LookUpCartesianData<Grid,GridView>::fieldPropDouble(const FieldPropsManager& fieldPropsManager,
@@ -492,8 +651,12 @@ auto Opm::LookUpCartesianData<Grid,GridView>::getFieldPropCartesianIdx(const Ele
     if constexpr (std::is_same_v<GridType, Dune::CpGrid>) {
         static_assert(std::is_same_v<Grid,GridType>);
         if constexpr (isIntegral) {
-            const auto& elem = Dune::cpgrid::Entity<0>(gridView_.grid().currentLeafData(), elementOrIndex, true);
-            return this -> getFieldPropCartesianIdx<Dune::CpGrid>(elem);
+            if (leafData_ != &gridView_.grid().currentLeafData() ||
+                static_cast<std::size_t>(elementOrIndex) >= fieldPropCartesianIdxOnLeaf_.size()) {
+                OPM_THROW(std::logic_error, "LookUpCartesianData was constructed for another leaf grid view. "
+                          "Construct it again after the grid changed.");
+            }
+            return fieldPropCartesianIdxOnLeaf_[elementOrIndex];
         } else {
             if (isFieldPropInLgr_ && elementOrIndex.level()) { // level == 0 false; level > 0 true
                 return elementOrIndex.getLevelCartesianIdx();
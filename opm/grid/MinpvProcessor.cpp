@@ -25,15 +25,24 @@
 #include <cassert>
 #include <stdexcept>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 
 void MinpvProcessor::Result::add_nnc(int cell1, int cell2)
 {
-    auto key = std::min(cell1, cell2);
-    auto value = std::max(cell1,cell2);
+    this->nnc.emplace_back(std::min(cell1, cell2), std::max(cell1, cell2));
+}
 
-    this->nnc.insert({key, value});
+void MinpvProcessor::Result::sort_nnc()
+{
+    // Stable, such that the first NNC added for a cell is kept.
+    std::ranges::stable_sort(this->nnc, {}, &std::pair<int,int>::first);
+    const auto duplicates = std::ranges::unique(this->nnc, {}, &std::pair<int,int>::first);
+    this->nnc.erase(duplicates.begin(), duplicates.end());
 }
 
 MinpvProcessor::MinpvProcessor(const int nx, const int ny, const int nz) :
@@ -98,8 +107,6 @@ MinpvProcessor::process(const std::vector<double>& thickness,
     //    to infinity.
 
 
-    Result result;
-
     // Check for sane input sizes.
     const size_t log_size = dims_[0] * dims_[1] * dims_[2];
     if (pv.size() != log_size) {
@@ -113,9 +120,25 @@ MinpvProcessor::process(const std::vector<double>& thickness,
                   "If option 4 of PINCH keyword is ALL, then the deck needs to specify PERMZ or PERMX");
         }
 
-    // Main loop.
-    for (int jj = 0; jj < dims_[1]; ++jj) {
-        for (int ii = 0; ii < dims_[0]; ++ii) {
+    // Main loop. Columns are independent of each other, hence contiguous
+    // chunks of them are processed in parallel, each with its own result.
+    const int num_columns = dims_[0] * dims_[1];
+#ifdef _OPENMP
+    const int num_chunks = std::clamp(omp_get_max_threads(), 1, std::max(num_columns, 1));
+#else
+    const int num_chunks = 1;
+#endif
+    std::vector<Result> chunk_results(num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        auto& result = chunk_results[chunk];
+        const int first_column = static_cast<long long>(num_columns) * chunk / num_chunks;
+        const int last_column = static_cast<long long>(num_columns) * (chunk + 1) / num_chunks;
+        for (int column = first_column; column < last_column; ++column) {
+            const int ii = column % dims_[0];
+            const int jj = column / dims_[0];
             for (int kk = 0; kk < dims_[2]; ++kk) {
                 // For a corner case for option ALL
                 // where one of the cells in-between has 0 transmissibility
@@ -333,6 +356,16 @@ MinpvProcessor::process(const std::vector<double>& thickness,
         }
     }
 
+    // Merging the chunks in column order gives the result of a serial run.
+    Result result;
+    for (auto& chunk_result : chunk_results) {
+        result.removed_cells.insert(result.removed_cells.end(),
+                                    chunk_result.removed_cells.begin(),
+                                    chunk_result.removed_cells.end());
+        result.nnc.insert(result.nnc.end(), chunk_result.nnc.begin(), chunk_result.nnc.end());
+    }
+    result.sort_nnc();
+
     return result;
 }
 
@@ -23,8 +23,8 @@
 #include <array>
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace Opm
@@ -37,9 +37,14 @@ namespace Opm
 
         struct Result {
             std::vector<std::size_t> removed_cells;
-            std::map<int,int> nnc;
+            /// NNCs as pairs of (smaller cell, larger cell), sorted by and
+            /// unique in the smaller cell.
+            std::vector<std::pair<int,int>> nnc;
 
+            /// Append an NNC. Call sort_nnc() afterwards to restore the ordering.
             void add_nnc(int cell1, int cell2);
+            /// Sort the NNCs, keeping only the first one added for each smaller cell.
+            void sort_nnc();
         };
 
 
@@ -69,6 +74,8 @@ namespace Opm
         /// cell below will be changed to include the deleted volume if mergeMinPCCells is true
         /// els the volume will be lost
         /// \param[in]       tolerance_unique_points Tolerance used to identify points based on their cooridinates.
+        /// The columns of cells are processed in parallel if OpenMP is enabled, hence multZ
+        /// must be safe to call concurrently. The result does not depend on the number of threads.
         Result process(const std::vector<double>& thickness,
                        const double z_tolerance,
                        const double max_gap,
@@ -21,16 +21,10 @@
 #ifndef OPM_REPAIRZCORN_HEADER_INCLUDED
 #define OPM_REPAIRZCORN_HEADER_INCLUDED
 
-#include <algorithm>
 #include <array>
-#include <cassert>
-#include <cmath>
 #include <cstddef>
-#include <exception>
-#include <iterator>
-#include <numeric>
+#include <span>
 #include <stdexcept>
-#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -54,6 +48,28 @@
 /// for which ZCORN increases over the cell and at least one pillar for
 /// which ZCORN decreases.  This is hopefully a pathological case that does
 /// not occur in real input decks.
+///
+/// All repair operations only involve the corners of a single pillar
+/// column, whence columns are processed independently (and concurrently if
+/// OpenMP is enabled).  Only the decision of whether or not the input
+/// represents elevations needs information from the whole model.  A reader
+/// that does not hold the full ZCORN array may therefore repair the model
+/// in slabs of complete rows of pillar columns, each of which is itself a
+/// corner-point description of dimension \code NX * NJ * NZ \endcode:
+///
+/// \code
+///    auto orientation = RepairZCORN::Orientation{};
+///    for (const auto& slab : slabs) {
+///        orientation += RepairZCORN::orientation(slab.zcorn, slab.actnum, slab.dims);
+///    }
+///
+///    // Possibly combine orientation counts across processes here.
+///
+///    for (auto& slab : slabs) {
+///        stats += RepairZCORN::repairSlab(slab.zcorn, slab.actnum, slab.dims,
+///                                         orientation.isElevation());
+///    }
+/// \endcode
 
 namespace Opm { namespace UgGridHelpers {
 
@@ -62,6 +78,78 @@ namespace Opm { namespace UgGridHelpers {
     class RepairZCORN
     {
     public:
+        /// Statistics about modified ZCORN values.
+        struct ZCornChangeCount
+        {
+            /// Number of cells affected by operation.
+            std::size_t cells{0};
+
+            /// Total number of cell corners affected by operation.
+            std::size_t corners{0};
+
+            /// Accumulate statistics of another set of pillar columns.
+            ZCornChangeCount& operator+=(const ZCornChangeCount& other)
+            {
+                this->cells   += other.cells;
+                this->corners += other.corners;
+
+                return *this;
+            }
+        };
+
+        /// Classification of active cells according to whether ZCORN
+        /// increases or decreases along all of the cell's pillars.
+        ///
+        /// Twisted cells, and cells for which ZCORN does not change, are
+        /// not counted.
+        struct Orientation
+        {
+            /// Number of cells for which ZCORN does not decrease along any
+            /// of the cell's pillars.
+            std::size_t increasing{0};
+
+            /// Number of cells for which ZCORN does not increase along any
+            /// of the cell's pillars.
+            std::size_t decreasing{0};
+
+            /// Whether or not the classified ZCORN values should be
+            /// interpreted as elevations.  True if there is at least one
+            /// cell of decreasing ZCORN and no cells of increasing ZCORN.
+            bool isElevation() const
+            {
+                return (this->decreasing > 0) && (this->increasing == 0);
+            }
+
+            /// Accumulate classification of another set of pillar columns.
+            Orientation& operator+=(const Orientation& other)
+            {
+                this->increasing += other.increasing;
+                this->decreasing += other.decreasing;
+
+                return *this;
+            }
+        };
+
+        /// Statistics about ZCORN values changed in a single slab of
+        /// pillar columns.
+        struct SlabStatistics
+        {
+            /// Statistics about TBB operation.
+            ZCornChangeCount topBelowBottom;
+
+            /// Statistics about BBLT operation.
+            ZCornChangeCount bottomBelowLowerTop;
+
+            /// Accumulate statistics of another slab.
+            SlabStatistics& operator+=(const SlabStatistics& other)
+            {
+                this->topBelowBottom      += other.topBelowBottom;
+                this->bottomBelowLowerTop += other.bottomBelowLowerTop;
+
+                return *this;
+            }
+        };
+
         /// Constructor.
         ///
         /// \tparam CartDims Representation of Cartesian model dimensions.
@@ -84,24 +172,143 @@ namespace Opm { namespace UgGridHelpers {
         RepairZCORN(std::vector<double>&&   zcorn,
                     const std::vector<int>& actnum,
                     const CartDims&         cartDims)
-            : active_   (actnum, cartDims)
-            , zcorn_idx_(cartDims)
-            , zcorn_    (std::move(zcorn))
+            : zcorn_(std::move(zcorn))
         {
-            this->ensureZCornIsDepth();
-            this->ensureTopNotBelowBottom();
-            this->ensureBottomNotBelowLowerTop(cartDims[2]);
+            this->switchedToDepth_ =
+                orientation(this->zcorn_, actnum, cartDims).isElevation();
+
+            const auto stat = repairSlab(this->zcorn_, actnum, cartDims,
+                                         this->switchedToDepth_);
+
+            this->topBelowBottom_      = stat.topBelowBottom;
+            this->bottomBelowLowerTop_ = stat.bottomBelowLowerTop;
         }
 
-        /// Statistics about modified ZCORN values.
-        struct ZCornChangeCount
+        /// Classify the active cells of a slab of pillar columns according
+        /// to the direction of ZCORN change along the cells' pillars.
+        ///
+        /// Throws if the sizes of \p zcorn or \p actnum do not match the
+        /// slab's dimensions.
+        ///
+        /// \tparam CartDims Representation of Cartesian slab dimensions.
+        ///
+        /// \param[in] zcorn ZCORN values of slab, in ECLIPSE ordering
+        ///    relative to slab's dimensions.
+        ///
+        /// \param[in] actnum Explicit cell activation flag of slab.  Empty
+        ///    input treated as all cells active.
+        ///
+        /// \param[in] slabDims Cartesian dimensions of slab.  Typically the
+        ///    model's dimensions, possibly with fewer rows in Y direction.
+        ///
+        /// \return Classification of slab's active cells.  Accumulate over
+        ///    all slabs of a model before calling repairSlab().
+        template <class CartDims>
+        static Orientation orientation(std::span<const double> zcorn,
+                                       std::span<const int>    actnum,
+                                       const CartDims&         slabDims)
         {
-            /// Number of cells affected by operation.
-            std::size_t cells{0};
+            const auto slab = Slab { zcorn, actnum, slabDims };
 
-            /// Total number of cell corners affected by operation.
-            std::size_t corners{0};
-        };
+            auto increasing = std::size_t{0};
+            auto decreasing = std::size_t{0};
+
+            const auto ncol = static_cast<long>(slab.numColumns());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+:increasing,decreasing)
+#endif
+            for (long col = 0; col < ncol; ++col) {
+                for (auto k = 0*slab.nz; k < slab.nz; ++k) {
+                    const auto cell = slab.cellIdx(col, k);
+
+                    if (! slab.isActive(cell)) { continue; }
+
+                    const auto sign = slab.zcornSign(cell);
+
+                    increasing += sign > 0;
+                    decreasing += sign < 0;
+                }
+            }
+
+            return { increasing, decreasing };
+        }
+
+        /// Sanitize ZCORN values of a slab of pillar columns.
+        ///
+        /// Throws if the sizes of \p zcorn or \p actnum do not match the
+        /// slab's dimensions.
+        ///
+        /// \tparam CartDims Representation of Cartesian slab dimensions.
+        ///
+        /// \param[in,out] zcorn ZCORN values of slab, in ECLIPSE ordering
+        ///    relative to slab's dimensions.  Repaired in place.
+        ///
+        /// \param[in] actnum Explicit cell activation flag of slab.  Empty
+        ///    input treated as all cells active.
+        ///
+        /// \param[in] slabDims Cartesian dimensions of slab.
+        ///
+        /// \param[in] switchToDepth Whether or not to reverse the signs of
+        ///    all of the slab's ZCORN values before repairing them.
+        ///    Typically \code orientation.isElevation() \endcode of the
+        ///    model's accumulated orientation.
+        ///
+        /// \return Statistics about changed ZCORN values in slab.
+        template <class CartDims>
+        static SlabStatistics repairSlab(std::span<double>    zcorn,
+                                         std::span<const int> actnum,
+                                         const CartDims&      slabDims,
+                                         const bool           switchToDepth)
+        {
+            const auto slab = Slab { zcorn, actnum, slabDims };
+            double* z = zcorn.data();
+
+            auto tbbCells = std::size_t{0}, tbbCorners  = std::size_t{0};
+            auto bbltCells = std::size_t{0}, bbltCorners = std::size_t{0};
+
+            const auto ncol = static_cast<long>(slab.numColumns());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+:tbbCells,tbbCorners,bbltCells,bbltCorners)
+#endif
+            for (long col = 0; col < ncol; ++col) {
+                if (switchToDepth) {
+                    slab.negateColumn(col, z);
+                }
+
+                // Top corners of a cell are only changed by the cell
+                // itself (TBB) and by the closest active cell above it
+                // (BBLT), so a single downward sweep over the column is
+                // equivalent to applying TBB and BBLT to all cells in
+                // turn.  BBLT never changes bottom corners.
+                auto above = slab.numCells();
+                for (auto k = 0*slab.nz; k < slab.nz; ++k) {
+                    const auto cell = slab.cellIdx(col, k);
+
+                    if (! slab.isActive(cell)) { continue; }
+
+                    const auto tbb = slab.ensureTopNotBelowBottom(cell, z);
+                    tbbCells   += tbb > 0;
+                    tbbCorners += tbb;
+
+                    if (above < slab.numCells()) {
+                        const auto bblt =
+                            slab.ensureBottomNotBelowLowerTop(above, cell, z);
+
+                        bbltCells   += bblt > 0;
+                        bbltCorners += bblt;
+                    }
+
+                    above = cell;
+                }
+            }
+
+            return {
+                { tbbCells , tbbCorners  },
+                { bbltCells, bbltCorners },
+            };
+        }
 
         /// Retrieve sanitized ZCORN values.
         ///
@@ -140,178 +347,187 @@ namespace Opm { namespace UgGridHelpers {
         }
 
     private:
-        /// Simplified mapping of model cells that are not explicitly
-        /// deactivated.
+        /// Index arithmetic of a (slab of a) corner-point model.
         ///
-        /// Linear cell IDs are relative to global (uncompressed) cell
-        /// numbering.
-        class ActiveCells
+        /// Refers directly to the caller's ACTNUM array rather than
+        /// creating a separate list of active cells.  Linear cell IDs are
+        /// relative to the slab's global (uncompressed) cell numbering.
+        class Slab
         {
         public:
             /// Constructor.
             ///
-            /// Throws if size of activation flag array does not match model
-            /// dimension.
+            /// Throws if size of activation flag array or ZCORN array does
+            /// not match slab dimension.
             ///
-            /// \tparam CartDims Representation of Cartesian model
-            ///     dimensions.  Must support \code operator[]() \endcode.
-            ///     Typically \code std::vector<int> \endcode or \code
-            ///     std::array<int, 3> \endcode or similar (e.g., \code
-            ///     std::array<std::size_t, 3> \endcode).
+            /// \param[in] zcorn ZCORN values of slab.  Only used for
+            ///    reading.  Must hold eight values per cell.
             ///
             /// \param[in] actnum Explicit cell activation flag.  Empty
-            ///    input treated as all cells active, otherwise standard ECL
-            ///    \c ACTNUM array.
+            ///    input treated as all cells active.
             ///
-            /// \param[in] cartDims Model's Cartesian dimensions.  Must have
+            /// \param[in] cartDims Slab's Cartesian dimensions.  Must have
             ///    at least three elements.
             template <class CartDims>
-            ActiveCells(const std::vector<int>& actnum,
-                        const CartDims&         cartDims)
-                : nx_(cartDims[0])
-                , ny_(cartDims[1])
-                , nz_(cartDims[2])
+            Slab(const std::span<const double> zcorn,
+                 const std::span<const int>    actnum,
+                 const CartDims&            cartDims)
+                : nx(cartDims[0])
+                , ny(cartDims[1])
+                , nz(cartDims[2])
+                , layerOffset_((2 * nx) * (2 * ny))
+                , zcorn_      (zcorn.data())
+                , actnum_     (actnum)
             {
-                const auto nglob = nx_ * ny_ * nz_;
-
-                if (actnum.empty()) {
-                    this->is_active_.resize(nglob, true);
-                    this->acells_   .resize(nglob, 0);
-
-                    std::iota(std::begin(this->acells_),
-                              std::end  (this->acells_), 0);
-                }
-                else if (actnum.size() == nglob) {
-                    this->is_active_.resize(nglob, false);
-                    this->acells_   .reserve(nglob);
-
-                    for (auto i = 0*nglob; i < nglob; ++i) {
-                        if (actnum[i] != 0) {
-                            this->acells_.push_back(i);
-                            this->is_active_[i] = true;
-                        }
-                    }
+                if (zcorn.size() != 8 * this->numCells()) {
+                    throw std::invalid_argument {
+                        "ZCORN vector does not match global size"
+                    };
                 }
-                else {
+
+                if (! actnum.empty() && (actnum.size() != this->numCells())) {
                     throw std::invalid_argument {
                         "ACTNUM vector does not match global size"
                     };
                 }
             }
 
-            /// Representation of Cartesian cell position.
-            using IndexTuple = std::array<std::size_t, 3>;
+            /// Number of cells in slab's X direction.
+            const std::size_t nx;
 
-            /// Retrieve cell position (\code (I, J, K) \endcode tuple) in
-            /// global grid.
-            ///
-            /// \param[in] globCell Global cell ID of particular cell.
-            ///
-            /// \return Cartesian index position of \p globCell.
-            IndexTuple getCellIJK(const std::size_t globCell) const
-            {
-                auto c = globCell;
+            /// Number of cells in slab's Y direction.
+            const std::size_t ny;
 
-                auto i = c % nx_;  c /= nx_;
-                auto j = c % ny_;  c /= ny_;
-                auto k = c % nz_;
+            /// Number of cells in slab's Z direction.
+            const std::size_t nz;
 
-                return {{ i, j, k }};
+            /// Retrieve total number of uncompressed cells in slab.
+            std::size_t numCells() const
+            {
+                return this->nx * this->ny * this->nz;
             }
 
-            /// Retrieve global IDs of model's explicitly active cells.
-            const std::vector<std::size_t>& activeGlobal() const
+            /// Retrieve number of pillar columns in slab.
+            std::size_t numColumns() const
             {
-                return this->acells_;
+                return this->nx * this->ny;
             }
 
-            /// Retrieve total number of uncompressed cells in model.
-            std::size_t numGlobalCells() const
+            /// Global ID of cell in particular layer of pillar column.
+            ///
+            /// \param[in] col Linear index, \code i + nx*j \endcode, of
+            ///    pillar column.
+            ///
+            /// \param[in] k Layer index.
+            std::size_t cellIdx(const long col, const std::size_t k) const
             {
-                return this->nx_ * this->ny_ * this->nz_;
+                return static_cast<std::size_t>(col) + this->numColumns()*k;
             }
 
-            /// Retrieve global ID of cell immediately below particular
-            /// cell.
-            ///
-            /// Assumes that lateral cell positions are valid.
+            /// Whether or not cell is explicitly deactivated.
+            bool isActive(const std::size_t cell) const
+            {
+                return this->actnum_.empty() || (this->actnum_[cell] != 0);
+            }
+
+            /// Retrieve sign of single cell's ZCORN change.
             ///
-            /// \param[in] ijk Cartesian index position of single cell.
+            /// \param[in] cell Global ID of particular cell.
             ///
-            /// \return Global ID of cell immediately below \p ijk.  If no
-            ///    such cell exists, e.g., because the input cell is in the
-            ///    bottom layer of the model or all cells below it are
-            ///    explicitly deactivated, then function neighbourBelow()
-            ///    returns \code >= numGlobalCells() \endcode.
-            std::size_t neighbourBelow(IndexTuple ijk) const
+            /// \return Sign of \p cell's ZCORN change.  Positive (+1) if
+            ///    ZCORN does not *DECREASE* along any of the cell's
+            ///    pillars, zero (0) if ZCORN increases along some of the
+            ///    pillars and decreases along others (or does not change
+            ///    along the cell's first pillar), and negative (-1) if ZCORN
+            ///    does not *INCREASE* along any of the cell's pillars.
+            int zcornSign(const std::size_t cell) const
             {
-                if (ijk[2] >= nz_ - 1) {
-                    return -1;
-                }
+                auto front = 0, sign = 0;
+                auto isFront = true;
 
-                ijk[2] += 1;
+                for (const auto& pt : this->pillarPoints(cell)) {
+                    const auto dz =
+                        this->zcorn_[pt.bottom] - this->zcorn_[pt.top];
 
-                auto below = this->globalCellIdx(ijk);
-                while ((below < this->numGlobalCells()) &&
-                       (! this->is_active_[below]))
-                {
-                    ijk[2] += 1;
+                    const int s = (dz > 0.0) - (dz < 0.0);
+
+                    if (isFront) { front = s;  isFront = false; }
+
+                    if (s == 0) { continue; }
 
-                    below = this->globalCellIdx(ijk);
+                    if ((sign != 0) && (s != sign)) {
+                        return 0;  // Twisted cell.
+                    }
+
+                    sign = s;
                 }
 
-                return below;
+                return front;
             }
 
-        private:
-            /// Number of cells in model's X direction.
-            const std::size_t nx_;
+            /// Reverse signs of all ZCORN values of a pillar column,
+            /// including those of deactivated cells.
+            void negateColumn(const long col, double* z) const
+            {
+                for (auto k = 0*this->nz; k < this->nz; ++k) {
+                    for (const auto& pt : this->pillarPoints(this->cellIdx(col, k))) {
+                        z[pt.top]    = - z[pt.top];
+                        z[pt.bottom] = - z[pt.bottom];
+                    }
+                }
+            }
 
-            /// Number of cells in model's Y direction.
-            const std::size_t ny_;
+            /// Ensure cell's top corners are not below its bottom corners.
+            ///
+            /// \return Number of changed corners.
+            std::size_t ensureTopNotBelowBottom(const std::size_t cell,
+                                                double*           z) const
+            {
+                auto corners = std::size_t{0};
 
-            /// Number of cells in model's Z direction.
-            const std::size_t nz_;
+                for (const auto& pt : this->pillarPoints(cell)) {
+                    const auto zb = z[pt.bottom];
+                    auto&      zt = z[pt.top];
 
-            /// Predicate for whether or not a particular global cell is
-            /// active (stores the result of \code ACTNUM != 0 \endcode for
-            /// all global cells.
-            std::vector<bool> is_active_;
+                    if (zt > zb) {  // Top below bottom (ZCORN is depth)
+                        zt = zb;
 
-            /// Global IDs of all of the model's active cells.
-            std::vector<std::size_t> acells_;
+                        corners += 1;
+                    }
+                }
 
-            /// Translate Cartesian cell position to global cell ID.
-            ///
-            /// \param[in] Cartesian cell position.  Lateral positions (I,J)
-            ///    assumed to be in valid range \code [0 .. nx_-1] \endcode
-            ///    and \code [0 .. ny-1] \endcode respectively.
+                return corners;
+            }
+
+            /// Ensure cell's bottom corners are not below the top corners
+            /// of the closest active cell beneath it.
             ///
-            /// \return global cell ID of cell \p ijk.  If no such cell
-            ///    exists, returns \code >= numGlobalCells() \endcode.
-            std::size_t globalCellIdx(const IndexTuple& ijk) const
+            /// \return Number of changed corners.
+            std::size_t ensureBottomNotBelowLowerTop(const std::size_t upper,
+                                                     const std::size_t lower,
+                                                     double*           z) const
             {
-                if (ijk[2] > nz_ - 1) { return -1; }
+                auto corners = std::size_t{0};
+
+                const auto up   = this->pillarPoints(upper);
+                const auto down = this->pillarPoints(lower);
+
+                for (auto n = up.size(), i = 0*n; i < n; ++i) {
+                    const auto zbu = z[up  [i].bottom];
+                    auto&      ztd = z[down[i].top];
+
+                    if (zbu > ztd) { // Bottom below lower top (ZCORN is depth)
+                        ztd = zbu;
 
-                return ijk[0] + nx_*(ijk[1] + ny_*ijk[2]);
+                        corners += 1;
+                    }
+                }
+
+                return corners;
             }
-        };
 
-        /// Layer of indirection to simplify extracting appropriate subsets
-        /// of global ZCORN array.
-        class ZCornIndex
-        {
-        public:
-            /// Constructor
-            template <class CartDims>
-            explicit ZCornIndex(const CartDims& cartDims)
-                : nx_         (cartDims[0])
-                , ny_         (cartDims[1])
-                , nz_         (cartDims[2])
-                , layerOffset_((2 * nx_) * (2 * ny_))
-            {}
-
-            /// Linear indices into global ZCORN array of cell's corners on
+        private:
+            /// Linear indices into ZCORN array of cell's corners on
             /// particular pillar.
             struct PillarPointIDX
             {
@@ -322,138 +538,41 @@ namespace Opm { namespace UgGridHelpers {
                 std::size_t bottom;
             };
 
-            /// Retrieve cell's top and bottom pillar points on all pillars.
-            ///
-            /// \param[in] ijk Cartesian position of particular cell.
-            ///
-            /// \return Linear ZCORN indices of cell \p ijk's top and bottom
-            ///    pillar points on all of the cell's connecting pillars.
-            template <class IndexTuple>
-            std::array<PillarPointIDX, 4>
-            pillarPoints(const IndexTuple& ijk) const
-            {
-                const auto start = this->getStartIDX(ijk);
-
-                return {
-                    this->p00(start),
-                    this->p10(start),
-                    this->p01(start),
-                    this->p11(start)
-                };
-            }
-
-        private:
-            /// Number of cells in model's X direction.
-            const std::size_t nx_;
-
-            /// Number of cells in model's Y direction.
-            const std::size_t ny_;
-
-            /// Number of cells in model's Z direction.
-            const std::size_t nz_;
-
             /// Number of values in a single ZCORN depth layer.
             const std::size_t layerOffset_;
 
-            /// Compute linear ZCORN offset of current cell.
-            ///
-            /// \param[in] ijk Cartesian position of current cell.
-            ///
-            /// \return linear ZCORN offset of cell \p ijk.
-            template <class IndexTuple>
-            std::size_t getStartIDX(const IndexTuple& ijk) const
-            {
-                return 2*ijk[0] + 2*nx_*(2*ijk[1] + 2*ny_*(2 * ijk[2]));
-            }
-
-            /// Retrieve top and bottom pillar point indices of cell's lower
-            /// left pillar.
-            ///
-            /// \param[in] start Linear ZCORN offset of current cell.
-            ///
-            /// \return Linear ZCORN indices of cell's top and pillar points
-            ///    on cell's pillar (0,0).
-            PillarPointIDX p00(const std::size_t start) const
-            {
-                return this->pillarpts(start, this->offset(0, 0));
-            }
-
-            /// Retrieve top and bottom pillar point indices of cell's lower
-            /// right pillar.
-            ///
-            /// \param[in] start Linear ZCORN offset of current cell.
-            ///
-            /// \return Linear ZCORN indices of cell's top and pillar points
-            ///    on cell's pillar (1,0).
-            PillarPointIDX p10(const std::size_t start) const
-            {
-                return this->pillarpts(start, this->offset(1, 0));
-            }
+            /// Slab's ZCORN values.
+            const double* zcorn_;
 
-            /// Retrieve top and bottom pillar point indices of cell's upper
-            /// left pillar.
-            ///
-            /// \param[in] start Linear ZCORN offset of current cell.
-            ///
-            /// \return Linear ZCORN indices of cell's top and pillar points
-            ///    on cell's pillar (0,1).
-            PillarPointIDX p01(const std::size_t start) const
-            {
-                return this->pillarpts(start, this->offset(0, 1));
-            }
+            /// Slab's explicit cell activation flags.
+            std::span<const int> actnum_;
 
-            /// Retrieve top and bottom pillar point indices of cell's upper
-            /// right pillar.
-            ///
-            /// \param[in] start Linear ZCORN offset of current cell.
-            ///
-            /// \return Linear ZCORN indices of cell's top and pillar points
-            ///    on cell's pillar (1,1).
-            PillarPointIDX p11(const std::size_t start) const
+            /// Retrieve cell's top and bottom pillar points on all pillars,
+            /// in the order (0,0), (1,0), (0,1), (1,1).
+            std::array<PillarPointIDX, 4>
+            pillarPoints(const std::size_t cell) const
             {
-                return this->pillarpts(start, this->offset(1, 1));
-            }
+                const auto i = cell % this->nx;
+                const auto j = (cell / this->nx) % this->ny;
+                const auto k = cell / this->numColumns();
 
-            /// Compute relative ZCORN offset of cell's local pillars.
-            ///
-            /// \param[in] i X-direction pillar offset of cell's pillar.
-            ///    Must be 0 or 1.
-            ///
-            /// \param[in] j Y-direction pillar offset of cell's pillar.
-            ///    Must be 0 or 1.
-            ///
-            /// \return Relative ZCORN offset of cell's local pillars.
-            std::size_t offset(const std::size_t i, const std::size_t j) const
-            {
-                assert ((i == 0) || (i == 1));
-                assert ((j == 0) || (j == 1));
+                const auto start = 2*i + 2*this->nx*(2*j + 2*this->ny*(2*k));
 
-                return i + j*2*nx_;
-            }
+                auto pillarpts = [start, this](const std::size_t off)
+                    -> PillarPointIDX
+                {
+                    return { start + off, start + off + this->layerOffset_ };
+                };
 
-            /// Retrieve cell's top and bottom pillar points on single
-            /// pillar.
-            ///
-            /// \param[in] start Linear ZCORN offset of current cell.
-            ///
-            /// \param[in] off ZCORN offset of particular pillar relative to
-            ///    cell's ZCORN indices.
-            PillarPointIDX pillarpts(const std::size_t start,
-                                     const std::size_t off) const
-            {
                 return {
-                    start + off,
-                    start + off + this->layerOffset_
+                    pillarpts(0),
+                    pillarpts(1),
+                    pillarpts(2 * this->nx),
+                    pillarpts(2 * this->nx + 1)
                 };
             }
         };
 
-        /// Model's active cells
-        const ActiveCells active_;
-
-        /// Indirection map into model's ZCORN array.
-        const ZCornIndex zcorn_idx_;
-
         /// Model's ZCORN array.  Subject to change.
         std::vector<double> zcorn_;
 
@@ -466,264 +585,6 @@ namespace Opm { namespace UgGridHelpers {
 
         /// Statistics about BBLT operation.
         ZCornChangeCount bottomBelowLowerTop_;
-
-        /// Ensure ZCORN values are depths.
-        ///
-        /// Modifies \code this->zcorn_ \endcode.
-        void ensureZCornIsDepth()
-        {
-            if (this->zcornIsElevation()) {
-                std::ranges::transform(this->zcorn_, this->zcorn_.begin(), std::negate<>{});
-
-                this->switchedToDepth_ = true;
-            }
-        }
-
-        /// Ensure ZCORN values honour restriction that cell's top corner is
-        /// not below cell's bottom corner on same pillar for every cell.
-        ///
-        /// Modifies \code this->zcorn_ \endcode.
-        void ensureTopNotBelowBottom()
-        {
-            for (const auto& globCell : this->active_.activeGlobal()) {
-                this->ensureTopNotBelowBottom(globCell);
-            }
-        }
-
-        /// Ensure ZCORN values honour restriction that cell's bottom corner
-        /// is not below cell's lower neighbour's upper corner on same
-        /// pillar for every cell.
-        ///
-        /// Modifies \code this->zcorn_ \endcode.
-        ///
-        /// \param[in] nz Number of layers in model.
-        void ensureBottomNotBelowLowerTop(const std::size_t nz)
-        {
-            if (nz == 0) { return; }
-
-            auto bottomLayer = [nz](const std::size_t layerID)
-            {
-                return layerID == (nz - 1);
-            };
-
-            for (const auto& globCell : this->active_.activeGlobal()) {
-                const auto& ijk = this->active_.getCellIJK(globCell);
-
-                if (bottomLayer(ijk[2])) { continue; }
-
-                this->ensureCellBottomNotBelowLowerTop(ijk);
-            }
-        }
-
-        /// Ensure ZCORN values honour restriction that cell's top corner is
-        /// not below cell's bottom corner on same pillar.
-        ///
-        /// Modifies \code this->zcorn_ \endcode.
-        ///
-        /// \tparam CellIndex Integral type representing cell indices.
-        ///
-        /// \param[in] globCell Global ID of particular cell.
-        template <class CellIndex>
-        void ensureTopNotBelowBottom(const CellIndex globCell)
-        {
-            const auto cornerCnt0 = this->topBelowBottom_.corners;
-
-            const auto ijk = this->active_.getCellIJK(globCell);
-
-            for (const auto& pt : this->zcorn_idx_.pillarPoints(ijk)) {
-                const auto zb = this->zcorn_[pt.bottom];
-                auto&      zt = this->zcorn_[pt.top];
-
-                if (zt > zb) {  // Top below bottom (ZCORN is depth)
-                    zt = zb;
-
-                    this->topBelowBottom_.corners += 1;
-                }
-            }
-
-            this->topBelowBottom_.cells +=
-                this->topBelowBottom_.corners > cornerCnt0;
-        }
-
-        /// Ensure ZCORN values honour restriction that cell's bottom corner
-        /// is not below cell's lower neighbour's upper corner on same
-        /// pillar.
-        ///
-        /// Modifies \code this->zcorn_ \endcode.
-        ///
-        /// \tparam IndexTuple Representation of Cartesian index tuples.
-        ///    Typically \code ActiveCells::IndexTuple \endcode.
-        ///
-        /// \param[in] ijk Cartesian position of particular cell.
-        template <class IndexTuple>
-        void ensureCellBottomNotBelowLowerTop(const IndexTuple& ijk)
-        {
-            const auto below = this->active_.neighbourBelow(ijk);
-
-            if (below >= this->active_.numGlobalCells()) {
-                return;
-            }
-
-            const auto cornerCnt0 = this->bottomBelowLowerTop_.corners;
-
-            const auto& up    = this->zcorn_idx_.pillarPoints(ijk);
-            const auto  d_ijk = this->active_.getCellIJK(below);
-            const auto& down  = this->zcorn_idx_.pillarPoints(d_ijk);
-
-            for (auto n = up.size(), i = 0*n; i < n; ++i) {
-                const auto zbu = this->zcorn_[up  [i].bottom];
-                auto&      ztd = this->zcorn_[down[i].top];
-
-                if (zbu > ztd) { // Bottom below lower top (ZCORN is depth)
-                    ztd = zbu;
-
-                    this->bottomBelowLowerTop_.corners += 1;
-                }
-            }
-
-            this->bottomBelowLowerTop_.cells +=
-                this->bottomBelowLowerTop_.corners > cornerCnt0;
-        }
-
-        /// Determine whether or not input ZCORN array represents elevations
-        /// (values decreasing for increasing layer index) or depths (values
-        /// increasing for increasing layer index).
-        bool zcornIsElevation() const
-        {
-            auto all_signs = std::vector<int>{};
-            all_signs.reserve(this->active_.numGlobalCells());
-
-            std::ranges::transform(this->active_.activeGlobal(),
-                                   std::back_inserter(all_signs),
-                                   [this](const auto globCell)
-                                   { return this->getZCornSign(globCell); });
-
-            // Ignore twisted cells (i.e., cells of indeterminate signs).
-            const int ignore = 0;
-
-            // Elevation implies that ZCORN values are decreasing which
-            // means that the signs in all non-twisted cells equal -1.
-            //
-            // Note: This check is *NOT* equivalent to
-            //
-            //    allEqual(all_signs, ignore, -1)
-            //
-            // because that check returns \c true if ALL cells are ignored
-            // whereas first()==-1 ensures that there is at least ONE cell
-            // of determinate sign.
-            return (first(all_signs, ignore) == -1)
-                && allEqual(all_signs, ignore, -1);
-        }
-
-        /// Retrieve sign of single cell's ZCORN change.
-        ///
-        /// \tparam CellIndex Integral type representing cell indices.
-        ///
-        /// \param[in] globCell Global ID of particular cell.
-        ///
-        /// \return Sign of \p globCell's ZCORN change.  Positive (+1) if
-        ///    ZCORN does not *DECREASE* along any of the cell's pillars,
-        ///    zero (0) if ZCORN increases along some of the pillars and
-        ///    decreases along others (or does not change at all), and
-        ///    negative (-1) if ZCORN does not *INCREASE* along any of the
-        ///    cell's pillars.
-        template <typename CellIndex>
-        int getZCornSign(const CellIndex globCell) const
-        {
-            auto sign = [](const double x) -> int
-            {
-                return (x > 0.0) - (x < 0.0);
-            };
-
-            const auto ijk = this->active_.getCellIJK(globCell);
-
-            auto sgn = std::vector<int>{};  sgn.reserve(4);
-
-            for (const auto& pt : this->zcorn_idx_.pillarPoints(ijk)) {
-                const auto dz =
-                    this->zcorn_[pt.bottom] - this->zcorn_[pt.top];
-
-                sgn.push_back(sign(dz));
-            }
-
-            const int ignore = 0;
-
-            if (! allEqual(sgn, ignore)) {
-                return 0;
-            }
-
-            return sgn.front();
-        }
-
-        /// Check whether or not all elements of a vector are equal, while
-        /// ignoring particular element value.
-        ///
-        /// \param[in] coll Sequence of elements.
-        ///
-        /// \param[in] ignore Special value that should be considered equal
-        ///    (i.e., ignored) for comparison purposes.  Typically zero.
-        ///
-        /// \return Whether or not all non-ignored elements of \p coll have
-        ///    the same value.
-        bool allEqual(const std::vector<int>& coll,
-                      const int               ignore) const
-        {
-            return this->allEqual(coll, ignore, ignore);
-        }
-
-        /// Check whether or not all elements of a vector are equal to each
-        /// other or a user-specified value, while ignoring particular
-        /// element value.
-        ///
-        /// \param[in] coll Sequence of elements.
-        ///
-        /// \param[in] ignore Special value that should be considered equal
-        ///    (i.e., ignored) for comparison purposes.  Typically zero.
-        ///
-        /// \param[in] lookfor Search hint for which value to look for in
-        ///    the element sequence.  If \code lookfor == ignore \endcode,
-        ///    then allEqual() will first perform a linear scan over the
-        ///    sequence to find the first non-ignored element and
-        ///    subsequently compare all elements to this value.  Otherwise,
-        ///    the elements will be compared directly to \p lookfor.  In
-        ///    essence this parameter is an optimisation that enables
-        ///    bypassing the initial value search if the desired value is
-        ///    already known.
-        ///
-        /// \return Whether or not all non-ignored elements of \p coll have
-        ///    the same value.
-        bool allEqual(const std::vector<int>& coll,
-                      const int               ignore,
-                      const int               lookfor) const
-        {
-            const auto x0 = (lookfor != ignore)
-                ? lookfor : first(coll, ignore);
-
-            return std::ranges::all_of(coll,
-                                       [x0, ignore](const int xi)
-                                       { return (xi == x0) || (xi == ignore); });
-        }
-
-        /// Find first non-ignored element value in vector.
-        ///
-        /// \param[in] coll Sequence of elements.
-        ///
-        /// \param[in] ignore Special value that should be ignored for
-        ///    comparison purposes.  Typically zero.
-        ///
-        /// \return First non-ignored element value in \p coll.  If there
-        ///    are no non-ignored elements in \p coll, then first() returns
-        ///    \p ignore.
-        int first(const std::vector<int>& coll,
-                  const int               ignore) const
-        {
-            const auto p =
-                std::ranges::find_if(coll,
-                                     [ignore](const int xi)
-                                     { return xi != ignore; });
-
-            return p == coll.end() ? ignore : *p;
-        }
     };
 
 }} // namespace Opm::UgGridHelpers
@@ -19,11 +19,18 @@
 #ifndef OPM_COMMUNICATION_UTILS_HPP
 #define OPM_COMMUNICATION_UTILS_HPP
 
+#include<algorithm>
 #include<vector>
 #include<numeric>
 #include<tuple>
+#include<type_traits>
 #include<utility> // Should be included via tuple but you never know.
 
+#if HAVE_MPI
+#include <dune/common/parallel/mpitraits.hh>
+#include <mpi.h>
+#endif
+
 namespace Opm
 {
 /// \brief Gathers vectors from all processes on all processes
@@ -97,5 +104,172 @@ gatherv(const std::vector<T,A>& input, const C& comm, int root)
     comm.gatherv(input.data(), input.size(), output.data(), sizes.data(), displ.data(), root);
     return {output, displ};
 }
+
+/// \brief Computes the sum of a value over all processes and the partial sum
+///        over the processes with lower rank.
+///
+/// In parallel this will call MPI_Exscan and MPI_Allreduce. Unlike gathering
+/// the values of all processes, the cost does not grow linearly with the
+/// number of processes. Has to be called on all ranks.
+///
+/// \param value The value of this rank.
+/// \param comm The Dune::Communication object.
+/// \return A pair of the sum of the values of all ranks lower than this one
+///         and the sum over all ranks.
+template<class T, class C>
+std::pair<T, T> exclusiveSum(const T& value, const C& comm)
+{
+    T offset{};
+#if HAVE_MPI
+    if constexpr (std::is_convertible_v<C, MPI_Comm>) {
+        MPI_Exscan(&value, &offset, 1, Dune::MPITraits<T>::getType(), MPI_SUM, comm);
+        if (comm.rank() == 0) {
+            // The result of MPI_Exscan is undefined on the first rank.
+            offset = T{};
+        }
+    }
+#endif
+    return {offset, comm.sum(value)};
+}
+
+/// \brief Exchanges vectors with the neighbouring processes only.
+///
+/// In parallel this will create a distributed graph communicator with the
+/// given neighbours and call MPI_Neighbor_alltoall and MPI_Neighbor_alltoallv.
+/// Hence the cost scales with the number of neighbours and not with the number
+/// of processes. Has to be called on all ranks. The neighbour relation has to
+/// be symmetric, i.e. if rank q is a neighbour of rank p then p has to be a
+/// neighbour of q.
+///
+/// \param input For each neighbour the values to send to it.
+/// \param neighbors The ranks of the neighbours in the same order as input.
+/// \param comm The Dune::Communication object.
+/// \return For each neighbour the values received from it.
+template<class T, class A, class C>
+std::vector<std::vector<T, A>>
+neighborAllToAllv(const std::vector<std::vector<T, A>>& input,
+                  const std::vector<int>& neighbors,
+                  [[maybe_unused]] const C& comm)
+{
+#if HAVE_MPI
+    if constexpr (std::is_convertible_v<C, MPI_Comm>) {
+        const int numNeighbors = neighbors.size();
+        MPI_Comm graph;
+        MPI_Dist_graph_create_adjacent(comm, numNeighbors, neighbors.data(), MPI_UNWEIGHTED,
+                                       numNeighbors, neighbors.data(), MPI_UNWEIGHTED,
+                                       MPI_INFO_NULL, 0, &graph);
+
+        std::vector<int> sendSizes(numNeighbors);
+        std::vector<int> sendDispl(numNeighbors + 1, 0);
+        for (int n = 0; n < numNeighbors; ++n) {
+            sendSizes[n] = input[n].size();
+        }
+        std::partial_sum(sendSizes.begin(), sendSizes.end(), sendDispl.begin() + 1);
+        std::vector<int> recvSizes(numNeighbors);
+        std::vector<int> recvDispl(numNeighbors + 1, 0);
+        MPI_Neighbor_alltoall(sendSizes.data(), 1, MPI_INT, recvSizes.data(), 1, MPI_INT, graph);
+        std::partial_sum(recvSizes.begin(), recvSizes.end(), recvDispl.begin() + 1);
+
+        std::vector<T, A> sendValues;
+        sendValues.reserve(sendDispl.back());
+        for (const auto& values : input) {
+            sendValues.insert(sendValues.end(), values.begin(), values.end());
+        }
+        std::vector<T, A> recvValues(recvDispl.back());
+        MPI_Neighbor_alltoallv(sendValues.data(), sendSizes.data(), sendDispl.data(),
+                               Dune::MPITraits<T>::getType(),
+                               recvValues.data(), recvSizes.data(), recvDispl.data(),
+                               Dune::MPITraits<T>::getType(), graph);
+        MPI_Comm_free(&graph);
+
+        std::vector<std::vector<T, A>> output(numNeighbors);
+        for (int n = 0; n < numNeighbors; ++n) {
+            output[n].assign(recvValues.begin() + recvDispl[n], recvValues.begin() + recvDispl[n + 1]);
+        }
+        return output;
+    }
+#endif
+    // Without MPI the only possible neighbour is this process.
+    return input;
+}
+
+/// \brief Sends vectors to some processes and receives from those sending to this one.
+///
+/// Unlike neighborAllToAllv() a process does not need to know which processes
+/// send to it. The values are sent with synchronous sends, which complete once
+/// they are received. A process whose sends completed enters a non-blocking
+/// barrier and keeps receiving until the barrier completes on all processes.
+/// Hence only processes exchanging data communicate, apart from the barrier and
+/// the duplicate of the communicator keeping the messages of successive calls
+/// apart. Has to be called on all ranks.
+///
+/// \param input For each destination the values to send to it.
+/// \param destinations The distinct ranks of the destinations in the same order as input.
+/// \param comm The Dune::Communication object.
+/// \return The ranks that sent something to this process in ascending order, and
+///         for each of them the values received from it.
+template<class T, class A, class C>
+std::pair<std::vector<int>, std::vector<std::vector<T, A>>>
+sparseAllToAllv(const std::vector<std::vector<T, A>>& input,
+                const std::vector<int>& destinations,
+                [[maybe_unused]] const C& comm)
+{
+#if HAVE_MPI
+    if constexpr (std::is_convertible_v<C, MPI_Comm>) {
+        const auto type = Dune::MPITraits<T>::getType();
+        const int tag = 2391;
+        MPI_Comm exchange;
+        MPI_Comm_dup(comm, &exchange);
+
+        std::vector<MPI_Request> sends(destinations.size());
+        for (std::size_t n = 0; n < destinations.size(); ++n) {
+            MPI_Issend(input[n].data(), input[n].size(), type, destinations[n], tag,
+                       exchange, &sends[n]);
+        }
+
+        std::vector<std::pair<int, std::vector<T, A>>> received;
+        MPI_Request barrier;
+        bool inBarrier = false;
+        int done = false;
+        while (!done) {
+            int arrived = false;
+            MPI_Status status;
+            MPI_Iprobe(MPI_ANY_SOURCE, tag, exchange, &arrived, &status);
+            if (arrived) {
+                int count = 0;
+                MPI_Get_count(&status, type, &count);
+                auto& values = received.emplace_back(status.MPI_SOURCE, std::vector<T, A>(count)).second;
+                MPI_Recv(values.data(), count, type, status.MPI_SOURCE, tag, exchange, MPI_STATUS_IGNORE);
+            }
+            if (inBarrier) {
+                MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+            }
+            else {
+                int sent = false;
+                MPI_Testall(sends.size(), sends.data(), &sent, MPI_STATUSES_IGNORE);
+                if (sent) {
+                    MPI_Ibarrier(exchange, &barrier);
+                    inBarrier = true;
+                }
+            }
+        }
+        MPI_Comm_free(&exchange);
+
+        std::sort(received.begin(), received.end(),
+                  [](const auto& r1, const auto& r2) { return r1.first < r2.first; });
+        std::vector<int> sources;
+        std::vector<std::vector<T, A>> output;
+        sources.reserve(received.size());
+        output.reserve(received.size());
+        for (auto& [source, values] : received) {
+            sources.push_back(source);
+            output.push_back(std::move(values));
+        }
+        return {sources, output};
+    }
+#endif
+    // Without MPI the only possible destination is this process.
+    return {destinations, input};
+}
 }
 #endif
@@ -0,0 +1,70 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_FACENEIGHBOURS_HEADER_INCLUDED
+#define OPM_GRID_FACENEIGHBOURS_HEADER_INCLUDED
+
+#include <array>
+#include <vector>
+
+namespace Dune
+{
+
+/// \brief Flat face-cell adjacency of a grid view.
+///
+/// Holds the interior faces, i.e. faces with a cell on both sides,
+/// as contiguous arrays indexed by the interior face number, and the
+/// cell-to-face relation in compressed row format. Meant for loops
+/// over connections (e.g. TPFA assembly) that can be vectorized and
+/// split among threads without walking intersection iterators.
+struct FaceNeighbours
+{
+    /// \brief The two cells of each interior face, ordered such that
+    ///        cells[i][0] < cells[i][1].
+    std::vector<std::array<int,2>> cells;
+    /// \brief The face index of each interior face.
+    std::vector<int> faces;
+    /// \brief The logical Cartesian direction of each interior face,
+    ///        a value of enum face_tag, or -1 if the grid has no face tags.
+    std::vector<int> tags;
+    /// \brief For each interior face 1 if its normal points from
+    ///        cells[i][0] to cells[i][1], and 0 otherwise.
+    std::vector<char> orientations;
+    /// \brief Start of the faces of each cell in cell_faces, the size
+    ///        is the number of cells plus one.
+    std::vector<int> cell_face_offsets{0};
+    /// \brief The faces of all cells, including boundary faces.
+    std::vector<int> cell_faces;
+
+    /// \brief Number of interior faces.
+    int numInteriorFaces() const
+    {
+        return faces.size();
+    }
+
+    /// \brief Number of cells.
+    int numCells() const
+    {
+        return cell_face_offsets.size() - 1;
+    }
+};
+
+} // namespace Dune
+
+#endif // OPM_GRID_FACENEIGHBOURS_HEADER_INCLUDED
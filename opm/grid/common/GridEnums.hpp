@@ -49,7 +49,11 @@ namespace Dune {
         /// \brief Use METIS for partitioning
         metis=2,
         /// \brief use Zoltan on GraphOfGrid for partitioning
-        zoltanGoG=3
+        zoltanGoG=3,
+        /// \brief use Zoltan on GraphOfGrid spread over all processes for partitioning
+        zoltanGoGDistributed=4,
+        /// \brief cut a Hilbert or Morton space-filling curve through the cells of GraphOfGrid into balanced pieces
+        spaceFillingCurve=5
     };
 }
 
@@ -43,9 +43,16 @@
 #include <opm/grid/CpGrid.hpp>
 #include <opm/grid/cpgrid/CpGridDataTraits.hpp>
 #include <opm/grid/common/ZoltanPartition.hpp>
+#include <opm/grid/common/CommunicationUtils.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <span>
 #include <stack>
+#include <unordered_map>
 #include <variant>
 
 #ifdef HAVE_MPI
@@ -251,422 +258,915 @@ namespace Dune
         }
     }
 
-/// \brief Adds cells to the overlap that just share a point with an owner cell.
-void addOverlapCornerCell(const CpGrid& grid,
-                          int owner,
-                          const CpGrid::Codim<0>::Entity& from,
-                          const CpGrid::Codim<0>::Entity& neighbor,
-                          const std::vector<int>& cell_part,
-                          std::vector<std::set<int> >& cell_overlap,
-                          int level)
+namespace
 {
-    bool validLevel = (level>-1) && (level <= grid.maxLevel());
-    const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
-    int my_index = ix.index(from);
-    int nb_index = ix.index(neighbor);
-    const int num_from_subs = from.subEntities(CpGrid::dimension);
-    for ( int i = 0; i < num_from_subs ; i++ )
+/// \brief Adds the ranks of a sorted list to another sorted list.
+void mergeRanks(std::vector<int>& ranks, const std::vector<int>& other)
+{
+    const auto oldSize = ranks.size();
+    ranks.insert(ranks.end(), other.begin(), other.end());
+    std::inplace_merge(ranks.begin(), ranks.begin() + oldSize, ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+}
+
+/// \brief Sends the rank stored for each cell from its owner to all copies.
+class CellRankHandle
+{
+public:
+    using DataType = int;
+
+    CellRankHandle(const CpGrid& grid, std::vector<int>& ranks)
+        : grid_(grid), ranks_(ranks)
+    {}
+    bool fixedSize(int /*dim*/, int /*codim*/)
     {
-        int mypoint = ix.index(from.subEntity<CpGrid::dimension>(i));
-        const int num_nb_subs = neighbor.subEntities(CpGrid::dimension);
-        for ( int j = 0; j < num_nb_subs; j++)
-        {
-            int otherpoint = ix.index(neighbor.subEntity<CpGrid::dimension>(j));
-            if ( mypoint == otherpoint )
-            {
-                cell_overlap[nb_index].insert(owner);
-                cell_overlap[my_index].insert(cell_part[nb_index]);
-                return;
+        return true;
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim == 3 && codim == 0;
+    }
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 1;
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        buffer.write(ranks_[grid_.leafIndexSet().index(t)]);
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t)
+    {
+        buffer.read(ranks_[grid_.leafIndexSet().index(t)]);
+    }
+private:
+    const CpGrid& grid_;
+    std::vector<int>& ranks_;
+};
+
+/// \brief Sends a sorted list of ranks for each entity of a codimension.
+///
+/// With merge the received ranks are added to the ones stored locally,
+/// otherwise they replace them.
+template<int codimension>
+class RankListHandle
+{
+public:
+    using DataType = int;
+
+    RankListHandle(const CpGrid& grid, std::vector<std::vector<int>>& ranks, bool merge)
+        : grid_(grid), ranks_(ranks), merge_(merge)
+    {}
+    bool fixedSize(int /*dim*/, int /*codim*/)
+    {
+        return false;
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim == 3 && codim == codimension;
+    }
+    template<class T>
+    std::size_t size(const T& t)
+    {
+        return ranks_[grid_.leafIndexSet().index(t)].size();
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        for (const auto& rank : ranks_[grid_.leafIndexSet().index(t)]) {
+            buffer.write(rank);
+        }
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t n)
+    {
+        received_.resize(n);
+        for (auto& rank : received_) {
+            buffer.read(rank);
+        }
+        auto& ranks = ranks_[grid_.leafIndexSet().index(t)];
+        if (merge_) {
+            mergeRanks(ranks, received_);
+        }
+        else {
+            ranks = received_;
+        }
+    }
+private:
+    const CpGrid& grid_;
+    std::vector<std::vector<int>>& ranks_;
+    bool merge_;
+    std::vector<int> received_;
+};
+} // anonymous namespace
+
+    int diffusePartition(const CpGrid& grid,
+                         std::vector<int>& cell_part,
+                         const std::vector<double>& cell_weights,
+                         double imbalanceTol,
+                         int max_sweeps)
+    {
+        const auto& cc = grid.comm();
+        const int my_rank = cc.rank();
+        const int num_procs = cc.size();
+        const auto& gv = grid.leafGridView();
+        const auto& ix = grid.leafIndexSet();
+        const int num_cells = ix.size(0);
+        if (cc.min(static_cast<int>(static_cast<int>(cell_weights.size()) == num_cells)) == 0) {
+            OPM_THROW(std::logic_error, "Diffusing the partition needs a weight for each cell.");
+        }
+
+        // Only the owner decides about a cell. The other processes learn its
+        // new owner through the communication after each sweep.
+        cell_part.assign(num_cells, my_rank);
+        double my_load = 0.0;
+        int num_kept = 0;
+        for (const auto& element : elements(gv, Partitions::interior)) {
+            my_load += cell_weights[ix.index(element)];
+            ++num_kept;
+        }
+        CellRankHandle part_handle(grid, cell_part);
+        grid.communicate(part_handle, InteriorBorder_All_Interface, ForwardCommunication);
+
+        std::vector<double> load(num_procs);
+        std::vector<int> num_neighbors(num_procs);
+        std::vector<double> received(num_procs);
+        std::map<int, double> quota;
+        int moved = 0;
+        for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+            // Only cells at the boundary at the start of the sweep may move, so
+            // that each sweep peels off at most one layer of cells.
+            const std::vector<int> sweep_part = cell_part;
+            std::vector<int> neighbors;
+            for (const auto& element : elements(gv, Partitions::interior)) {
+                if (sweep_part[ix.index(element)] != my_rank) {
+                    continue;
+                }
+                for (const auto& intersection : intersections(gv, element)) {
+                    if (intersection.neighbor()) {
+                        const int part = sweep_part[ix.index(intersection.outside())];
+                        if (part != my_rank) {
+                            neighbors.push_back(part);
+                        }
+                    }
+                }
+            }
+            std::ranges::sort(neighbors);
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+            std::ranges::fill(load, 0.0);
+            std::ranges::fill(num_neighbors, 0);
+            load[my_rank] = my_load;
+            num_neighbors[my_rank] = neighbors.size();
+            cc.sum(load.data(), num_procs);
+            cc.sum(num_neighbors.data(), num_procs);
+            const double max_load = imbalanceTol * std::accumulate(load.begin(), load.end(), 0.0) / num_procs;
+            if (*std::max_element(load.begin(), load.end()) <= max_load) {
+                break;
+            }
+
+            // The load that may be sent to each less loaded neighbour in this
+            // sweep. Dividing the difference by the number of neighbours makes
+            // sure that the concurrent sends of all processes cannot push the
+            // receiver above the senders.
+            quota.clear();
+            if (my_load > max_load) {
+                for (const int part : neighbors) {
+                    const double difference = load[my_rank] - load[part];
+                    if (difference > 0.0) {
+                        quota[part] = difference / (1 + std::max(num_neighbors[my_rank], num_neighbors[part]));
+                    }
+                }
             }
+
+            std::ranges::fill(received, 0.0);
+            int moved_in_sweep = 0;
+            for (const auto& element : elements(gv, Partitions::interior)) {
+                if (quota.empty() || num_kept == 1) {
+                    break;
+                }
+                const int cell = ix.index(element);
+                const double weight = cell_weights[cell];
+                if (sweep_part[cell] != my_rank || weight <= 0.0) {
+                    continue;
+                }
+                int to = -1;
+                for (const auto& intersection : intersections(gv, element)) {
+                    if (!intersection.neighbor()) {
+                        continue;
+                    }
+                    const int part = sweep_part[ix.index(intersection.outside())];
+                    const auto candidate = quota.find(part);
+                    if (candidate != quota.end() && weight <= 2 * candidate->second &&
+                        (to < 0 || load[part] + received[part] < load[to] + received[to])) {
+                        to = part;
+                    }
+                }
+                // Moving only reduces the sum of squared loads if the target
+                // stays below the source.
+                if (to >= 0 && load[to] + received[to] + weight < my_load) {
+                    cell_part[cell] = to;
+                    my_load -= weight;
+                    received[to] += weight;
+                    --num_kept;
+                    ++moved_in_sweep;
+                    if ((quota[to] -= weight) <= 0.0) {
+                        quota.erase(to);
+                    }
+                }
+            }
+            grid.communicate(part_handle, InteriorBorder_All_Interface, ForwardCommunication);
+            cc.sum(received.data(), num_procs);
+            my_load += received[my_rank];
+            moved_in_sweep = cc.sum(moved_in_sweep);
+            if (moved_in_sweep == 0) {
+                break;
+            }
+            moved += moved_in_sweep;
         }
+        return moved;
     }
+
+std::vector<std::vector<int>> computeOverlapProcesses(const CpGrid& grid,
+                                                      const std::vector<int>& cell_part,
+                                                      bool addCornerCells,
+                                                      int layers)
+{
+    const auto& gv = grid.leafGridView();
+    const auto& ix = grid.leafIndexSet();
+
+    // For each cell the owners of the cells at most the current number of
+    // layers away. Only the owner of a cell updates its entry, since it is
+    // the only process guaranteed to have all neighbours of the cell.
+    std::vector<std::vector<int>> processes(ix.size(0));
+    for (std::size_t cell = 0; cell < processes.size(); ++cell) {
+        processes[cell].push_back(cell_part[cell]);
+    }
+
+    for (int layer = 0; layer < layers; ++layer) {
+        // Corner cells are added to the last layer. They share a point with a
+        // cell of the previous layers, whose processes are collected at the
+        // points from all processes.
+        std::vector<std::vector<int>> point_processes;
+        const bool addCorners = addCornerCells && layer + 1 == layers;
+        if (addCorners) {
+            point_processes.resize(ix.size(3));
+            for (const auto& element : elements(gv)) {
+                const auto& cell_processes = processes[ix.index(element)];
+                for (int i = 0; i < element.subEntities(CpGrid::dimension); ++i) {
+                    mergeRanks(point_processes[ix.index(element.subEntity<CpGrid::dimension>(i))],
+                               cell_processes);
+                }
+            }
+            RankListHandle<CpGrid::dimension> point_handle(grid, point_processes, true);
+            grid.communicate(point_handle, All_All_Interface, ForwardCommunication);
+        }
+
+        auto next = processes;
+        for (const auto& element : elements(gv, Partitions::interior)) {
+            auto& cell_processes = next[ix.index(element)];
+            for (const auto& intersection : intersections(gv, element)) {
+                if (intersection.neighbor()) {
+                    mergeRanks(cell_processes, processes[ix.index(intersection.outside())]);
+                }
+            }
+            if (addCorners) {
+                for (int i = 0; i < element.subEntities(CpGrid::dimension); ++i) {
+                    mergeRanks(cell_processes,
+                               point_processes[ix.index(element.subEntity<CpGrid::dimension>(i))]);
+                }
+            }
+        }
+        RankListHandle<0> cell_handle(grid, next, false);
+        grid.communicate(cell_handle, InteriorBorder_All_Interface, ForwardCommunication);
+        processes = std::move(next);
+    }
+    return processes;
 }
 
-/// \brief Adds cells to the overlap that just share a point with an owner cell.
-void addOverlapCornerCell(const CpGrid& grid,
-                          int owner,
-                          const CpGrid::Codim<0>::Entity& from,
-                          const CpGrid::Codim<0>::Entity& neighbor,
-                          const std::vector<int>& cell_part,
-                          std::vector<std::tuple<int,int,char>>& exportList,
-                          int level)
+namespace
+{
+/// \brief Calls f(neighbor) for all face neighbors of a cell.
+///
+/// Faces with zero transmissibility are skipped if trans is given.
+template<class F>
+void forEachOverlapNeighbor(const CpGrid::Codim<0>::Entity& e,
+                            bool validLevel,
+                            const double* trans,
+                            F&& f)
+{
+    auto iit = validLevel? e.ilevelbegin() : e.ileafbegin();
+    const auto& endIit = validLevel? e.ilevelend() :  e.ileafend();
+
+    for (; iit != endIit; ++iit) {
+        // If the transmissibility on a cell interface is zero we do not add the neighbor cell
+        // to the overlap layer. The reason for this is that
+        // zero transmissibility -> no flux over the face -> zero offdiagonal.
+        // This is a reservoir simulation spesific thing that reduce parallel overhead.
+        if ( iit->neighbor() && ( !trans || trans[iit->id()] != 0.0 ) ) {
+            f(iit->outside());
+        }
+    }
+}
+
+/// \brief Whether two cells share at least one point.
+template<class IndexSet>
+bool shareCorner(const IndexSet& ix,
+                 const CpGrid::Codim<0>::Entity& from,
+                 const CpGrid::Codim<0>::Entity& neighbor)
 {
-    // Add corner cells to the overlap layer. Example of a subdomain of a 4x4 grid
-    // with and without corner cells in the overlap is given below. Note that the
-    // corner cell is not needed for cell centered finite volume schemes.
-    // I = interior cells, O = overlap cells and E = exterior cells.
-    //
-    //  With corner     Without corner
-    //  I I O E         I I O E
-    //  I I O E         I I O E
-    //  O O O E         O O E E
-    //  E E E E         E E E E
-    using AttributeSet = Dune::cpgrid::CpGridDataTraits::AttributeSet;
-    bool validLevel = (level>-1) && (level <= grid.maxLevel());
-    const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
-    int my_index = ix.index(from);
-    int nb_index = ix.index(neighbor);
     const int num_from_subs = from.subEntities(CpGrid::dimension);
+    const int num_nb_subs = neighbor.subEntities(CpGrid::dimension);
     for ( int i = 0; i < num_from_subs ; i++ )
     {
         int mypoint = ix.index(from.subEntity<CpGrid::dimension>(i));
-        const int num_nb_subs = neighbor.subEntities(CpGrid::dimension);
         for ( int j = 0; j < num_nb_subs; j++)
         {
-            int otherpoint = ix.index(neighbor.subEntity<CpGrid::dimension>(j));
-            if ( mypoint == otherpoint )
+            if ( mypoint == ix.index(neighbor.subEntity<CpGrid::dimension>(j)) )
             {
-                // Note: multiple adds for same process are possible
-                exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                exportList.emplace_back(my_index, cell_part[nb_index],  AttributeSet::copy);
-                return;
+                return true;
             }
         }
     }
+    return false;
 }
 
-void addOverlapLayer(const CpGrid& grid,
-                     int index,
-                     const CpGrid::Codim<0>::Entity& e,
-                     const int owner,
-                     const std::vector<int>& cell_part,
-                     std::vector<std::set<int> >& cell_overlap,
-                     int recursion_deps,
-                     int level)
+/// \brief A face between a cell of the overlap of a partition, or owned by it,
+///        and a neighbor that is not owned by the partition.
+struct OverlapEdge
 {
-    bool validLevel = (level>-1) && (level <= grid.maxLevel());
-    const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
+    CpGrid::Codim<0>::Entity from;
+    CpGrid::Codim<0>::Entity to;
+    int part;
+};
 
-    auto iit = validLevel? e.ilevelbegin() : e.ileafbegin();
-    const auto& endIit = validLevel? e.ilevelend() :  e.ileafend();
+#if HAVE_MPI
+/// \brief Appends the record of a cell of the local overlap graph to a buffer.
+///
+/// A record consists of the global id of the cell, its owner, the number of
+/// its points followed by their global ids, and the number of its face
+/// neighbors followed by global id, owner and whether the overlap may grow
+/// over the face for each neighbor.
+/// \param owned Whether each cell of the view is owned by this process.
+/// \param remote For each face between partitions, given by its global id,
+///               the global id and owner of the cell on the other side.
+void appendOverlapRecord(std::vector<int>& buffer,
+                         const cpgrid::CpGridData& view,
+                         const cpgrid::Entity<0>& e,
+                         int rank,
+                         const std::vector<char>& owned,
+                         const std::unordered_map<int, std::pair<int,int>>& remote,
+                         const double* trans)
+{
+    const auto& ids = view.globalIdSet();
+    buffer.push_back(ids.id(e));
+    buffer.push_back(rank);
+
+    const int num_points = e.subEntities(CpGrid::dimension);
+    buffer.push_back(num_points);
+    for ( int i = 0; i < num_points; ++i ) {
+        buffer.push_back(ids.id(e.subEntity<CpGrid::dimension>(i)));
+    }
 
-    for (; iit != endIit; ++iit) {
-        if ( iit->neighbor() ) {
-            int nb_index = ix.index(iit->outside());
-            if ( cell_part[nb_index]!=owner )
-            {
-                cell_overlap[nb_index].insert(owner);
-                cell_overlap[index].insert(cell_part[nb_index]);
-                if ( recursion_deps>0 ) {
-                    // Add another layer
-                    addOverlapLayer(grid,
-                                    nb_index,
-                                    iit->outside(),
-                                    owner,
-                                    cell_part,
-                                    cell_overlap,
-                                    recursion_deps-1,
-                                    level);
-                }
-                else { // Add cells to the overlap that just share a corner with e.
-                    auto iit2 = validLevel? iit->outside().ilevelbegin() : iit->outside().ileafbegin();
-                    const auto& endIit2 = validLevel?  iit->outside().ilevelend() :  iit->outside().ileafend();
-
-                    for (; iit2 != endIit2; ++iit2) {
-                        if ( iit2->neighbor() )
-                        {
-                            int nb_index2 = ix.index(iit2->outside( ));
-                            if( cell_part[nb_index2]==owner ) continue;
-                            addOverlapCornerCell(grid,
-                                                 owner,
-                                                 e,
-                                                 iit2->outside(),
-                                                 cell_part,
-                                                 cell_overlap,
-                                                 level);
-                        }
-                    }
-                }
-            }
+    const auto num_neighbors = buffer.size();
+    buffer.push_back(0);
+    for (auto iit = e.ileafbegin(); iit != e.ileafend(); ++iit) {
+        if ( iit->boundary() ) {
+            continue;
+        }
+        if ( iit->neighbor() && owned[iit->outside().index()] ) {
+            buffer.push_back(ids.id(iit->outside()));
+            buffer.push_back(rank);
         }
+        else {
+            const auto& [nb_id, nb_rank] =
+                remote.at(ids.idLevelZero(cpgrid::EntityRep<1>(iit->id(), true)));
+            buffer.push_back(nb_id);
+            buffer.push_back(nb_rank);
+        }
+        buffer.push_back( !trans || trans[iit->id()] != 0.0 );
+        ++buffer[num_neighbors];
     }
 }
 
-void addOverlapLayer(const CpGrid& grid,
-                     const std::vector<int>& cell_part,
-                     std::vector<std::set<int> >& cell_overlap,
-                     int mypart,
-                     int layers,
-                     bool all,
-                     int level)
+/// \brief The records of the cells known to a process, see appendOverlapRecord().
+///
+/// Initially these are the cells of its partition, records of other cells
+/// are added when they are fetched from their owners.
+class OverlapGraph
 {
-    cell_overlap.resize(cell_part.size());
-    bool validLevel = (level>-1) && (level <= grid.maxLevel());
-    const auto& ix = validLevel?  grid.levelIndexSet(level) :  grid.leafIndexSet();
+public:
+    /// \brief Adds all records of a buffer and returns the ids of their cells.
+    std::vector<int> add(const std::vector<int>& buffer)
+    {
+        std::vector<int> cells;
+        auto pos = records_.size();
+        records_.insert(records_.end(), buffer.begin(), buffer.end());
+        while ( pos < records_.size() ) {
+            cells.push_back(records_[pos]);
+            position_.emplace(records_[pos], pos);
+            pos += 4 + numPoints(pos) + 3 * numNeighbors(pos);
+        }
+        return cells;
+    }
 
-    auto it = validLevel?  grid.template lbegin<0>(level) : grid.template leafbegin<0>();
-    const auto& endIt = validLevel?  grid.template lend<0>(level) : grid.template leafend<0>();
+    bool contains(int cell) const
+    {
+        return position_.count(cell) > 0;
+    }
 
-    for (; it != endIt; ++it) {
-        int index = ix.index(*it);
-        int owner;
-        if(cell_part[index]==mypart)
-            owner = mypart;
-        else
-        {
-            if(all)
-                owner=cell_part[index];
-            else
-                continue;
+    int owner(int cell) const
+    {
+        return records_[position_.at(cell) + 1];
+    }
+
+    /// \brief The global ids of the points of a cell.
+    std::span<const int> points(int cell) const
+    {
+        const auto pos = position_.at(cell);
+        return { records_.data() + pos + 3, std::size_t(numPoints(pos)) };
+    }
+
+    /// \brief Triples of global id, owner and open face for all neighbors of a cell.
+    ///
+    /// Only valid until the next call of add().
+    std::span<const int> neighbors(int cell) const
+    {
+        const auto pos = position_.at(cell);
+        return { records_.data() + pos + 4 + numPoints(pos), std::size_t(3 * numNeighbors(pos)) };
+    }
+
+    /// \brief Appends the record of a cell to a buffer.
+    void appendRecord(int cell, std::vector<int>& buffer) const
+    {
+        const auto pos = position_.at(cell);
+        buffer.insert(buffer.end(), records_.begin() + pos,
+                      records_.begin() + pos + 4 + numPoints(pos) + 3 * numNeighbors(pos));
+    }
+
+private:
+    int numPoints(std::size_t pos) const
+    {
+        return records_[pos + 2];
+    }
+
+    int numNeighbors(std::size_t pos) const
+    {
+        return records_[pos + 3 + numPoints(pos)];
+    }
+
+    std::vector<int> records_;
+    std::unordered_map<int, std::size_t> position_;
+};
+
+/// \brief Sends vectors to some processes and receives the vectors sent to this one.
+///
+/// Only processes exchanging values communicate, see Opm::sparseAllToAllv().
+/// Has to be called on all ranks.
+std::map<int, std::vector<int>> exchangeOverlapMessages(const std::map<int, std::vector<int>>& send,
+                                                        const Communication<Dune::MPIHelper::MPICommunicator>& cc)
+{
+    std::vector<int> destinations;
+    std::vector<std::vector<int>> values;
+    for (const auto& [proc, message] : send) {
+        if ( !message.empty() ) {
+            destinations.push_back(proc);
+            values.push_back(message);
         }
-        addOverlapLayer(grid, index, *it, owner, cell_part, cell_overlap, layers-1, level);
     }
+    auto [sources, received] = Opm::sparseAllToAllv(values, destinations, cc);
+
+    std::map<int, std::vector<int>> recv;
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        recv.emplace(sources[i], std::move(received[i]));
+    }
+    return recv;
 }
 
-void addOverlapLayer(const CpGrid& grid,
-                     int index,
-                     const CpGrid::Codim<0>::Entity& e,
-                     const int owner,
-                     const std::vector<int>& cell_part,
-                     std::vector<std::tuple<int,int,char>>& exportList,
-                     bool addCornerCells,
-                     int recursion_deps,
-                     int level)
+/// \brief Fetches the records of cells from the processes owning them.
+///
+/// \param cells Pairs of cell id and owner. Cells already known are skipped.
+/// Has to be called on all ranks.
+void fetchOverlapRecords(OverlapGraph& graph,
+                         const std::vector<std::pair<int,int>>& cells,
+                         const Communication<Dune::MPIHelper::MPICommunicator>& cc)
 {
-    using AttributeSet = Dune::cpgrid::CpGridDataTraits::AttributeSet;
+    std::map<int, std::vector<int>> requests;
+    for (const auto& [cell, owner] : cells) {
+        if ( !graph.contains(cell) ) {
+            requests[owner].push_back(cell);
+        }
+    }
+    for (auto& [owner, requested] : requests) {
+        std::sort(requested.begin(), requested.end());
+        requested.erase(std::unique(requested.begin(), requested.end()), requested.end());
+    }
 
-    bool validLevel = (level>-1) && (level <= grid.maxLevel());
-    const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
+    std::map<int, std::vector<int>> replies;
+    for (const auto& [proc, requested] : exchangeOverlapMessages(requests, cc)) {
+        auto& reply = replies[proc];
+        for (const int cell : requested) {
+            graph.appendRecord(cell, reply);
+        }
+    }
+    for (const auto& [proc, records] : exchangeOverlapMessages(replies, cc)) {
+        graph.add(records);
+    }
+}
 
-    auto iit = validLevel? e.ilevelbegin() : e.ileafbegin();
-    const auto& endIit = validLevel? e.ilevelend() :  e.ileafend();
+/// \brief Grows the overlap of the partition of this process on its local graph.
+///
+/// Same algorithm as computeOverlapCells() restricted to one partition.
+/// Starting from the partition, a layer only needs the records of the cells
+/// of the previous one, which are fetched from their owners. Hence only the
+/// cells near the partition interfaces are communicated.
+/// \return Triples of owner, cell id and the process storing the cell as
+///         overlap, sorted and unique.
+std::vector<std::tuple<int,int,int>> growOverlap(OverlapGraph& graph,
+                                                 const std::vector<int>& owned,
+                                                 int part,
+                                                 bool addCornerCells,
+                                                 int layers,
+                                                 const Communication<Dune::MPIHelper::MPICommunicator>& cc)
+{
+    // Sorted pairs of cell and owner in the overlap of the partition found so far.
+    std::vector<std::pair<int,int>> overlap;
+    // Triples of cell, neighbor not owned by the partition and its owner.
+    std::vector<std::tuple<int,int,int>> edges;
+    // The cells added by the last layer together with their owner.
+    std::vector<std::pair<int,int>> frontier;
+
+    auto addEdges = [&](int cell)
+    {
+        const auto neighbors = graph.neighbors(cell);
+        for (std::size_t i = 0; i < neighbors.size(); i += 3) {
+            if ( neighbors[i + 2] && neighbors[i + 1] != part ) {
+                edges.emplace_back(cell, neighbors[i], neighbors[i + 1]);
+            }
+        }
+    };
 
-    for (; iit != endIit; ++iit) {
-        if ( iit->neighbor() ) {
-            int nb_index = ix.index(iit->outside());
-            if ( cell_part[nb_index]!=owner ) {
-                // Note: multiple adds for same process are possible
-                exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                exportList.emplace_back(index, cell_part[nb_index],  AttributeSet::copy);
-                if ( recursion_deps>0 ) {
-                    // Add another layer
-                    addOverlapLayer(grid,
-                                    nb_index,
-                                    iit->outside(),
-                                    owner,
-                                    cell_part,
-                                    exportList,
-                                    addCornerCells,
-                                    recursion_deps-1,
-                                    level);
-                }
-                else if (addCornerCells) {
-                    // Add cells to the overlap that just share a corner with e.
-                    auto iit2 = validLevel? iit->outside().ilevelbegin() : iit->outside().ileafbegin();
-                    const auto& endIit2 = validLevel?  iit->outside().ilevelend() :  iit->outside().ileafend();
-
-                    for (; iit2 != endIit2; ++iit2) {
-                        if ( iit2->neighbor() )
-                        {
-                            int nb_index2 = ix.index(iit2->outside());
-                            if( cell_part[nb_index2]!=owner ) {
-                                addOverlapCornerCell(grid,
-                                                     owner,
-                                                     e,
-                                                     iit2->outside(),
-                                                     cell_part,
-                                                     exportList,
-                                                     level);
-                            }
-                        }
-                    }
+    for (int layer = 0; layer < layers; ++layer) {
+        edges.clear();
+        if (layer == 0) {
+            for (const int cell : owned) {
+                addEdges(cell);
+            }
+        }
+        else {
+            fetchOverlapRecords(graph, frontier, cc);
+            for (const auto& entry : frontier) {
+                addEdges(entry.first);
+            }
+        }
+
+        // Cells that are reached the first time form the new layer.
+        std::vector<std::pair<int,int>> reached;
+        reached.reserve(edges.size());
+        for (const auto& [from, to, owner] : edges) {
+            reached.emplace_back(to, owner);
+        }
+        std::sort(reached.begin(), reached.end());
+        reached.erase(std::unique(reached.begin(), reached.end()), reached.end());
+
+        frontier.clear();
+        const auto oldSize = overlap.size();
+        for (const auto& entry : reached) {
+            if ( !std::binary_search(overlap.begin(), overlap.begin() + oldSize, entry) ) {
+                overlap.push_back(entry);
+                frontier.push_back(entry);
+            }
+        }
+        std::inplace_merge(overlap.begin(), overlap.begin() + oldSize, overlap.end());
+    }
+
+    std::vector<std::tuple<int,int,int>> result;
+    result.reserve(overlap.size());
+    for (const auto& [cell, owner] : overlap) {
+        result.emplace_back(owner, cell, part);
+    }
+
+    if ( addCornerCells ) {
+        // The neighbors of the outermost layer and their points are needed.
+        std::vector<std::pair<int,int>> cells;
+        for (const auto& [from, to, owner] : edges) {
+            cells.emplace_back(to, owner);
+        }
+        fetchOverlapRecords(graph, cells, cc);
+        cells.clear();
+        for (const auto& [from, to, owner] : edges) {
+            const auto neighbors = graph.neighbors(to);
+            for (std::size_t i = 0; i < neighbors.size(); i += 3) {
+                if ( neighbors[i + 1] != part ) {
+                    cells.emplace_back(neighbors[i], neighbors[i + 1]);
                 }
             }
         }
+        fetchOverlapRecords(graph, cells, cc);
+
+        for (const auto& [from, to, owner] : edges) {
+            const auto from_points = graph.points(from);
+            const auto neighbors = graph.neighbors(to);
+            for (std::size_t i = 0; i < neighbors.size(); i += 3) {
+                const int nb_part = neighbors[i + 1];
+                if ( nb_part == part )
+                    continue;
+                const auto nb_points = graph.points(neighbors[i]);
+                const bool shareCorner =
+                    std::any_of(from_points.begin(), from_points.end(),
+                                [&nb_points](int point)
+                                { return std::find(nb_points.begin(), nb_points.end(), point) != nb_points.end(); });
+                if ( !shareCorner )
+                    continue;
+                result.emplace_back(nb_part, neighbors[i], part);
+                const int from_owner = graph.owner(from);
+                if ( from_owner != nb_part )
+                    result.emplace_back(from_owner, from, nb_part);
+            }
+        }
     }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
 }
-
-void addOverlapLayerNoZeroTrans(const CpGrid& grid,
-                                int index,
-                                const CpGrid::Codim<0>::Entity& e,
-                                const int owner,
-                                const std::vector<int>& cell_part,
-                                std::vector<std::tuple<int,int,char>>& exportList,
-                                bool addCornerCells,
-                                int recursion_deps,
-                                const double* trans,
-                                int level)
+#endif // HAVE_MPI
+} // anonymous namespace
+
+std::vector<std::pair<int,int>> computeOverlapCells(const CpGrid& grid,
+                                                    const std::vector<int>& cell_part,
+                                                    bool addCornerCells,
+                                                    const double* trans,
+                                                    int layers,
+                                                    int level)
 {
-    using AttributeSet = Dune::OwnerOverlapCopyAttributeSet::AttributeSet;
     bool validLevel = (level>-1) && (level <= grid.maxLevel());
     const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
 
-    auto iit = validLevel? e.ilevelbegin() : e.ileafbegin();
-    const auto& endIit = validLevel? e.ilevelend() :  e.ileafend();
+    // Sorted (cell, partition) pairs found so far.
+    std::vector<std::pair<int,int>> overlap;
+    std::vector<OverlapEdge> edges;
+    // The cells added by the last layer together with their partition.
+    std::vector<std::pair<CpGrid::Codim<0>::Entity, int>> frontier;
+
+    for (int layer = 0; layer < layers; ++layer) {
+        edges.clear();
+        if (layer == 0) {
+            // The first layer consists of the cells on the other side of the
+            // faces between partitions. This is the only pass over all cells.
+            auto it = validLevel?  grid.template lbegin<0>(level) : grid.template leafbegin<0>();
+            const auto& endIt = validLevel?  grid.template lend<0>(level) : grid.template leafend<0>();
+            for (; it != endIt; ++it) {
+                const int owner = cell_part[ix.index(*it)];
+                forEachOverlapNeighbor(*it, validLevel, trans,
+                                       [&](const auto& nb) {
+                                           if ( cell_part[ix.index(nb)] != owner )
+                                               edges.push_back({*it, nb, owner});
+                                       });
+            }
+        }
+        else {
+            for (const auto& [cell, part] : frontier) {
+                forEachOverlapNeighbor(cell, validLevel, trans,
+                                       [&, p = part, &c = cell](const auto& nb) {
+                                           if ( cell_part[ix.index(nb)] != p )
+                                               edges.push_back({c, nb, p});
+                                       });
+            }
+        }
 
-    for (; iit != endIit; ++iit) {
-        if ( iit->neighbor() ) {
-            int faceId = iit->id();
-
-            // If the transmissibility on a cell interface is zero we do not add the neighbor cell
-            // to the overlap layer. The reason for this is that
-            // zero transmissibility -> no flux over the face -> zero offdiagonal.
-            // This is a reservoir simulation spesific thing that reduce parallel overhead.
-            if ( trans[faceId] != 0.0 ) {
-                int nb_index = ix.index(iit->outside());
-                if ( cell_part[nb_index]!=owner )
-                {
-                    // Note: multiple adds for same process are possible
-                    exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                    exportList.emplace_back(index, cell_part[nb_index],  AttributeSet::copy);
-                    if ( recursion_deps>0 )
-                    {
-                        // Add another layer
-                        addOverlapLayerNoZeroTrans(grid,
-                                                   nb_index,
-                                                   e,
-                                                   owner,
-                                                   cell_part,
-                                                   exportList,
-                                                   addCornerCells,
-                                                   recursion_deps-1,
-                                                   trans,
-                                                   level);
-                    }
-                    else if (addCornerCells)
-                    {
-                        // Add cells to the overlap that just share a corner with e.
-                        auto iit2 = validLevel? iit->outside().ilevelbegin() : iit->outside().ileafbegin();
-                        const auto& endIit2 = validLevel?  iit->outside().ilevelend() :  iit->outside().ileafend();
-
-                        for (; iit2 != endIit2; ++iit2) {
-                            if ( iit2->neighbor() )
-                            {
-                                int nb_index2 = ix.index(iit2->outside());
-                                if( cell_part[nb_index2]!=owner ) {
-                                    addOverlapCornerCell(grid,
-                                                         owner,
-                                                         e,
-                                                         iit2->outside(),
-                                                         cell_part,
-                                                         exportList,
-                                                         level);
-                                }
-                            }
-                        }
-                    }
-                }
+        // Cells that are reached the first time for a partition form the new layer.
+        std::vector<std::pair<std::pair<int,int>, std::size_t>> reached;
+        reached.reserve(edges.size());
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            reached.emplace_back(std::make_pair(ix.index(edges[i].to), edges[i].part), i);
+        }
+        std::sort(reached.begin(), reached.end());
+        reached.erase(std::unique(reached.begin(), reached.end(),
+                                  [](const auto& r1, const auto& r2) { return r1.first == r2.first; }),
+                      reached.end());
+
+        frontier.clear();
+        const auto oldSize = overlap.size();
+        for (const auto& [entry, edge] : reached) {
+            if ( !std::binary_search(overlap.begin(), overlap.begin() + oldSize, entry) ) {
+                overlap.push_back(entry);
+                frontier.emplace_back(edges[edge].to, entry.second);
             }
         }
+        std::inplace_merge(overlap.begin(), overlap.begin() + oldSize, overlap.end());
     }
+
+    if ( addCornerCells ) {
+        // Add corner cells to the overlap layer. Example of a subdomain of a 4x4 grid
+        // with and without corner cells in the overlap is given below. Note that the
+        // corner cell is not needed for cell centered finite volume schemes.
+        // I = interior cells, O = overlap cells and E = exterior cells.
+        //
+        //  With corner     Without corner
+        //  I I O E         I I O E
+        //  I I O E         I I O E
+        //  O O O E         O O E E
+        //  E E E E         E E E E
+        std::vector<std::pair<int,int>> corners;
+        for (const auto& edge : edges) {
+            forEachOverlapNeighbor(edge.to, validLevel, nullptr,
+                                   [&](const auto& nb) {
+                                       const int nb_part = cell_part[ix.index(nb)];
+                                       if ( nb_part == edge.part || !shareCorner(ix, edge.from, nb) )
+                                           return;
+                                       corners.emplace_back(ix.index(nb), edge.part);
+                                       const int from_index = ix.index(edge.from);
+                                       if ( cell_part[from_index] != nb_part )
+                                           corners.emplace_back(from_index, nb_part);
+                                   });
+        }
+        std::sort(corners.begin(), corners.end());
+        const auto oldSize = overlap.size();
+        std::set_difference(corners.begin(), std::unique(corners.begin(), corners.end()),
+                            overlap.begin(), overlap.end(), std::back_inserter(overlap));
+        std::inplace_merge(overlap.begin(), overlap.begin() + oldSize, overlap.end());
+    }
+    return overlap;
 }
 
-int addOverlapLayer([[maybe_unused]] const CpGrid& grid,
-                    [[maybe_unused]] const std::vector<int>& cell_part,
-                    [[maybe_unused]] std::vector<std::tuple<int,int,char>>& exportList,
-                    [[maybe_unused]] std::vector<std::tuple<int,int,char,int>>& importList,
-                    [[maybe_unused]] const Communication<Dune::MPIHelper::MPICommunicator>& cc,
-                    [[maybe_unused]] bool addCornerCells,
-                    [[maybe_unused]] const double* trans,
-                    [[maybe_unused]] int layers,
-                    [[maybe_unused]] int level)
+void addOverlapLayer(const CpGrid& grid,
+                     const std::vector<int>& cell_part,
+                     std::vector<std::set<int> >& cell_overlap,
+                     int mypart,
+                     int layers,
+                     bool all,
+                     int level)
 {
-#ifdef HAVE_MPI
-    using AttributeSet = Dune::cpgrid::CpGridData::AttributeSet;
-    auto ownerSize = exportList.size();
-
+    cell_overlap.resize(cell_part.size());
     bool validLevel = (level>-1) && (level <= grid.maxLevel());
     const auto& ix = validLevel? grid.levelIndexSet(level) : grid.leafIndexSet();
-    std::map<int,int> exportProcs, importProcs;
 
+    // A cell reached by a path of a given length from a cell of its owner,
+    // together with that owner. Every step of such a path that leaves the
+    // partition adds an overlap cell on both sides of the face.
+    struct Reached
+    {
+        CpGrid::Codim<0>::Entity cell;
+        int index;
+        int owner;
+    };
+    auto compareReached = [](const Reached& r1, const Reached& r2)
+    {
+        return std::tie(r1.index, r1.owner) < std::tie(r2.index, r2.owner);
+    };
+    auto equalReached = [](const Reached& r1, const Reached& r2)
+    {
+        return r1.index == r2.index && r1.owner == r2.owner;
+    };
+
+    std::vector<Reached> reached, next;
     auto it = validLevel?  grid.template lbegin<0>(level) : grid.template leafbegin<0>();
     const auto& endIt = validLevel?  grid.template lend<0>(level) : grid.template leafend<0>();
-
     for (; it != endIt; ++it) {
-        int index = ix.index(*it);
-        auto owner = cell_part[index];
-        exportProcs.insert(std::make_pair(owner, 0));
-        if ( trans ) {
-            addOverlapLayerNoZeroTrans(grid, index, *it, owner, cell_part, exportList, addCornerCells, layers-1, trans, level);
-        }
-        else {
-            addOverlapLayer(grid, index, *it, owner, cell_part, exportList, addCornerCells, layers-1, level);
+        const int index = ix.index(*it);
+        if ( all || cell_part[index] == mypart ) {
+            reached.push_back({*it, index, cell_part[index]});
         }
     }
-    // remove multiple entries
-    auto compare = [](const std::tuple<int,int,char>& t1, const std::tuple<int,int,char>& t2)
-    {
-        return (std::get<0>(t1) < std::get<0>(t2)) ||
-            ( ! (std::get<0>(t2) < std::get<0>(t1))
-              && (std::get<1>(t1) < std::get<1>(t2)) );
-    };
-
-    auto ownerEnd = exportList.begin() + ownerSize;
-    std::sort(ownerEnd, exportList.end(), compare);
-
-    auto newEnd = std::unique(ownerEnd, exportList.end());
-    exportList.resize(newEnd - exportList.begin());
-
-    for(const auto& entry: importList)
-        importProcs.insert(std::make_pair(std::get<1>(entry), 0));
-    //count entries to send
-    std::for_each(ownerEnd, exportList.end(),
-                  [&exportProcs](const std::tuple<int,int,char>& t){ ++exportProcs[std::get<1>(t)];});
 
-    // communicate number of entries
-    std::vector<MPI_Request> requests(importProcs.size());
-    auto req = requests.begin();
-    int tag = 2387;
-    for(auto&& proc : importProcs)
-    {
-        MPI_Irecv(&(proc.second), 1, MPI_INT, proc.first, tag, cc, &(*req));
-        ++req;
+    for (int layer = 1; layer <= layers; ++layer) {
+        next.clear();
+        for (const auto& r : reached) {
+            const int index = r.index;
+            const int owner = r.owner;
+            forEachOverlapNeighbor(r.cell, validLevel, nullptr, [&](const auto& nb) {
+                const int nb_index = ix.index(nb);
+                if ( cell_part[nb_index] == owner )
+                    return;
+                cell_overlap[nb_index].insert(owner);
+                cell_overlap[index].insert(cell_part[nb_index]);
+                if ( layer < layers ) {
+                    next.push_back({nb, nb_index, owner});
+                    return;
+                }
+                // Add cells to the overlap that just share a corner with cell.
+                forEachOverlapNeighbor(nb, validLevel, nullptr, [&](const auto& nb2) {
+                    const int nb2_index = ix.index(nb2);
+                    if ( cell_part[nb2_index] != owner && shareCorner(ix, r.cell, nb2) ) {
+                        cell_overlap[nb2_index].insert(owner);
+                        cell_overlap[index].insert(cell_part[nb2_index]);
+                    }
+                });
+            });
+        }
+        std::sort(next.begin(), next.end(), compareReached);
+        next.erase(std::unique(next.begin(), next.end(), equalReached), next.end());
+        std::swap(reached, next);
     }
+}
 
-    for(const auto& proc: exportProcs)
-    {
-        MPI_Send(&(proc.second), 1, MPI_INT, proc.first, tag, cc);
+std::vector<std::vector<int>> computeDistributedOverlapProcesses([[maybe_unused]] const cpgrid::CpGridData& view,
+                                                                 [[maybe_unused]] const Communication<Dune::MPIHelper::MPICommunicator>& cc,
+                                                                 [[maybe_unused]] bool addCornerCells,
+                                                                 [[maybe_unused]] const double* trans,
+                                                                 [[maybe_unused]] int layers)
+{
+    const int numCells = view.size(0);
+    std::vector<std::vector<int>> processes(numCells);
+#if HAVE_MPI
+    std::vector<char> owned(numCells, false);
+    std::vector<int> ownedCells;
+    for (const auto& index : view.cellIndexSet()) {
+        if ( index.local().attribute() == cpgrid::CpGridData::AttributeSet::owner ) {
+            owned[index.local().local()] = true;
+        }
     }
-    std::vector<MPI_Status> statuses(requests.size());
-    MPI_Waitall(requests.size(), requests.data(), statuses.data());
-
-    // Communicate overlap entries
-    ++tag;
-    std::vector<std::vector<int> > receiveBuffers(importProcs.size());
-    auto buffer = receiveBuffers.begin();
-    req = requests.begin();
-
-    for(auto&& proc: importProcs)
-    {
-        buffer->resize(proc.second);
-        MPI_Irecv(buffer->data(), proc.second, MPI_INT, proc.first, tag, cc, &(*req));
-        ++req; ++buffer;
+    for (int index = 0; index < numCells; ++index) {
+        if ( owned[index] ) {
+            ownedCells.push_back(index);
+            processes[index].push_back(cc.rank());
+        }
+    }
+    if ( cc.size() == 1 ) {
+        return processes;
+    }
+    const auto& ids = view.globalIdSet();
+
+    // Faces between partitions are paired by a process determined by their
+    // global id, which tells both sides the cell and owner across the face.
+    std::map<int, std::vector<int>> faces;
+    for (const int index : ownedCells) {
+        const cpgrid::Entity<0> e(view, index, true);
+        for (auto iit = e.ileafbegin(); iit != e.ileafend(); ++iit) {
+            if ( !iit->boundary() && !(iit->neighbor() && owned[iit->outside().index()]) ) {
+                const int face = ids.idLevelZero(cpgrid::EntityRep<1>(iit->id(), true));
+                auto& message = faces[face % cc.size()];
+                message.push_back(face);
+                message.push_back(ids.id(e));
+            }
+        }
     }
 
-    for(const auto& proc: exportProcs)
+    std::map<int, std::vector<int>> pairs;
     {
-        std::vector<int> sendBuffer;
-        sendBuffer.reserve(proc.second);
-        std::for_each(ownerEnd, exportList.end(),
-                      [&sendBuffer, &proc](const std::tuple<int,int,char>& t)
-                      {
-                          if ( std::get<1>(t) == proc.first )
-                              sendBuffer.push_back(std::get<0>(t));
-                      });
-        MPI_Send(sendBuffer.data(), proc.second, MPI_INT, proc.first, tag, cc);
+        // Face id mapped to the pairs of owner and cell id on both sides.
+        std::unordered_map<int, std::vector<std::pair<int,int>>> sides;
+        for (const auto& [proc, message] : exchangeOverlapMessages(faces, cc)) {
+            for (std::size_t i = 0; i < message.size(); i += 2) {
+                sides[message[i]].emplace_back(proc, message[i + 1]);
+            }
+        }
+        for (const auto& [face, side] : sides) {
+            if ( side.size() != 2 ) {
+                OPM_THROW(std::logic_error, "Face " + std::to_string(face) + " between partitions has "
+                          + std::to_string(side.size()) + " cells instead of 2.");
+            }
+            for (int i = 0; i < 2; ++i) {
+                auto& message = pairs[side[i].first];
+                message.push_back(face);
+                message.push_back(side[1 - i].second);
+                message.push_back(side[1 - i].first);
+            }
+        }
     }
 
-    std::inplace_merge(exportList.begin(), ownerEnd, exportList.end());
+    std::unordered_map<int, std::pair<int,int>> remote;
+    for (const auto& [proc, message] : exchangeOverlapMessages(pairs, cc)) {
+        for (std::size_t i = 0; i < message.size(); i += 3) {
+            remote.emplace(message[i], std::make_pair(message[i + 1], message[i + 2]));
+        }
+    }
 
-    MPI_Waitall(requests.size(), requests.data(), statuses.data());
-    buffer = receiveBuffers.begin();
-    auto importOwnerSize = importList.size();
+    std::vector<int> block;
+    for (const int index : ownedCells) {
+        appendOverlapRecord(block, view, cpgrid::Entity<0>(view, index, true),
+                            cc.rank(), owned, remote, trans);
+    }
+    OverlapGraph graph;
+    const auto ownedIds = graph.add(block);
+    block = std::vector<int>();
+
+    // Each owner learns which processes store its cells as overlap.
+    std::map<int, std::vector<int>> overlap;
+    for (const auto& [owner, cell, part] : growOverlap(graph, ownedIds, cc.rank(), addCornerCells, layers, cc)) {
+        auto& message = overlap[owner];
+        message.push_back(cell);
+        message.push_back(part);
+    }
 
-    for(const auto& proc: importProcs)
-    {
-        for(const auto& index: *buffer)
-            importList.emplace_back(index, proc.first, AttributeSet::copy, -1);
-        ++buffer;
-    }
-    std::sort(importList.begin() + importOwnerSize, importList.end(),
-              [](const std::tuple<int,int,char,int>& t1, const std::tuple<int,int,char,int>& t2)
-              { return std::get<0>(t1) < std::get<0>(t2);});
-    return importOwnerSize;
-#else
-    DUNE_THROW(InvalidStateException, "MPI is missing from the system");
-
-    return 0;
+    std::unordered_map<int, int> localIndex;
+    localIndex.reserve(ownedCells.size());
+    for (std::size_t i = 0; i < ownedCells.size(); ++i) {
+        localIndex.emplace(ownedIds[i], ownedCells[i]);
+    }
+    for (const auto& [proc, message] : exchangeOverlapMessages(overlap, cc)) {
+        for (std::size_t i = 0; i < message.size(); i += 2) {
+            processes[localIndex.at(message[i])].push_back(message[i + 1]);
+        }
+    }
+    for (auto& procs : processes) {
+        std::sort(procs.begin(), procs.end());
+        procs.erase(std::unique(procs.begin(), procs.end()), procs.end());
+    }
 #endif
+    return processes;
 }
 
 namespace cpgrid
@@ -42,6 +42,7 @@
 #include <array>
 #include <set>
 #include <tuple>
+#include <utility>
 
 #include <dune/common/parallel/mpihelper.hh>
 
@@ -53,6 +54,10 @@ namespace Dune
 {
 
     class CpGrid;
+    namespace cpgrid
+    {
+        class CpGridData;
+    }
 
     struct OrderByFirst
     {
@@ -79,6 +84,106 @@ namespace Dune
                    bool recursive = false,
                    bool ensureConnectivity = true);
 
+    /// Rebalance the partitioning of a distributed grid by moving cells across the
+    /// boundaries of overloaded processes.
+    ///
+    /// Has to be called on all processes of the grid and only uses their distributed
+    /// views. In each sweep a process whose load exceeds imbalanceTol times the average
+    /// load hands owned cells at its boundary to the least loaded neighbouring process,
+    /// as long as this reduces the difference of the two loads. The load sent to a
+    /// neighbour in one sweep is limited to the difference of the loads divided by one
+    /// plus the larger number of neighbouring processes of the two, such that concurrent
+    /// sends cannot overload the receiver. Only the owner decides about a cell, hence
+    /// each cell moves at most once. No process gives away its last owned cell, so no
+    /// process is left without cells.
+    /// @param[in] grid the grid in its distributed view
+    /// @param[out] cell_part for each cell of the distributed view the rank of the process
+    ///                       owning it after rebalancing, the same on all copies of a cell
+    /// @param[in] cell_weights for each cell of the distributed view its load, only the
+    ///                         values of owned cells are used
+    /// @param[in] imbalanceTol the accepted ratio of the largest to the average load
+    /// @param[in] max_sweeps the maximum number of layers of cells to move
+    /// @return the number of cells that changed their owner on all processes
+    int diffusePartition(const CpGrid& grid,
+                         std::vector<int>& cell_part,
+                         const std::vector<double>& cell_weights,
+                         double imbalanceTol,
+                         int max_sweeps = 100);
+
+    /// \brief Computes the processes that store each cell of a distributed grid after
+    ///        it is repartitioned.
+    ///
+    /// Has to be called on all processes of the grid and only uses their distributed
+    /// views. The layers are grown by letting the owner of each cell merge the processes
+    /// of its face neighbours and sending the result to the copies of the cell. Hence
+    /// each layer costs one pass over the owned cells and one exchange with the
+    /// neighbouring processes. Corner cells are found by merging the processes at the
+    /// points of the cells, exchanged among all processes sharing the point.
+    /// \param[in] grid The grid in its distributed view. Its overlap needs to contain
+    ///                 the face neighbours of all owned cells.
+    /// \param[in] cell_part For each cell of the distributed view the rank of its new
+    ///                      owner, the same on all copies of a cell.
+    /// \param[in] addCornerCells Whether to add the cells to the last layer that only
+    ///                           share a point with the owned cells or previous layers.
+    /// \param[in] layers The number of overlap layers.
+    /// \return For each cell of the distributed view the sorted ranks of the processes
+    ///         storing it after repartitioning, including its new owner.
+    std::vector<std::vector<int>> computeOverlapProcesses(const CpGrid& grid,
+                                                          const std::vector<int>& cell_part,
+                                                          bool addCornerCells,
+                                                          int layers);
+
+    /// \brief Computes the overlap cells of all partitions.
+    ///
+    /// The first layer is found in a single pass over all cells, each further
+    /// layer only visits the neighbours of the previous one. The result is kept
+    /// in a flat sorted vector, no per cell sets are needed. This runs serially
+    /// on the grid, see computeDistributedOverlapProcesses() for the parallel version.
+    /// \param[in] grid The grid that is partitioned.
+    /// \param[in] cell_part a vector containing each cells partition number.
+    /// \param[in] addCornerCells Whether to add the cells that only share a
+    ///            corner with the outermost layer.
+    /// \param[in] trans The transmissibilities on cell faces. When trans[i]==0,
+    ///            the overlap does not grow over face i. May be nullptr.
+    /// \param[in] layers Number of overlap layers
+    /// \param[in] level Indicating level grid that is partitioned. Default -1 for leaf grid view.
+    /// \return Pairs of cell index and partition number that the cell is an
+    ///         overlap cell of, sorted and without duplicates.
+    std::vector<std::pair<int,int>> computeOverlapCells(const CpGrid& grid,
+                                                        const std::vector<int>& cell_part,
+                                                        bool addCornerCells,
+                                                        const double* trans,
+                                                        int layers = 1,
+                                                        int level = -1);
+
+    /// \brief Computes the processes that store the owned cells of a distributed grid
+    ///        once the overlap is added to the partitions.
+    ///
+    /// Has to be called on all processes. Only the owned cells of the view are
+    /// used, so it may consist of owned cells only, e.g. right after the cells
+    /// were distributed. Each process first learns the cell and owner across
+    /// each face between partitions, paired by a process chosen by the global
+    /// id of the face. It then grows the overlap of its own partition like
+    /// computeOverlapCells(). The first layer only needs the owned cells.
+    /// Further layers and the corner cells need the points and neighbours of
+    /// the cells of the previous layer, which are requested from the processes
+    /// owning them. Finally each owner is told which processes store its cells.
+    /// Only processes sharing cells near the partition interfaces communicate.
+    /// \param[in] view The distributed view.
+    /// \param[in] cc The communication object.
+    /// \param[in] addCornerCells Whether to add the cells that only share a
+    ///            corner with the outermost layer.
+    /// \param[in] trans The transmissibilities on the faces of the view. When
+    ///            trans[i]==0, the overlap does not grow over face i. May be nullptr.
+    /// \param[in] layers Number of overlap layers
+    /// \return For each owned cell of the view the sorted ranks of the processes
+    ///         storing it, including this one. Empty for the other cells.
+    std::vector<std::vector<int>> computeDistributedOverlapProcesses(const cpgrid::CpGridData& view,
+                                                                     const Communication<Dune::MPIHelper::MPICommunicator>& cc,
+                                                                     bool addCornerCells,
+                                                                     const double* trans,
+                                                                     int layers = 1);
+
     /// \brief Adds a layer of overlap cells to a partitioning.
     /// \param[in] grid The grid that is partitioned.
     /// \param[in] cell_part a vector containing each cells partition number.
@@ -97,29 +202,6 @@ namespace Dune
                          bool all=false,
                          int level = -1);
 
-    /// \brief Adds a layer of overlap cells to a partitioning.
-    /// \param[in] grid The grid that is partitioned.
-    /// \param[in] cell_part a vector containing each cells partition number.
-    /// \param[inout] exportList List indices to export, each entry is a tuple
-    /// of global index, process rank (to export to), attribute on remote.
-    /// \param[inout] importList List indices to import, each entry is a tuple
-    /// of global index, process rank (to import from), attribute here, local
-    /// index here
-    /// \param[in] cc The communication object
-    /// \param[in] addCornerCells Switch for adding corner cells to overlap layer.
-    /// \param[in] trans The transmissibilities on cell faces. When trans[i]==0, no overlap is added.
-    /// \param[in] layers Number of overlap layers
-    /// \param[in] level Indicating level grid that is partitioned. Default -1 for leaf grid view.
-    int addOverlapLayer(const CpGrid& grid,
-                        const std::vector<int>& cell_part,
-                        std::vector<std::tuple<int,int,char>>& exportList,
-                        std::vector<std::tuple<int,int,char,int>>& importList,
-                        const Communication<Dune::MPIHelper::MPICommunicator>& cc,
-                        bool addCornerCells,
-                        const double* trans,
-                        int layers = 1,
-                        int level = -1);
-
 namespace cpgrid
 {
 #if HAVE_MPI
@@ -408,6 +408,76 @@ void findconnections(bool edge_conformal,
     }
 }
 
+
+/* Upper bounds on the number of faces, intersections and face nodes that
+ * findconnections() creates for the same pillar pair.  Visits the same
+ * pairs of a- and b-cells as findconnections(), without computing the
+ * intersections.  Each pair with nonzero intersection yields at most one
+ * face and one intersection.  A face has at most eight nodes, plus the
+ * hanging pillar nodes strictly inside its span on either pillar if
+ * edge_conformal is true. */
+void connectionbounds(bool edge_conformal,
+                      int n,
+                      int *pts[4],
+                      size_t *nfaces,
+                      size_t *nnodes)
+{
+    const int *a1 = pts[0];
+    const int *a2 = pts[1];
+    const int *b1 = pts[2];
+    const int *b2 = pts[3];
+
+    int k1 = 0;
+    int k2 = 0;
+
+    int i, j = 0;
+    long hanging;
+
+    *nfaces = 0;
+    *nnodes = 0;
+
+    for (i = 0; i < n - 1; ++i) {
+
+        /* pinched a-cell */
+        if ((a1[i] == a1[i + 1]) &&
+            (a2[i] == a2[i + 1])) {
+            continue;
+        }
+
+        while ((j < n-1) &&
+               ((b1[j] < a1[i + 1]) ||
+                (b2[j] < a2[i + 1])))
+        {
+            /* pinched b-cell */
+            if ((b1[j] == b1[j + 1]) &&
+                (b2[j] == b2[j + 1])) {
+                ++j;
+                continue;
+            }
+
+            if (faceintersection(a1+i, a2+i, b1+j, b2+j)) {
+                *nfaces += 1;
+                *nnodes += 8;
+
+                if (edge_conformal && MEANINGFUL_FACE(i, j)) {
+                    hanging = (long) MIN(a1[i+1], b1[j+1]) - MAX(a1[i], b1[j]) - 1;
+                    *nnodes += (hanging > 0) ? (size_t) hanging : 0;
+
+                    hanging = (long) MIN(a2[i+1], b2[j+1]) - MAX(a2[i], b2[j]) - 1;
+                    *nnodes += (hanging > 0) ? (size_t) hanging : 0;
+                }
+            }
+
+            if (b1[j] < a1[i+1]) { k1 = j; }
+            if (b2[j] < a2[i+1]) { k2 = j; }
+
+            j = j+1;
+        }
+
+        j = MIN(k1, k2);
+    }
+}
+
 /* Local Variables:    */
 /* c-basic-offset:4    */
 /* End:                */
@@ -36,6 +36,7 @@
 #define OPM_FACETOPOLOGY_HEADER
 
 #include <stdbool.h>
+#include <stddef.h>
 
 struct processed_grid;
 
@@ -46,6 +47,12 @@ void findconnections(bool edge_conformal,
                      int *work,
                      struct processed_grid *out);
 
+void connectionbounds(bool edge_conformal,
+                      int n,
+                      int *pts[4],
+                      size_t *nfaces,
+                      size_t *nnodes);
+
 #endif /* OPM_FACETOPOLOGY_HEADER */
 
 /* Local Variables:    */
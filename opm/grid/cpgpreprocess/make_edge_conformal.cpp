@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -368,6 +369,20 @@ int make_edge_conformal(struct processed_grid* grid)
 
         fix_edges_at_top(*grid, faceNodes, nodePos);
 
+        // process_grdecl() allocates the face nodes at their exact size,
+        // so make room for the hanging nodes added here.
+        if (faceNodes.size() > static_cast<std::size_t>(grid->n)) {
+            auto* face_nodes = static_cast<int*>
+                (std::realloc(grid->face_nodes, faceNodes.size() * sizeof *grid->face_nodes));
+
+            if (face_nodes == nullptr) {
+                return 0;
+            }
+
+            grid->face_nodes = face_nodes;
+            grid->n = static_cast<int>(faceNodes.size());
+        }
+
         std::copy_n(nodePos.begin(), grid->number_of_faces + 1, grid->face_node_ptr);
         std::copy_n(faceNodes.begin(), grid->face_node_ptr[grid->number_of_faces], grid->face_nodes);
     }
@@ -54,32 +54,9 @@ static void
 compute_cell_index(const int dims[3], int i, int j, int *neighbors, int len);
 
 static int
-checkmemory(size_t nz,
-            struct processed_grid *out,
-            int **intersections);
-
-/*-----------------------------------------------------------------
-  For each vertical face (i.e. i or j constant),
-  -find point numbers for the corners and
-  -cell neighbours.
-  -new points on faults defined by two intersecting lines.
-
-  direction == 0 : constant-i faces (parallel to J-K plane).
-  direction == 1 : constant-j faces (parallel to I-K plane).
-*/
-static void
-process_vertical_faces(bool edge_conformal,
-                       int direction,
-                       int **intersections,
-                       int *plist, int *work,
-                       struct processed_grid *out);
-
-static void
-process_horizontal_faces(bool pinchActive,
-                         int **intersections,
-                         int *plist,
-                         const int *is_aquifer_cell,
-                         struct processed_grid *out);
+reservememory(size_t m, size_t n,
+              struct processed_grid *out,
+              int **intersections);
 
 static int
 linearindex(const int dims[3], int i, int j, int k)
@@ -162,31 +139,16 @@ compute_cell_index(const int dims[3], int i, int j,
 
 
 /*-----------------------------------------------------------------
-  Ensure there's sufficient memory */
+  Ensure there's room for at least m faces (and m intersections)
+  and n face nodes.  Existing contents are preserved. */
 static int
-checkmemory(size_t nz,
-            struct processed_grid *out,
-            int **intersections)
+reservememory(size_t m, size_t n,
+              struct processed_grid *out,
+              int **intersections)
 {
-    size_t r, m, n;
     bool ok;
 
-    /* Ensure there is enough space to manage the (pathological) case
-     * of every single cell on one side of a fault connecting to all
-     * cells on the other side of the fault (i.e., an all-to-all cell
-     * connectivity pairing). */
-    r = (2*nz + 2) * (2*nz + 2);
-    m = out->m;
-    n = out->n;
-
-    if (out->number_of_faces +  r > m) {
-        m += MAX(m / 2,  2 * r);
-    }
-    if (out->face_node_ptr[out->number_of_faces] + 6*r > n) {
-        n += MAX(n / 2, 12 * r);
-    }
-
-    ok = m == ((size_t)(out->m));
+    ok = m <= ((size_t)(out->m));
     if (! ok) {
         void *p1, *p2, *p3, *p4;
 
@@ -205,7 +167,7 @@ checkmemory(size_t nz,
         if (ok) { out->m = m; }
     }
 
-    if (ok && (n != ((size_t)(out->n)))) {
+    if (ok && (n > ((size_t)(out->n)))) {
         void *p1;
 
         p1 = realloc(out->face_nodes, n * sizeof *out->face_nodes);
@@ -221,128 +183,122 @@ checkmemory(size_t nz,
     return ok;
 }
 
+
+/*-----------------------------------------------------------------
+  Find the point numbers along the four pillar corners of the pillar
+  pair of process_vertical_pillar_pair(), in the order expected by
+  findconnections().
+*/
+static void
+pillar_pair_corners(int direction, int i, int j,
+                    const int dims[3], int *plist,
+                    int *cornerpts[4])
+{
+    int d[3];
+    int *tmp;
+
+    d[0] = 2 * (dims[0] + 0);
+    d[1] = 2 * (dims[1] + 0);
+    d[2] = 2 * (dims[2] + 1);
+
+    /* Vectors of point numbers */
+    igetvectors(d, 2*i + direction, 2*j + (1 - direction),
+                plist, cornerpts);
+
+    if (direction == 1) {
+        /* 1   3       0   1    */
+        /*       --->           */
+        /* 0   2       2   3    */
+        /* rotate clockwise     */
+        tmp          = cornerpts[1];
+        cornerpts[1] = cornerpts[0];
+        cornerpts[0] = cornerpts[2];
+        cornerpts[2] = cornerpts[3];
+        cornerpts[3] = tmp;
+    }
+}
+
+
 /*-----------------------------------------------------------------
-  For each vertical face (i.e. i or j constant),
-  -find point numbers for the corners and
-  -cell neighbours.
-  -new points on faults defined by two intersecting lines.
+  Find the connections (faces) along a single pair of pillars and
+  append them to out.  The pillar pair is identified by the
+  Cartesian index (i,j) of the cell on the "positive" side of the
+  faces.  Caller must ensure there's sufficient memory.
 
   direction == 0 : constant-i faces (parallel to J-K plane).
   direction == 1 : constant-j faces (parallel to I-K plane).
 */
 static void
-process_vertical_faces(bool edge_conformal,
-                       int direction,
-                       int **intersections,
-                       int *plist, int *work,
-                       struct processed_grid *out)
+process_vertical_pillar_pair(bool edge_conformal,
+                             int direction,
+                             int i, int j,
+                             int *intersections,
+                             int *plist, int *work,
+                             struct processed_grid *out)
 {
-    int i,j;
     int *cornerpts[4];
-    int d[3];
     unsigned f;
     const enum face_tag tag[] = { I_FACE, J_FACE };
-    int *tmp;
-    int nx = out->dimensions[0];
-    int ny = out->dimensions[1];
     int nz = out->dimensions[2];
     int startface;
     int num_intersections;
     int *ptr;
     int len;
 
-    assert ((direction == 0) || (direction == 1));
+    pillar_pair_corners(direction, i, j, out->dimensions, plist, cornerpts);
 
-    d[0] = 2 * (nx + 0);
-    d[1] = 2 * (ny + 0);
-    d[2] = 2 * (nz + 1);
+    /* int startface = ftab->position; */
+    startface = out->number_of_faces;
+    /* int num_intersections = *npoints - npillarpoints; */
+    num_intersections = out->number_of_nodes -
+        out->number_of_nodes_on_pillars;
 
-    for (j = 0; j < ny + direction; ++j) {
-        for (i = 0; i < nx + (1 - direction); ++i) {
+    /* Establish new connections (faces) along pillar pair. */
+    findconnections(edge_conformal, 2*nz + 2, cornerpts,
+                    intersections + 4*num_intersections,
+                    work, out);
 
-            if (! checkmemory(nz, out, intersections)) {
-                fprintf(stderr,
-                        "Could not allocate enough space in "
-                        "process_vertical_faces()\n");
-                exit(1);
-            }
+    /* Start of ->face_neighbors[] for this set of connections. */
+    ptr = out->face_neighbors + 2*startface;
 
-            /* Vectors of point numbers */
-            igetvectors(d, 2*i + direction, 2*j + (1 - direction),
-                        plist, cornerpts);
-
-            if (direction == 1) {
-                /* 1   3       0   1    */
-                /*       --->           */
-                /* 0   2       2   3    */
-                /* rotate clockwise     */
-                tmp          = cornerpts[1];
-                cornerpts[1] = cornerpts[0];
-                cornerpts[0] = cornerpts[2];
-                cornerpts[2] = cornerpts[3];
-                cornerpts[3] = tmp;
-            }
+    /* Total number of cells (both sides) connected by this
+     * set of connections (faces). */
+    len = 2*out->number_of_faces - 2*startface;
 
-            /* int startface = ftab->position; */
-            startface = out->number_of_faces;
-            /* int num_intersections = *npoints - npillarpoints; */
-            num_intersections = out->number_of_nodes -
-                out->number_of_nodes_on_pillars;
-
-            /* Establish new connections (faces) along pillar pair. */
-            findconnections(edge_conformal, 2*nz + 2, cornerpts,
-                            *intersections + 4*num_intersections,
-                            work, out);
-
-            /* Start of ->face_neighbors[] for this set of connections. */
-            ptr = out->face_neighbors + 2*startface;
-
-            /* Total number of cells (both sides) connected by this
-             * set of connections (faces). */
-            len = 2*out->number_of_faces - 2*startface;
-
-            /* Derive inter-cell connectivity (i.e. ->face_neighbors)
-             * of global (uncompressed) cells for this set of
-             * connections (faces). */
-            compute_cell_index(out->dimensions, i-1+direction, j-direction, ptr    , len);
-            compute_cell_index(out->dimensions, i            , j          , ptr + 1, len);
-
-            /* Tag the new faces */
-            f = startface;
-            for (; f < out->number_of_faces; ++f) {
-                out->face_tag[f] = tag[direction];
-            }
-        }
+    /* Derive inter-cell connectivity (i.e. ->face_neighbors)
+     * of global (uncompressed) cells for this set of
+     * connections (faces). */
+    compute_cell_index(out->dimensions, i-1+direction, j-direction, ptr    , len);
+    compute_cell_index(out->dimensions, i            , j          , ptr + 1, len);
+
+    /* Tag the new faces */
+    f = startface;
+    for (; f < out->number_of_faces; ++f) {
+        out->face_tag[f] = tag[direction];
     }
 }
 
 
 /*-----------------------------------------------------------------
-  For each horizontal face (i.e. k constant),
-  -find point numbers for the corners and
-  -cell neighbors.
-
-  Also define map from logically Cartesian
-  cell index to local cell index 0, ..., #<active cells>.   Exclude
-  cells that are have collapsed coordinates. (This includes cells with
-  ACTNUM==0)
-
+  Find the horizontal faces of the single pillar column (i,j) and
+  append them to out.  Cells of the column are numbered
+  consecutively from *cellno in cell[], collapsed cells get -1.
+  Caller must ensure there's sufficient memory.
 */
 static void
-process_horizontal_faces(bool pinchActive,
-                         int **intersections,
-                         int *plist,
-                         const int *is_aquifer_cell,
-                         struct processed_grid *out)
+process_horizontal_column(bool pinchActive,
+                          int i, int j,
+                          int *plist,
+                          const int *is_aquifer_cell,
+                          int *cell, int *cellno,
+                          struct processed_grid *out)
 {
-    int i,j,k;
+    int k;
 
     int nx = out->dimensions[0];
     int ny = out->dimensions[1];
     int nz = out->dimensions[2];
 
-    int *cell  = out->local_cell_index;
-    int cellno = 0;
     int *f, *n, *c[4];
     int prevcell, thiscell;
     int idx;
@@ -353,75 +309,50 @@ process_horizontal_faces(bool pinchActive,
     d[1] = 2*ny;
     d[2] = 2+2*nz;
 
-
-    for (j=0; j<ny; ++j) {
-        for (i=0; i<nx; ++i) {
-
-            if (! checkmemory(nz, out, intersections)) {
-                fprintf(stderr,
-                        "Could not allocate enough space in "
-                        "process_horizontal_faces()\n");
-                exit(1);
-            }
-
-            f = out->face_nodes     + out->face_node_ptr[out->number_of_faces];
-            n = out->face_neighbors + 2*out->number_of_faces;
+    f = out->face_nodes     + out->face_node_ptr[out->number_of_faces];
+    n = out->face_neighbors + 2*out->number_of_faces;
 
 
-            /* Vectors of point numbers */
-            igetvectors(d, 2*i+1, 2*j+1, plist, c);
+    /* Vectors of point numbers */
+    igetvectors(d, 2*i+1, 2*j+1, plist, c);
 
-            prevcell = -1;
+    prevcell = -1;
 
 
-            for (k = 1; k<nz*2+1; ++k){
-                idx = linearindex(out->dimensions, i,j,(k-1)/2);
+    for (k = 1; k<nz*2+1; ++k){
+        idx = linearindex(out->dimensions, i,j,(k-1)/2);
 
-                /* Skip if space between face k and face k+1 is collapsed. */
-                /* Note that inactive cells (with ACTNUM==0) have all been  */
-                /* collapsed in finduniquepoints.                           */
-                /* we keep aquifer cells active always even the cells have zero thickness or volume */
-                if (c[0][k] == c[0][k+1] && c[1][k] == c[1][k+1] &&
-                    c[2][k] == c[2][k+1] && c[3][k] == c[3][k+1] && !(is_aquifer_cell && is_aquifer_cell[idx])){
+        /* Skip if space between face k and face k+1 is collapsed. */
+        /* Note that inactive cells (with ACTNUM==0) have all been  */
+        /* collapsed in finduniquepoints.                           */
+        /* we keep aquifer cells active always even the cells have zero thickness or volume */
+        if (c[0][k] == c[0][k+1] && c[1][k] == c[1][k+1] &&
+            c[2][k] == c[2][k+1] && c[3][k] == c[3][k+1] && !(is_aquifer_cell && is_aquifer_cell[idx])){
 
-                     if (k%2) {
-                        cell[idx] = -1;
-                    }
-                }
-                else{
-
-                    if (k%2){
-                        thiscell = idx;
-                        if (!pinchActive && !vertical_cart_neighbors(out->dimensions, thiscell, prevcell) && prevcell != -1) {
-                            /* We must also add the bottom face of the cell above the inactive area (prevcell).
-                               That face, and the top face of thiscell, are identical geometrically,
-                               yet their adjacent cells are not considered neighbors. I.e. the faces' neighbors are
-                                 (prevcell, -1) and (-1, thiscell).
-                               However, this extra face must only be added for the case when the two faces are the same.
-                               If the top face of thiscell is distinct from the bottom face of prevcell, then the else
-                               branch below takes care of it. */
-                            assert(out->number_of_faces > 0);
-                            if (out->face_neighbors[2*out->number_of_faces - 1] == -1) {
-                                /* The (prevcell, -1) face was already added. */
-                                assert(out->face_neighbors[2*out->number_of_faces - 2] == prevcell);
-                            } else {
-                                /* The last added face was the top face (x, prevcell) of prevcell, where
-                                   x can be either -1 or a cell index, so we can only check the second neighbor */
-                                assert(out->face_neighbors[2*out->number_of_faces - 1] == prevcell);
-
-                                /* Add face */
-                                *f++ = c[0][k];
-                                *f++ = c[2][k];
-                                *f++ = c[3][k];
-                                *f++ = c[1][k];
-
-                                out->face_tag[  out->number_of_faces] = K_FACE;
-                                out->face_node_ptr[++out->number_of_faces] = f - out->face_nodes;
-
-                                *n++ = prevcell;
-                                *n++ = -1;
-                            }
-                        }
+             if (k%2) {
+                cell[idx] = -1;
+            }
+        }
+        else{
+
+            if (k%2){
+                thiscell = idx;
+                if (!pinchActive && !vertical_cart_neighbors(out->dimensions, thiscell, prevcell) && prevcell != -1) {
+                    /* We must also add the bottom face of the cell above the inactive area (prevcell).
+                       That face, and the top face of thiscell, are identical geometrically,
+                       yet their adjacent cells are not considered neighbors. I.e. the faces' neighbors are
+                         (prevcell, -1) and (-1, thiscell).
+                       However, this extra face must only be added for the case when the two faces are the same.
+                       If the top face of thiscell is distinct from the bottom face of prevcell, then the else
+                       branch below takes care of it. */
+                    assert(out->number_of_faces > 0);
+                    if (out->face_neighbors[2*out->number_of_faces - 1] == -1) {
+                        /* The (prevcell, -1) face was already added. */
+                        assert(out->face_neighbors[2*out->number_of_faces - 2] == prevcell);
+                    } else {
+                        /* The last added face was the top face (x, prevcell) of prevcell, where
+                           x can be either -1 or a cell index, so we can only check the second neighbor */
+                        assert(out->face_neighbors[2*out->number_of_faces - 1] == prevcell);
 
                         /* Add face */
                         *f++ = c[0][k];
@@ -432,32 +363,401 @@ process_horizontal_faces(bool pinchActive,
                         out->face_tag[  out->number_of_faces] = K_FACE;
                         out->face_node_ptr[++out->number_of_faces] = f - out->face_nodes;
 
-                        *n++ = (pinchActive || vertical_cart_neighbors(out->dimensions, thiscell, prevcell)) ? prevcell : -1;
-                        *n++ = prevcell = thiscell;
+                        *n++ = prevcell;
+                        *n++ = -1;
+                    }
+                }
 
-                        cell[thiscell] = cellno++;
+                /* Add face */
+                *f++ = c[0][k];
+                *f++ = c[2][k];
+                *f++ = c[3][k];
+                *f++ = c[1][k];
 
-                    }
-                    else{
-                        if (prevcell != -1){
-                            /* Add face */
-                            *f++ = c[0][k];
-                            *f++ = c[2][k];
-                            *f++ = c[3][k];
-                            *f++ = c[1][k];
-
-                            out->face_tag[  out->number_of_faces] = K_FACE;
-                            out->face_node_ptr[++out->number_of_faces] = f - out->face_nodes;
-
-                            *n++ = prevcell;
-                            *n++ = prevcell = -1;
-                        }
-                    }
+                out->face_tag[  out->number_of_faces] = K_FACE;
+                out->face_node_ptr[++out->number_of_faces] = f - out->face_nodes;
+
+                *n++ = (pinchActive || vertical_cart_neighbors(out->dimensions, thiscell, prevcell)) ? prevcell : -1;
+                *n++ = prevcell = thiscell;
+
+                cell[thiscell] = (*cellno)++;
+
+            }
+            else{
+                if (prevcell != -1){
+                    /* Add face */
+                    *f++ = c[0][k];
+                    *f++ = c[2][k];
+                    *f++ = c[3][k];
+                    *f++ = c[1][k];
+
+                    out->face_tag[  out->number_of_faces] = K_FACE;
+                    out->face_node_ptr[++out->number_of_faces] = f - out->face_nodes;
+
+                    *n++ = prevcell;
+                    *n++ = prevcell = -1;
                 }
             }
         }
     }
-    out->number_of_cells = cellno;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Two-pass face processing.
+ *
+ * Faces are generated per "face unit": a pillar pair of constant-i
+ * faces, a pillar pair of constant-j faces, or a pillar column of
+ * horizontal faces.  Units are numbered in the order of the original
+ * serial loops, i.e., all constant-i pairs, then all constant-j pairs
+ * and finally all columns.
+ *
+ * The counting pass processes every unit into a per-thread scratch face
+ * list, sized by upper bounds on the unit's own counts, and records the unit's number of faces, face nodes and
+ * intersections.  Exclusive prefix sums of these counts give each
+ * unit's position in the final arrays, which are then allocated once at
+ * their exact sizes.  The filling pass processes every unit again,
+ * directly into its final position.  Units are independent of each
+ * other, so both passes run concurrently and the result does not depend
+ * on the number of threads.
+ * ---------------------------------------------------------------------- */
+
+/* Number of counts per face unit in the count/offset table. */
+#define UNIT_COUNTS 3
+
+struct face_units {
+    int    npairs[2];   /* Pillar pairs per direction */
+    int    nrow[2];     /* Pillar pairs per row of pairs */
+    int    ncolumns;    /* Pillar columns */
+    size_t total;
+};
+
+
+/* ---------------------------------------------------------------------- */
+static struct face_units
+get_face_units(const int dims[3])
+/* ---------------------------------------------------------------------- */
+{
+    struct face_units u;
+
+    u.nrow[0]   = dims[0] + 1;
+    u.nrow[1]   = dims[0];
+    u.npairs[0] = u.nrow[0] * dims[1];
+    u.npairs[1] = u.nrow[1] * (dims[1] + 1);
+    u.ncolumns  = dims[0] * dims[1];
+    u.total     = (size_t) u.npairs[0] + (size_t) u.npairs[1] + (size_t) u.ncolumns;
+
+    return u;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Generate the faces of a single face unit into 'g', which must hold no
+ * faces on entry and have room for all of the unit's faces.  Cells of a
+ * pillar column are counted in *cellno. */
+/* ---------------------------------------------------------------------- */
+static void
+process_face_unit(bool edge_conformal, bool pinchActive,
+                  const struct face_units *units, size_t unit,
+                  int *intersections, int *plist, int *work,
+                  const int *is_aquifer_cell, int *cell, int *cellno,
+                  struct processed_grid *g)
+/* ---------------------------------------------------------------------- */
+{
+    size_t k;
+    int    direction, p;
+
+    /* Intersection records must not leak between pillar pairs. */
+    for (k = 0; k < 2 * ((size_t) (2*g->dimensions[2] + 2)); ++k) { work[k] = -1; }
+
+    if (unit < (size_t) (units->npairs[0] + units->npairs[1])) {
+        direction = unit >= (size_t) units->npairs[0];
+        p         = (int) unit - direction*units->npairs[0];
+
+        process_vertical_pillar_pair(edge_conformal, direction,
+                                     p % units->nrow[direction],
+                                     p / units->nrow[direction],
+                                     intersections, plist, work, g);
+    }
+    else {
+        p = (int) (unit - units->npairs[0] - units->npairs[1]);
+
+        /* Columns own disjoint parts of 'cell'.  Only the -1 markers
+         * and the total count matter, so unit-local cell numbering is
+         * fine here. */
+        process_horizontal_column(pinchActive,
+                                  p % g->dimensions[0], p / g->dimensions[0],
+                                  plist, is_aquifer_cell, cell, cellno, g);
+    }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Upper bounds on the number of faces (and intersections) and face nodes
+ * of a single face unit.  Used to size the scratch face list of the
+ * counting pass by the unit at hand rather than by the worst case of an
+ * arbitrary pillar pair. */
+/* ---------------------------------------------------------------------- */
+static void
+face_unit_bounds(bool edge_conformal,
+                 const struct face_units *units, size_t unit,
+                 int *plist, const int dims[3],
+                 size_t *nfaces, size_t *nnodes)
+/* ---------------------------------------------------------------------- */
+{
+    int *cornerpts[4];
+    int  direction, p;
+
+    if (unit < (size_t) (units->npairs[0] + units->npairs[1])) {
+        direction = unit >= (size_t) units->npairs[0];
+        p         = (int) unit - direction*units->npairs[0];
+
+        pillar_pair_corners(direction,
+                            p % units->nrow[direction],
+                            p / units->nrow[direction],
+                            dims, plist, cornerpts);
+
+        connectionbounds(edge_conformal, 2*dims[2] + 2, cornerpts,
+                         nfaces, nnodes);
+    }
+    else {
+        /* Top face of every cell, plus the bottom face below it and the
+         * duplicate face above it if not connected to its neighbours. */
+        *nfaces = 3 * (size_t) dims[2];
+        *nnodes = 4 * (*nfaces);
+    }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Counting pass.  On return, counts[UNIT_COUNTS*u + 0..2] hold the number
+ * of faces, face nodes and intersections of face unit 'u'. */
+/* ---------------------------------------------------------------------- */
+static int
+count_face_units(bool edge_conformal, bool pinchActive,
+                 const struct face_units *units,
+                 int *plist, const int *is_aquifer_cell,
+                 struct processed_grid *out,
+                 size_t *counts, int *number_of_cells)
+/* ---------------------------------------------------------------------- */
+{
+    int ok = 1, ncells = 0;
+
+#pragma omp parallel reduction(&&:ok) reduction(+:ncells)
+    {
+        struct processed_grid g;
+        int    *intersections = NULL, *work;
+        long    u;
+
+        memset(&g, 0, sizeof g);
+        g.dimensions[0] = out->dimensions[0];
+        g.dimensions[1] = out->dimensions[1];
+        g.dimensions[2] = out->dimensions[2];
+        g.number_of_nodes_on_pillars = out->number_of_nodes_on_pillars;
+
+        work = malloc(2 * ((size_t) (2*out->dimensions[2] + 2)) * sizeof *work);
+
+        ok = work != NULL;
+
+#pragma omp for schedule(dynamic, 64)
+        for (u = 0; u < (long) units->total; ++u) {
+            size_t nf, nn;
+
+            if (! ok) { continue; }
+
+            face_unit_bounds(edge_conformal, units, u, plist,
+                             out->dimensions, &nf, &nn);
+
+            /* Only grows, so the scratch space is bounded by the largest
+             * unit this thread has processed. */
+            ok = reservememory(MAX(nf, 1), MAX(nn, 1), &g, &intersections);
+            if (ok) {
+                g.number_of_faces  = 0;
+                g.number_of_nodes  = g.number_of_nodes_on_pillars;
+                g.face_node_ptr[0] = 0;
+
+                process_face_unit(edge_conformal, pinchActive, units, u,
+                                  intersections, plist, work,
+                                  is_aquifer_cell, out->local_cell_index,
+                                  &ncells, &g);
+
+                assert(g.number_of_faces <= nf);
+                assert(g.face_node_ptr[g.number_of_faces] <= nn);
+                assert(g.number_of_nodes - g.number_of_nodes_on_pillars <= (int) nf);
+
+                counts[UNIT_COUNTS*u + 0] = g.number_of_faces;
+                counts[UNIT_COUNTS*u + 1] = g.face_node_ptr[g.number_of_faces];
+                counts[UNIT_COUNTS*u + 2] = g.number_of_nodes - g.number_of_nodes_on_pillars;
+            }
+        }
+
+        free(g.face_nodes);
+        free(g.face_node_ptr);
+        free(g.face_neighbors);
+        free(g.face_tag);
+        free(intersections);
+        free(work);
+    }
+
+    *number_of_cells = ncells;
+
+    return ok;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Replace the counts of each face unit by the unit's start positions,
+ * and return the totals in counts[UNIT_COUNTS*total + 0..2]. */
+/* ---------------------------------------------------------------------- */
+static void
+face_unit_offsets(size_t total, size_t *counts)
+/* ---------------------------------------------------------------------- */
+{
+    size_t u, d, sum[UNIT_COUNTS] = { 0 };
+
+    for (u = 0; u <= total; ++u) {
+        for (d = 0; d < UNIT_COUNTS; ++d) {
+            const size_t n = (u < total) ? counts[UNIT_COUNTS*u + d] : 0;
+
+            counts[UNIT_COUNTS*u + d] = sum[d];
+            sum[d] += n;
+        }
+    }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Filling pass.  Every face unit is processed directly into its final
+ * position in out, given by 'offsets'. */
+/* ---------------------------------------------------------------------- */
+static int
+fill_face_units(bool edge_conformal, bool pinchActive,
+                const struct face_units *units,
+                int *plist, const int *is_aquifer_cell,
+                const size_t *offsets, int *intersections,
+                struct processed_grid *out)
+/* ---------------------------------------------------------------------- */
+{
+    size_t u, maxfaces = 0;
+    int    ok = 1;
+
+    for (u = 0; u < units->total; ++u) {
+        maxfaces = MAX(maxfaces, offsets[UNIT_COUNTS*(u + 1)] - offsets[UNIT_COUNTS*u]);
+    }
+
+#pragma omp parallel reduction(&&:ok)
+    {
+        struct processed_grid g;
+        unsigned int *face_node_ptr;
+        int          *work;
+        int           cellno = 0;
+        long          v;
+
+        face_node_ptr = malloc((maxfaces + 1) * sizeof *face_node_ptr);
+        work = malloc(2 * ((size_t) (2*out->dimensions[2] + 2)) * sizeof *work);
+
+        ok = (face_node_ptr != NULL) && (work != NULL);
+
+#pragma omp for schedule(dynamic, 64)
+        for (v = 0; v < (long) units->total; ++v) {
+            const size_t *start = offsets + UNIT_COUNTS*v;
+            const size_t  nf    = start[UNIT_COUNTS + 0] - start[0];
+            size_t        f;
+
+            if (! ok) { continue; }
+
+            /* View of the unit's part of the output arrays.  Face node
+             * offsets are unit-local, and are shifted while copying them
+             * to out, since the unit's first offset is also the previous
+             * unit's last one. */
+            memset(&g, 0, sizeof g);
+            g.dimensions[0] = out->dimensions[0];
+            g.dimensions[1] = out->dimensions[1];
+            g.dimensions[2] = out->dimensions[2];
+            g.number_of_nodes_on_pillars = out->number_of_nodes_on_pillars;
+            g.number_of_nodes = out->number_of_nodes_on_pillars + (int) start[2];
+
+            g.face_nodes     = out->face_nodes     + start[1];
+            g.face_node_ptr  = face_node_ptr;
+            g.face_neighbors = out->face_neighbors + 2*start[0];
+            g.face_tag       = out->face_tag       + start[0];
+            g.face_node_ptr[0] = 0;
+
+            process_face_unit(edge_conformal, pinchActive, units, v,
+                              intersections, plist, work,
+                              is_aquifer_cell, out->local_cell_index,
+                              &cellno, &g);
+
+            ok = (g.number_of_faces == nf) &&
+                 (g.face_node_ptr[nf] == start[UNIT_COUNTS + 1] - start[1]);
+
+            for (f = 0; ok && (f < nf); ++f) {
+                out->face_node_ptr[start[0] + f + 1] =
+                    (unsigned int) (start[1] + g.face_node_ptr[f + 1]);
+            }
+        }
+
+        free(face_node_ptr);
+        free(work);
+    }
+
+    return ok;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Generate all faces of the grid, and the intersections of faulted
+ * pillar pairs, into exactly sized arrays. */
+/* ---------------------------------------------------------------------- */
+static int
+process_faces(bool edge_conformal, bool pinchActive,
+              int **intersections,
+              int *plist,
+              const int *is_aquifer_cell,
+              struct processed_grid *out)
+/* ---------------------------------------------------------------------- */
+{
+    const struct face_units units = get_face_units(out->dimensions);
+
+    size_t *offsets, nf, nn, ni;
+    int     ok, ncells;
+
+    offsets = malloc(UNIT_COUNTS * (units.total + 1) * sizeof *offsets);
+    if (offsets == NULL) {
+        return 0;
+    }
+
+    ok = count_face_units(edge_conformal, pinchActive, &units, plist,
+                          is_aquifer_cell, out, offsets, &ncells);
+
+    if (ok) {
+        face_unit_offsets(units.total, offsets);
+
+        nf = offsets[UNIT_COUNTS*units.total + 0];
+        nn = offsets[UNIT_COUNTS*units.total + 1];
+        ni = offsets[UNIT_COUNTS*units.total + 2];
+
+        /* Space for at least one element, to tell empty grids from
+         * allocation failures. */
+        ok = reservememory(MAX(MAX(nf, ni), 1), MAX(nn, 1), out, intersections);
+    }
+
+    if (ok) {
+        out->face_node_ptr[0] = 0;
+
+        ok = fill_face_units(edge_conformal, pinchActive, &units, plist,
+                             is_aquifer_cell, offsets, *intersections, out);
+    }
+
+    if (ok) {
+        out->number_of_faces = (unsigned) nf;
+        out->number_of_nodes = out->number_of_nodes_on_pillars + (int) ni;
+        out->number_of_cells = ncells;
+    }
+
+    free(offsets);
+
+    return ok;
 }
 
 
@@ -1122,14 +1422,12 @@ int process_grdecl(int                    pinchActive,
 
     enum CoordinateSystemType coord_sys_type;
 
-    const size_t BIGNUM = 64;
     const int    nx = in->dims[0];
     const int    ny = in->dims[1];
     const int    nz = in->dims[2];
     const size_t nc = ((size_t) nx) * ((size_t) ny) * ((size_t) nz);
 
     /* internal work arrays */
-    int    *work;
     int    *plist;
     int    *intersections;
 
@@ -1144,17 +1442,17 @@ int process_grdecl(int                    pinchActive,
     /* ---------------------------------------------------------------- */
     /* Initialize output structure:
      *
-     * 1) Allocate space for grid topology (which may need to be increased)
+     * 1) Grid topology is allocated at its exact size once the faces
+     *    have been counted.
      * 2) Set Cartesian dimensions.
      * ---------------------------------------------------------------- */
-    out->m                = (int) (BIGNUM / 3);
-    out->n                = (int) BIGNUM;
+    out->m                = 0;
+    out->n                = 0;
 
-    out->face_neighbors   = malloc( BIGNUM      * sizeof *out->face_neighbors);
-    out->face_nodes       = malloc( out->n      * sizeof *out->face_nodes);
-    out->face_node_ptr    = malloc((out->m + 1) * sizeof *out->face_node_ptr);
-    out->face_tag         = malloc( out->m      * sizeof *out->face_tag);
-    out->face_node_ptr[0] = 0;
+    out->face_neighbors   = NULL;
+    out->face_nodes       = NULL;
+    out->face_node_ptr    = NULL;
+    out->face_tag         = NULL;
 
     out->cell_faces       = NULL;
     out->cell_face_ptr    = NULL;
@@ -1169,12 +1467,7 @@ int process_grdecl(int                    pinchActive,
     out->node_coordinates = NULL;
     out->local_cell_index = malloc(nc * sizeof *out->local_cell_index);
 
-    if ((out->face_neighbors   == NULL) ||
-        (out->face_nodes       == NULL) ||
-        (out->face_node_ptr         == NULL) ||
-        (out->face_tag         == NULL) ||
-        (out->local_cell_index == NULL))
-    {
+    if (out->local_cell_index == NULL) {
         return 0;
     }
 
@@ -1236,31 +1529,22 @@ int process_grdecl(int                    pinchActive,
     /* -----------------------------------------------------------------*/
     /* Find face topology and face-to-cell connections */
 
-    /* internal */
-    work = malloc(2 * ((size_t) (2*nz + 2)) * sizeof *work);
-    if (work == NULL) {
-        free(plist);
-        return 0;
-    }
-
-    for (i = 0; i < ((size_t)4) * (nz + 1); ++i) { work[i] = -1; }
-
-    /* internal array to store intersections */
-    intersections = malloc(BIGNUM* sizeof(*intersections));
-    if (intersections == NULL) {
+    /* Pillar pairs and pillar columns are independent, so they are
+     * counted and filled concurrently if multiple threads are
+     * available.  The result does not depend on the number of threads.
+     * 'intersections' holds four point numbers per fault intersection. */
+    intersections = NULL;
+    if (! process_faces(edge_conformal != 0, pinchActive != 0,
+                        &intersections, plist, is_aquifer_cell, out))
+    {
+        fprintf(stderr,
+                "Could not allocate enough space in "
+                "process_grdecl()\n");
         free(plist);
-        free(work);
+        free(intersections);
         return 0;
     }
 
-    process_vertical_faces(edge_conformal != 0, 0, &intersections, plist, work, out);
-    process_vertical_faces(edge_conformal != 0, 1, &intersections, plist, work, out);
-
-    /* Memory allocation procedure depends on edge conformal flag */
-    process_horizontal_faces(pinchActive != 0, &intersections,
-                             plist, is_aquifer_cell, out);
-
-    free(work);   work  = NULL;
     free(plist);  plist = NULL;
 
     /* -----------------------------------------------------------------*/
@@ -41,6 +41,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 #include "preprocess.h"
 #include "uniquepoints.h"
@@ -132,8 +135,8 @@ static int assignPointNumbers(int    begin,
                               double tolerance)
 {
     /* n     - number of cells */
-    /* zlist - list of len unique z-values */
-    /* start - number of unique z-values processed before. */
+    /* zlist - list of end-begin unique z-values of this pillar */
+    /* begin - number of unique z-values on preceding pillars. */
 
     int i, k;
     /* All points should now be within tolerance of a listed point. */
@@ -156,12 +159,12 @@ static int assignPointNumbers(int    begin,
         }
 
         /* Find next k such that zlist[k] < z[i] < zlist[k+1] */
-        while ((k < end) && (zlist[k] + tolerance < z[i])){
+        while ((k < end) && (zlist[k - begin] + tolerance < z[i])){
             k++;
         }
 
-        /* assert (k < len && z[i] - zlist[k] <= tolerance) */
-        if ((k == end) || ( zlist[k] + tolerance < z[i])){
+        /* assert (k < end && z[i] - zlist[k - begin] <= tolerance) */
+        if ((k == end) || ( zlist[k - begin] + tolerance < z[i])){
             fprintf(stderr, "Cannot associate  zcorn values with given list\n");
             fprintf(stderr, "of z-coordinates to given tolerance\n");
             return 0;
@@ -176,6 +179,56 @@ static int assignPointNumbers(int    begin,
 }
 
 
+/*-----------------------------------------------------------------
+  Exclusive prefix sum of <n> counts, ptr[0] = 0 and ptr[i+1] =
+  ptr[i] + count[i].  Contiguous blocks of counts are summed
+  concurrently, then each block is offset by the sum of the
+  preceding blocks.  Returns 0 if out of memory. */
+static int exclusive_scan(int n, const int *count, int *ptr)
+{
+    int  b, i, nblocks;
+    int *offset;
+
+#if defined(_OPENMP)
+    nblocks = MAX(1, MIN(n, omp_get_max_threads()));
+#else
+    nblocks = 1;
+#endif
+
+    offset = malloc((nblocks + 1) * sizeof *offset);
+    if (offset == NULL) { return 0; }
+
+#pragma omp parallel for schedule(static) private(i)
+    for (b = 0; b < nblocks; ++b) {
+        offset[b + 1] = 0;
+        for (i = (int) (((size_t) n) * b / nblocks);
+             i < (int) (((size_t) n) * (b + 1) / nblocks); ++i) {
+            offset[b + 1] += count[i];
+        }
+    }
+
+    offset[0] = 0;
+    for (b = 0; b < nblocks; ++b) {
+        offset[b + 1] += offset[b];
+    }
+
+#pragma omp parallel for schedule(static) private(i)
+    for (b = 0; b < nblocks; ++b) {
+        int sum = offset[b];
+        for (i = (int) (((size_t) n) * b / nblocks);
+             i < (int) (((size_t) n) * (b + 1) / nblocks); ++i) {
+            ptr[i] = sum;
+            sum   += count[i];
+        }
+    }
+
+    ptr[n] = offset[nblocks];
+
+    free(offset);
+    return 1;
+}
+
+
 /* ---------------------------------------------------------------------- */
 static void
 vector_positions(const int dims[3] ,
@@ -264,7 +317,12 @@ static void interpolate_pillar(const double *coord, double *pt)
 /*-----------------------------------------------------------------
   Assign point numbers p such that "zlist(p)==zcorn".  Assume that
   coordinate number is arranged in a sequence such that the natural
-  index is (k,i,j) */
+  index is (k,i,j).
+
+  Pillars are sorted and uniquified concurrently, each in its own
+  section of a scratch list.  Point numbers are then the exclusive
+  prefix sum of the number of unique points per pillar, so the output
+  does not depend on the number of threads. */
 int finduniquepoints(const struct grdecl *g,
                      /* return values: */
                      int           *plist, /* list of point numbers on
@@ -280,31 +338,18 @@ int finduniquepoints(const struct grdecl *g,
     const size_t nc = g->dims[0]*g->dims[1]*g->dims[2];
 
 
-    /* zlist may need extra space temporarily due to simple boundary
-     * treatement  */
-    int            npillarpoints = 8*(nx+1)*(ny+1)*nz;
+    /* Each pillar has at most 8*nz z-values (2*nz from each of four
+     * columns of cells), which is the size of its section of zlist. */
+    size_t         pillarcap     = 8*(size_t)nz;
     int            npillars      = (nx+1)*(ny+1);
 
-    double *zlist = malloc(npillarpoints*sizeof *zlist);
+    double *zlist = malloc(npillars*pillarcap*sizeof *zlist);
+    int     *zlen = malloc(npillars*sizeof *zlen);
     int     *zptr = malloc((npillars+1)*sizeof *zptr);
 
-
-
-
-    int     i,j,k;
-
     int     d1[3];
-    int     len;
-    double  *zout  = zlist;
-    int     pos    = 0;
-    double *pt;
-    const double *z[4];
-    const int *a[4];
-    int *p;
-    int pix, cix;
-    int zix;
-
-    const double *coord = g->coord;
+    int     pix, col;
+    int     ok;
 
     d1[0] = 2*g->dims[0];
     d1[1] = 2*g->dims[1];
@@ -312,70 +357,85 @@ int finduniquepoints(const struct grdecl *g,
 
     out->node_coordinates = malloc (3*8*nc*sizeof(*out->node_coordinates));
 
-    zptr[pos++] = zout - zlist;
+    ok = (zlen != NULL) && (zptr != NULL) &&
+         ((zlist != NULL) || (pillarcap == 0)) &&
+         ((out->node_coordinates != NULL) || (nc == 0));
 
-    pt    = out->node_coordinates;
+    if (ok) {
+        /* Loop over pillars, find unique points on each pillar */
+#pragma omp parallel for schedule(static)
+        for (pix = 0; pix < npillars; ++pix){
+            const int i = pix % (g->dims[0]+1);
+            const int j = pix / (g->dims[0]+1);
 
-    /* Loop over pillars, find unique points on each pillar */
-    for (j=0; j < g->dims[1]+1; ++j){
-        for (i=0; i < g->dims[0]+1; ++i){
+            double       *zout = zlist + pix*pillarcap;
+            const double *z[4];
+            const int    *a[4];
+            int           len;
 
             /* Get positioned pointers for actnum and zcorn data */
             igetvectors(g->dims,   i,   j, g->actnum, a);
             dgetvectors(d1,      2*i, 2*j, g->zcorn,  z);
 
-            len = createSortedList(     zout, d1[2], 4, z, a);
-            len = uniquify        (len, zout, tolerance);
+            len       = createSortedList(     zout, d1[2], 4, z, a);
+            zlen[pix] = uniquify        (len, zout, tolerance);
+        }
+
+        /* Sparse table of unique zcorn values */
+        ok = exclusive_scan(npillars, zlen, zptr);
+    }
+
+    if (ok) {
+        out->number_of_nodes_on_pillars = zptr[npillars];
+        out->number_of_nodes            = zptr[npillars];
 
-            /* Assign unique points */
-            for (k=0; k<len; ++k){
+        /* Assign unique points */
+#pragma omp parallel for schedule(static)
+        for (pix = 0; pix < npillars; ++pix){
+            const double *zout = zlist + pix*pillarcap;
+            double       *pt   = out->node_coordinates + 3*(size_t)zptr[pix];
+            int           k;
+
+            for (k=0; k<zlen[pix]; ++k){
                 pt[2] = zout[k];
-                interpolate_pillar(coord, pt);
+                interpolate_pillar(g->coord + 6*(size_t)pix, pt);
                 pt += 3;
             }
-
-            /* Increment pointer to sparse table of unique zcorn
-             * values */
-            zout        = zout + len;
-            zptr[pos++] = zout - zlist;
-
-            coord += 6;
         }
-    }
-    out->number_of_nodes_on_pillars = zptr[pos-1];
-    out->number_of_nodes            = zptr[pos-1];
 
-    /* Loop over all vertical sets of zcorn values, assign point
-     * numbers */
-    p = plist;
-    for (j=0; j < 2*g->dims[1]; ++j){
-        for (i=0; i < 2*g->dims[0]; ++i){
+        /* Loop over all vertical sets of zcorn values, assign point
+         * numbers */
+#pragma omp parallel for schedule(static) private(pix) reduction(&&:ok)
+        for (col = 0; col < 4*g->dims[0]*g->dims[1]; ++col){
+            const int i = col % (2*g->dims[0]);
+            const int j = col / (2*g->dims[0]);
 
             /* pillar index */
             pix = (i+1)/2 + (g->dims[0]+1)*((j+1)/2);
 
             /* cell column position */
-            cix = g->dims[2]*((i/2) + (j/2)*g->dims[0]);
+            const size_t cix = g->dims[2]*((size_t)(i/2) + (j/2)*g->dims[0]);
 
             /* zcorn column position */
-            zix = 2*g->dims[2]*(i+2*g->dims[0]*j);
+            const size_t zix = 2*g->dims[2]*((size_t)i + 2*g->dims[0]*j);
 
-            if (!assignPointNumbers(zptr[pix], zptr[pix+1], zlist,
+            if (!assignPointNumbers(zptr[pix], zptr[pix+1],
+                                    zlist + pix*pillarcap,
                                     2*g->dims[2],
                                     g->zcorn  + zix, g->actnum + cix,
-                                    p, tolerance)){
+                                    plist + col*(2 + 2*(size_t)g->dims[2]),
+                                    tolerance)){
                 fprintf(stderr, "Something went wrong in assignPointNumbers");
-                return 0;
+                ok = 0;
             }
-
-            p += 2 + 2*g->dims[2];
         }
     }
 
     free(zptr);
+    free(zlen);
     free(zlist);
 
-    return 1;
+    return ok;
 }
 
 /* Local Variables:    */
@@ -0,0 +1,580 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_CPGRID_COMMUNICATIONPLAN_HEADER_INCLUDED
+#define OPM_GRID_CPGRID_COMMUNICATIONPLAN_HEADER_INCLUDED
+
+#include <dune/grid/common/gridenums.hh>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include "CpGridDataTraits.hpp"
+
+#if HAVE_MPI
+#include <dune/common/parallel/mpitraits.hh>
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+template<int codim> class Entity;
+class CpGridData;
+
+/// \brief Data handles that store their cell data in one contiguous array with
+///        the same number of items per cell, ordered by cell index.
+///
+/// Communication plans pack and unpack the cell data directly from the array
+/// instead of calling gather() and scatter() for each cell. Data of points is
+/// still communicated with gather() and scatter().
+template<class DataHandle>
+concept ContiguousDataHandle = requires(DataHandle& data)
+{
+    { data.values() } -> std::same_as<std::span<typename DataHandle::DataType>>;
+};
+
+/// \brief A data handle for a vector with a fixed number of values per cell.
+///
+/// The values of cell i are stored at positions [i*blockSize, (i+1)*blockSize).
+/// Communication plans exchange these values without per cell function calls.
+/// \tparam T The type of the values. Has to be supported by Dune::MPITraits.
+template<class T>
+class CellVectorHandle
+{
+public:
+    using DataType = T;
+
+    /// \param values The values of all cells.
+    /// \param blockSize The number of values per cell.
+    explicit CellVectorHandle(std::vector<T>& values, std::size_t blockSize = 1)
+        : values_(values), blockSize_(blockSize)
+    {}
+
+    bool fixedSize(int /*dim*/, int /*codim*/) const
+    {
+        return true;
+    }
+
+    bool contains(int dim, int codim) const
+    {
+        return dim == 3 && codim == 0;
+    }
+
+    template<class EntityType>
+    std::size_t size(const EntityType&) const
+    {
+        return blockSize_;
+    }
+
+    template<class B, class EntityType>
+    void gather(B& buffer, const EntityType& e) const
+    {
+        for (std::size_t i = 0; i < blockSize_; ++i)
+            buffer.write(values_[e.index() * blockSize_ + i]);
+    }
+
+    template<class B, class EntityType>
+    void scatter(B& buffer, const EntityType& e, std::size_t /*size*/)
+    {
+        for (std::size_t i = 0; i < blockSize_; ++i)
+            buffer.read(values_[e.index() * blockSize_ + i]);
+    }
+
+    /// \brief All values, ordered by cell index.
+    std::span<T> values() const
+    {
+        return values_;
+    }
+
+private:
+    std::vector<T>& values_;
+    std::size_t blockSize_;
+};
+
+#if HAVE_MPI
+/// \brief A duplicate of a communicator, freed together with its last owner.
+using SharedCommunicator = std::shared_ptr<MPI_Comm>;
+
+/// \brief Duplicates a communicator. Collective on the communicator.
+inline SharedCommunicator duplicateCommunicator(MPI_Comm comm)
+{
+    auto duplicate = SharedCommunicator(new MPI_Comm(MPI_COMM_NULL), [](MPI_Comm* c)
+    {
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (!finalized && *c != MPI_COMM_NULL)
+            MPI_Comm_free(c);
+        delete c;
+    });
+    MPI_Comm_dup(comm, duplicate.get());
+    return duplicate;
+}
+#endif
+
+/// \brief A persistent plan for exchanging data of fixed size along a communication interface.
+///
+/// CpGrid::communicate negotiates the message sizes and allocates the message
+/// buffers on every call. A plan does this once when it is created: it stores
+/// the indices to gather from and to scatter to for each neighbouring process,
+/// owns contiguous send and receive buffers and sets up persistent MPI requests.
+/// Hence repeated exchanges of the same kind of data neither allocate memory
+/// nor exchange sizes.
+///
+/// For data handles modelling ContiguousDataHandle, e.g. CellVectorHandle, the
+/// cell data is packed and unpacked in plain loops over the precomputed indices.
+///
+/// The messages are sent on a duplicate of the communicator with tags of the
+/// plan, hence they are never mixed up with other messages. A plan either
+/// duplicates the communicator itself, which is collective, or shares a
+/// duplicate with other plans that use different tags.
+///
+/// A plan is only valid for the grid view it was created for and as long as
+/// the number of data items per entity does not change.
+/// \tparam DataHandle The type of the data handle describing the data. Has to adhere to the
+///                    Dune::DataHandleIF interface and must have a fixed size.
+template<class DataHandle>
+class CommunicationPlan
+{
+public:
+    /// \brief The type of the data items exchanged.
+    using DataType = typename DataHandle::DataType;
+
+    /// \brief Creates a plan that does not communicate.
+    CommunicationPlan() = default;
+
+#if HAVE_MPI
+    using InterfaceMap = CpGridDataTraits::InterfaceMap;
+
+    /// \brief Creates a plan for exchanging the data of a data handle.
+    ///
+    /// Duplicates the communicator, hence has to be called on all processes of
+    /// the communicator.
+    /// \param grid The grid view that the data is attached to.
+    /// \param comm The communicator of the grid view.
+    /// \param data The data handle. Used for querying which codimensions are
+    ///             communicated and how many data items each entity has.
+    /// \param cellInterface The communication interface for the cells.
+    /// \param pointInterface The communication interface for the points.
+    /// \param dir The direction of the communication along the interface (forward or backward).
+    CommunicationPlan(const CpGridData& grid, MPI_Comm comm, DataHandle& data,
+                      const InterfaceMap& cellInterface, const InterfaceMap& pointInterface,
+                      CommunicationDirection dir)
+        : CommunicationPlan(grid, duplicateCommunicator(comm), 7113, data,
+                            cellInterface, pointInterface, dir)
+    {}
+
+    /// \brief Creates a plan that sends on a communicator shared with other plans.
+    ///
+    /// Does not communicate. The plan uses the tags tag and tag + 1, which
+    /// must not be used by another plan on the same communicator, and must be
+    /// the same as on the neighbouring processes.
+    /// \param comm The duplicate of the communicator of the grid view. May be
+    ///             null if the interfaces are empty.
+    /// \param tag The first of the two tags of the plan.
+    CommunicationPlan(const CpGridData& grid, SharedCommunicator comm, int tag, DataHandle& data,
+                      const InterfaceMap& cellInterface, const InterfaceMap& pointInterface,
+                      CommunicationDirection dir)
+        : grid_(&grid), comm_(std::move(comm)), tag_(tag)
+    {
+        addSection<0>(data, cellInterface, dir);
+        addSection<3>(data, pointInterface, dir);
+        // The buffers do not change any more, hence the requests can be set up.
+        for (auto& section : sections_) {
+            initRequests(section.send, section, true);
+            initRequests(section.recv, section, false);
+        }
+    }
+#endif
+
+    ~CommunicationPlan()
+    {
+        freeRequests();
+    }
+
+    CommunicationPlan(const CommunicationPlan&) = delete;
+    CommunicationPlan& operator=(const CommunicationPlan&) = delete;
+
+    CommunicationPlan(CommunicationPlan&& other) noexcept
+    {
+        swap(other);
+    }
+
+    CommunicationPlan& operator=(CommunicationPlan&& other) noexcept
+    {
+        CommunicationPlan tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    /// \brief Exchange the data described by a data handle.
+    ///
+    /// The data handle needs to describe the same kind of data as the one used
+    /// for creating the plan.
+    void exchange(DataHandle& data)
+    {
+        start(data);
+        finish(data);
+    }
+
+    /// \brief Start exchanging the data described by a data handle.
+    ///
+    /// Gathers the data to send and posts all messages. The data to be received
+    /// must not be used before finish() was called.
+    void start([[maybe_unused]] DataHandle& data)
+    {
+        if (active_)
+            OPM_THROW(std::logic_error, "Communication was started twice without finishing it");
+#if HAVE_MPI
+        // Gather first, so that nothing is posted if gathering throws.
+        for (auto& section : sections_) {
+            if (section.codim == 0)
+                gather<0>(data, section);
+            else
+                gather<3>(data, section);
+        }
+        MPI_Startall(recvRequests_.size(), recvRequests_.data());
+        MPI_Startall(sendRequests_.size(), sendRequests_.data());
+#endif
+        active_ = true;
+    }
+
+    /// \brief Finish an exchange started by start().
+    ///
+    /// Waits for the messages and scatters the received data. Does nothing
+    /// if no exchange is in progress.
+    void finish([[maybe_unused]] DataHandle& data)
+    {
+        if (!active_)
+            return;
+        active_ = false;
+#if HAVE_MPI
+        MPI_Waitall(recvRequests_.size(), recvRequests_.data(), MPI_STATUSES_IGNORE);
+        for (auto& section : sections_) {
+            if (section.codim == 0)
+                scatter<0>(data, section);
+            else
+                scatter<3>(data, section);
+        }
+        MPI_Waitall(sendRequests_.size(), sendRequests_.data(), MPI_STATUSES_IGNORE);
+#endif
+    }
+
+    /// \brief Whether an exchange was started and not finished yet.
+    bool active() const
+    {
+        return active_;
+    }
+
+    /// \brief The number of messages sent per exchange.
+    std::size_t numSendMessages() const
+    {
+#if HAVE_MPI
+        return sendRequests_.size();
+#else
+        return 0;
+#endif
+    }
+
+    /// \brief The number of data items sent per exchange.
+    std::size_t numSendItems() const
+    {
+        std::size_t items = 0;
+        for (const auto& section : sections_)
+            items += section.send.buffer.size();
+        return items;
+    }
+
+    void swap(CommunicationPlan& other) noexcept
+    {
+        std::swap(grid_, other.grid_);
+        std::swap(active_, other.active_);
+        sections_.swap(other.sections_);
+#if HAVE_MPI
+        sendRequests_.swap(other.sendRequests_);
+        recvRequests_.swap(other.recvRequests_);
+        comm_.swap(other.comm_);
+        std::swap(tag_, other.tag_);
+#endif
+    }
+
+private:
+    /// \brief The entity indices and the buffer of the messages in one direction.
+    struct Messages
+    {
+        /// \brief The rank of the other process of each message.
+        std::vector<int> ranks;
+        /// \brief Start of the indices of each message, plus the end of the last one.
+        std::vector<std::size_t> offsets{0};
+        std::vector<int> indices;
+        std::vector<DataType> buffer;
+    };
+
+    /// \brief The messages of one codimension.
+    struct Section
+    {
+        int codim;
+        std::size_t itemsPerEntity;
+        /// \brief One more than the largest entity index of all messages.
+        std::size_t numEntities;
+        Messages send;
+        Messages recv;
+    };
+
+    /// \brief Writes gathered data items to consecutive positions in a buffer.
+    struct BufferWriter
+    {
+        DataType* position;
+
+        void write(const DataType& value)
+        {
+            *position++ = value;
+        }
+    };
+
+    /// \brief Reads data items to scatter from consecutive positions in a buffer.
+    struct BufferReader
+    {
+        const DataType* position;
+
+        void read(DataType& value)
+        {
+            value = *position++;
+        }
+    };
+
+#if HAVE_MPI
+    template<class InterfaceInformation>
+    static void addMessage(Messages& messages, int rank, const InterfaceInformation& info)
+    {
+        if (info.size() == 0)
+            return;
+        messages.ranks.push_back(rank);
+        for (std::size_t i = 0; i < info.size(); ++i)
+            messages.indices.push_back(info[i]);
+        messages.offsets.push_back(messages.indices.size());
+    }
+
+    template<int codim>
+    void addSection(DataHandle& data, const InterfaceMap& interface, CommunicationDirection dir)
+    {
+        if (!data.contains(3, codim))
+            return;
+        if (!data.fixedSize(3, codim))
+            OPM_THROW(std::logic_error, "Communication plans need data of fixed size per entity");
+
+        Section section{codim, 0, 0, {}, {}};
+        for (const auto& [rank, info] : interface) {
+            const auto& sendInfo = dir == ForwardCommunication ? info.first : info.second;
+            const auto& recvInfo = dir == ForwardCommunication ? info.second : info.first;
+            addMessage(section.send, rank, sendInfo);
+            addMessage(section.recv, rank, recvInfo);
+        }
+        // With fixed size any entity tells the number of items.
+        const auto& some = section.send.indices.empty() ? section.recv.indices : section.send.indices;
+        if (!some.empty())
+            section.itemsPerEntity = data.size(Entity<codim>(*grid_, some.front(), true));
+        for (const auto* indices : {&section.send.indices, &section.recv.indices})
+            for (const int index : *indices)
+                section.numEntities = std::max(section.numEntities, std::size_t(index) + 1);
+        section.send.buffer.resize(section.send.indices.size() * section.itemsPerEntity);
+        section.recv.buffer.resize(section.recv.indices.size() * section.itemsPerEntity);
+        sections_.push_back(std::move(section));
+    }
+
+    void initRequests(Messages& messages, const Section& section, bool send)
+    {
+        // The messages of different codimensions must not be mixed up.
+        const int tag = tag_ + (section.codim == 0 ? 0 : 1);
+        auto& requests = send ? sendRequests_ : recvRequests_;
+        for (std::size_t m = 0; m < messages.ranks.size(); ++m) {
+            auto* start = messages.buffer.data() + messages.offsets[m] * section.itemsPerEntity;
+            const int count = (messages.offsets[m + 1] - messages.offsets[m]) * section.itemsPerEntity;
+            requests.emplace_back();
+            if (send)
+                MPI_Send_init(start, count, MPITraits<DataType>::getType(), messages.ranks[m],
+                              tag, *comm_, &requests.back());
+            else
+                MPI_Recv_init(start, count, MPITraits<DataType>::getType(), messages.ranks[m],
+                              tag, *comm_, &requests.back());
+        }
+    }
+
+    template<int codim>
+    void gather(DataHandle& data, Section& section)
+    {
+        if constexpr (codim == 0 && ContiguousDataHandle<DataHandle>) {
+            const DataType* values = checkedValues(data, section).data();
+            const std::size_t block = section.itemsPerEntity;
+            const auto& indices = section.send.indices;
+            DataType* buffer = section.send.buffer.data();
+            if (block == 1) {
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                    buffer[i] = values[indices[i]];
+            }
+            else {
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                    for (std::size_t j = 0; j < block; ++j)
+                        buffer[i * block + j] = values[indices[i] * block + j];
+            }
+        }
+        else {
+            BufferWriter writer{section.send.buffer.data()};
+            for (const int index : section.send.indices)
+                data.gather(writer, Entity<codim>(*grid_, index, true));
+            if (writer.position != section.send.buffer.data() + section.send.buffer.size())
+                OPM_THROW(std::logic_error, "The number of data items per entity changed after "
+                          "the communication plan was created");
+        }
+    }
+
+    template<int codim>
+    void scatter(DataHandle& data, Section& section)
+    {
+        if constexpr (codim == 0 && ContiguousDataHandle<DataHandle>) {
+            DataType* values = checkedValues(data, section).data();
+            const std::size_t block = section.itemsPerEntity;
+            const auto& indices = section.recv.indices;
+            const DataType* buffer = section.recv.buffer.data();
+            if (block == 1) {
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                    values[indices[i]] = buffer[i];
+            }
+            else {
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                    for (std::size_t j = 0; j < block; ++j)
+                        values[indices[i] * block + j] = buffer[i * block + j];
+            }
+        }
+        else {
+            BufferReader reader{section.recv.buffer.data()};
+            for (const int index : section.recv.indices)
+                data.scatter(reader, Entity<codim>(*grid_, index, true), section.itemsPerEntity);
+        }
+    }
+
+    static std::span<DataType> checkedValues(DataHandle& data, const Section& section)
+    {
+        auto values = data.values();
+        if (values.size() < section.numEntities * section.itemsPerEntity)
+            OPM_THROW(std::invalid_argument, "The data has fewer values than the entities "
+                      "of the communication plan");
+        return values;
+    }
+#endif
+
+    void freeRequests()
+    {
+#if HAVE_MPI
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized)
+            return;
+        if (active_) {
+            // The buffers must outlive the messages. The received data is dropped.
+            MPI_Waitall(recvRequests_.size(), recvRequests_.data(), MPI_STATUSES_IGNORE);
+            MPI_Waitall(sendRequests_.size(), sendRequests_.data(), MPI_STATUSES_IGNORE);
+        }
+        for (auto* requests : {&sendRequests_, &recvRequests_})
+            for (auto& request : *requests)
+                if (request != MPI_REQUEST_NULL)
+                    MPI_Request_free(&request);
+#endif
+    }
+
+    const CpGridData* grid_ = nullptr;
+    bool active_ = false;
+    std::vector<Section> sections_;
+#if HAVE_MPI
+    std::vector<MPI_Request> sendRequests_;
+    std::vector<MPI_Request> recvRequests_;
+    /// \brief The duplicate of the communicator that the messages are sent on.
+    SharedCommunicator comm_;
+    /// \brief The tag of the cell messages. Point messages use the next one.
+    int tag_ = 0;
+#endif
+};
+
+/// \brief A communication that was started but may not be finished yet.
+///
+/// Returned by CpGrid::startCommunicate(). Work that does not depend on the
+/// received data, e.g. on interior cells, can be done before calling finish().
+/// The communication is finished at the latest when the object is destroyed.
+/// The plan is shared with the grid, which reuses it once it is finished.
+/// \tparam DataHandle The type of the data handle describing the data.
+template<class DataHandle>
+class PendingCommunication
+{
+public:
+    /// \brief Starts a communication with a plan that is not active.
+    PendingCommunication(std::shared_ptr<CommunicationPlan<DataHandle>> plan, DataHandle& data)
+        : plan_(std::move(plan)), data_(&data)
+    {
+        plan_->start(data);
+    }
+
+    /// \brief A communication that is already finished.
+    PendingCommunication() = default;
+
+    PendingCommunication(PendingCommunication&&) noexcept = default;
+    PendingCommunication& operator=(PendingCommunication&& other) noexcept
+    {
+        finish();
+        plan_ = std::move(other.plan_);
+        data_ = other.data_;
+        return *this;
+    }
+
+    ~PendingCommunication()
+    {
+        finish();
+    }
+
+    /// \brief Waits for the messages and scatters the received data.
+    void finish()
+    {
+        if (plan_ && plan_->active())
+            plan_->finish(*data_);
+        plan_.reset();
+    }
+
+    /// \brief Whether the communication is finished.
+    bool finished() const
+    {
+        return !plan_;
+    }
+
+private:
+    std::shared_ptr<CommunicationPlan<DataHandle>> plan_;
+    DataHandle* data_ = nullptr;
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_GRID_CPGRID_COMMUNICATIONPLAN_HEADER_INCLUDED
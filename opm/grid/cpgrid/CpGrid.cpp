@@ -64,7 +64,10 @@
 //#include <iostream>
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <numeric>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 
 namespace
@@ -121,6 +124,61 @@ void setupRecvInterface(const std::vector<std::tuple<int, int, char, int> >& lis
         interface[std::get<1>(entry)].second.add(index);
     }
 }
+
+/// \brief Scatters the transmissibilities of the faces of the global grid to
+///        the faces of the distributed view.
+///
+/// The values are sent with the cells containing the faces, in the order of
+/// their intersections, which is the same in both views.
+class FaceTransmissibilityHandle
+{
+public:
+    using DataType = double;
+
+    FaceTransmissibilityHandle(const double* global_trans, std::vector<double>& trans)
+        : global_trans_(global_trans), trans_(trans)
+    {}
+
+    bool fixedSize(int, int)
+    {
+        return false;
+    }
+
+    bool contains(int dim, int codim)
+    {
+        return dim == 3 && codim == 0;
+    }
+
+    template<class T>
+    std::size_t size(const T& e)
+    {
+        std::size_t faces = 0;
+        for (auto it = e.ileafbegin(); it != e.ileafend(); ++it) {
+            ++faces;
+        }
+        return faces;
+    }
+
+    template<class B, class T>
+    void gather(B& buffer, const T& e)
+    {
+        for (auto it = e.ileafbegin(); it != e.ileafend(); ++it) {
+            buffer.write(global_trans_[it->id()]);
+        }
+    }
+
+    template<class B, class T>
+    void scatter(B& buffer, const T& e, std::size_t)
+    {
+        for (auto it = e.ileafbegin(); it != e.ileafend(); ++it) {
+            buffer.read(trans_[it->id()]);
+        }
+    }
+
+private:
+    const double* global_trans_;
+    std::vector<double>& trans_;
+};
 #endif // HAVE_MPI
 
 /// Release memory resources from CpGrid::InterfaceMap.  Used as custom
@@ -271,6 +329,9 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 
     if (cc.size() > 1)
     {
+        auto& statistics = data_[0]->phaseStatistics();
+        auto load_balance_timer = statistics.time("loadBalance");
+        auto partition_timer = statistics.time("partitioning");
         std::vector<int> computedCellPart;
         std::vector<std::pair<std::string,bool>> wells_on_proc;
         std::vector<std::tuple<int,int,char>> exportList;
@@ -381,72 +442,146 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
                 OPM_THROW(std::runtime_error, "Parallel runs depend on ZOLTAN if useZoltan is true. Please install!");
 #endif // HAVE_ZOLTAN
             }
+            else if (partitionMethod == Dune::PartitionMethod::zoltanGoGDistributed)
+            {
+#ifdef HAVE_ZOLTAN
+                std::tie(computedCellPart, wells_on_proc, exportList, importList, wellConnections)
+                    = serialPartitioning
+                    ? Opm::zoltanSerialPartitioningWithGraphOfGrid(*this, wells, possibleFutureConnections, transmissibilities, cc, method, 0, imbalanceTol, allowDistributedWells, partitioningParams)
+                    : Opm::zoltanDistributedPartitioningWithGraphOfGrid(*this, wells, possibleFutureConnections, transmissibilities, cc, method, 0, imbalanceTol, allowDistributedWells, partitioningParams);
+#else
+                OPM_THROW(std::runtime_error, "Parallel runs depend on ZOLTAN if useZoltan is true. Please install!");
+#endif // HAVE_ZOLTAN
+            }
+            else if (partitionMethod == Dune::PartitionMethod::spaceFillingCurve)
+            {
+                std::tie(computedCellPart, wells_on_proc, exportList, importList, wellConnections)
+                    = Opm::spaceFillingCurvePartitioningWithGraphOfGrid(*this, wells, possibleFutureConnections, cc, 0, allowDistributedWells, partitioningParams);
+            }
             else
             {
                 std::tie(computedCellPart, wells_on_proc, exportList, importList, wellConnections) =
                     cpgrid::vanillaPartitionGridOnRoot(*this, wells, possibleFutureConnections, transmissibilities, allowDistributedWells);
             }
         }
+        partition_timer.stop();
         comm().barrier();
 
-        // first create the overlap
-        auto noImportedOwner = addOverlapLayer(*this,
-                                               computedCellPart,
-                                               exportList,
-                                               importList,
-                                               cc,
-                                               addCornerCells,
-                                               transmissibilities,
-                                               1 /*layers*/,
-                                               level);
-        // importList contains all the indices that will be here.
-        auto compareImport = [](const std::tuple<int,int,char,int>& t1,
-                                const std::tuple<int,int,char,int>&t2)
-        {
-            return std::get<0>(t1) < std::get<0>(t2);
-        };
-
-        if ( ! ownersFirst )
-        {
-            // merge owner and overlap sorted by global index
-            std::inplace_merge(importList.begin(), importList.begin()+noImportedOwner,
-                               importList.end(), compareImport);
-        }
-        // assign local indices
+        // The cells are distributed to their owners first, the overlap is
+        // added on the distributed view afterwards.
         int localIndex = 0;
         for(auto&& entry: importList)
             std::get<3>(entry) = localIndex++;
 
-        if ( ownersFirst )
-        {
-            // merge owner and overlap sorted by global index
-            std::inplace_merge(importList.begin(), importList.begin()+noImportedOwner,
-                               importList.end(), compareImport);
-        }
-
         int procsWithZeroCells{};
 
         if (cc.rank()==0)
         {
-            // Print some statistics without communication
             std::vector<int> ownedCells(cc.size(), 0);
-            std::vector<int> overlapCells(cc.size(), 0);
             for (const auto& entry: exportList)
             {
-                if(std::get<2>(entry) == AttributeSet::owner)
-                {
-                    ++ownedCells[std::get<1>(entry)];
-                }
-                else
-                {
-                    ++overlapCells[std::get<1>(entry)];
-                }
+                ++ownedCells[std::get<1>(entry)];
             }
-
             procsWithZeroCells =
                     std::accumulate(ownedCells.begin(), ownedCells.end(), 0,
                                     [](const auto acc, const auto cellsOnProc)
                                     { return acc + (cellsOnProc == 0); });
+        }
+
+        procsWithZeroCells = cc.sum(procsWithZeroCells);
+
+        if (procsWithZeroCells) {
+            std::string msg = "At least one process has zero cells. Aborting. \n"
+                " Try decreasing the imbalance tolerance with the argument \n"
+                " --imbalance-tolerance. The current value is "
+                + std::to_string(imbalanceTol);
+            if (cc.rank()==0)
+            {
+                OPM_THROW(std::runtime_error, msg );
+            }
+            else
+            {
+                OPM_THROW_NOLOG(std::runtime_error, msg);
+            }
+        }
+
+        // distributed_data should be empty at this point.
+        distributed_data_.push_back(std::make_shared<cpgrid::CpGridData>(cc, distributed_data_));
+        distributed_data_[0]->phase_statistics_ = data_[0]->phase_statistics_;
+        distributed_data_[0]->setUniqueBoundaryIds(data_[selectedLevel]->uniqueBoundaryIds());
+
+        // Just to be sure we assume that only master knows
+        cc.broadcast(&distributed_data_[0]->use_unique_boundary_ids_, 1, 0);
+
+
+        // Create indexset
+        distributed_data_[0]->cellIndexSet().beginResize();
+        for(const auto& entry: importList)
+        {
+            distributed_data_[0]->cellIndexSet()
+                .add(std::get<0>(entry),ParallelIndexSet::LocalIndex(std::get<3>(entry),AttributeSet(std::get<2>(entry)), true));
+        }
+        distributed_data_[0]->cellIndexSet().endResize();
+        // add an interface for gathering/scattering data with communication
+        // forward direction will be scatter and backward gather
+        // Interface will communicate from owner to all
+        setupSendInterface(exportList, *cell_scatter_gather_interfaces_);
+        setupRecvInterface(importList, *cell_scatter_gather_interfaces_);
+
+        auto distribute_timer = statistics.time("distributeGlobalGrid");
+        distributed_data_[0]->distributeGlobalGrid(*this,*this->data_[selectedLevel], computedCellPart);
+        distribute_timer.stop();
+        statistics.addCounter("distributeGlobalGrid", "cells", distributed_data_[0]->size(0));
+        statistics.addCounter("distributeGlobalGrid", "faces", distributed_data_[0]->numFaces());
+        statistics.addCounter("distributeGlobalGrid", "points", distributed_data_[0]->size(3));
+        (*global_id_set_ptr_).insertIdSet(*distributed_data_[0]);
+        distributed_data_[0]-> index_set_.reset(new cpgrid::IndexSet(distributed_data_[0]->cell_to_face_.size(),
+                                                                     distributed_data_[0]-> geomVector<3>().size()));
+
+        // Each process grows the overlap of its partition and sends its
+        // cells to the processes storing them as overlap. Only processes
+        // sharing cells at the partition interfaces communicate.
+        auto overlap_timer = statistics.time("addOverlapLayer");
+        const auto& owner_data = *distributed_data_[0];
+        int hasTransmissibilities = transmissibilities != nullptr;
+        cc.broadcast(&hasTransmissibilities, 1, 0);
+        std::vector<double> faceTransmissibilities;
+        if (hasTransmissibilities)
+        {
+            faceTransmissibilities.resize(owner_data.numFaces());
+            FaceTransmissibilityHandle transHandle(transmissibilities, faceTransmissibilities);
+            scatterData(transHandle);
+        }
+        const auto processes =
+            computeDistributedOverlapProcesses(owner_data, cc, addCornerCells,
+                                               hasTransmissibilities ? faceTransmissibilities.data() : nullptr,
+                                               1 /*layers*/);
+        const std::vector<int> owners(owner_data.size(0), cc.rank());
+        auto owner_view = migrateDistributedView(owners, processes, ownersFirst, "addOverlapLayer").first;
+        global_id_set_ptr_->eraseIdSet(*owner_view);
+        owner_view.reset();
+        overlap_timer.stop();
+
+        // Print some statistics
+        std::vector<int> localCells(2, 0);
+        for (const auto& index : distributed_data_[0]->cellIndexSet())
+        {
+            ++localCells[index.local().attribute() == AttributeSet::owner ? 0 : 1];
+        }
+        statistics.addCounter("addOverlapLayer", "overlap_cells", localCells[1]);
+        std::vector<int> cellCounts(2 * cc.size());
+        cc.gather(localCells.data(), cellCounts.data(), 2, 0);
+
+        if (cc.rank()==0)
+        {
+            std::vector<int> ownedCells(cc.size(), 0);
+            std::vector<int> overlapCells(cc.size(), 0);
+            for (int i = 0; i < cc.size(); ++i)
+            {
+                ownedCells[i] = cellCounts[2 * i];
+                overlapCells[i] = cellCounts[2 * i + 1];
+            }
+
             std::ostringstream ostr;
             ostr << "\nLoad balancing distributes level " << selectedLevel << " with " << data_[selectedLevel]->size(0)
                  << " active cells on " << cc.size() << " processes as follows:\n";
@@ -517,51 +652,6 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
             Opm::OpmLog::info(ostr.str());
         }
 
-        procsWithZeroCells = cc.sum(procsWithZeroCells);
-
-        if (procsWithZeroCells) {
-            std::string msg = "At least one process has zero cells. Aborting. \n"
-                " Try decreasing the imbalance tolerance with the argument \n"
-                " --imbalance-tolerance. The current value is "
-                + std::to_string(imbalanceTol);
-            if (cc.rank()==0)
-            {
-                OPM_THROW(std::runtime_error, msg );
-            }
-            else
-            {
-                OPM_THROW_NOLOG(std::runtime_error, msg);
-            }
-        }
-
-
-        // distributed_data should be empty at this point.
-        distributed_data_.push_back(std::make_shared<cpgrid::CpGridData>(cc, distributed_data_));
-        distributed_data_[0]->setUniqueBoundaryIds(data_[selectedLevel]->uniqueBoundaryIds());
-
-        // Just to be sure we assume that only master knows
-        cc.broadcast(&distributed_data_[0]->use_unique_boundary_ids_, 1, 0);
-
-
-        // Create indexset
-        distributed_data_[0]->cellIndexSet().beginResize();
-        for(const auto& entry: importList)
-        {
-            distributed_data_[0]->cellIndexSet()
-                .add(std::get<0>(entry),ParallelIndexSet::LocalIndex(std::get<3>(entry),AttributeSet(std::get<2>(entry)), true));
-        }
-        distributed_data_[0]->cellIndexSet().endResize();
-        // add an interface for gathering/scattering data with communication
-        // forward direction will be scatter and backward gather
-        // Interface will communicate from owner to all
-        setupSendInterface(exportList, *cell_scatter_gather_interfaces_);
-        setupRecvInterface(importList, *cell_scatter_gather_interfaces_);
-
-        distributed_data_[0]->distributeGlobalGrid(*this,*this->data_[selectedLevel], computedCellPart);
-        (*global_id_set_ptr_).insertIdSet(*distributed_data_[0]);
-        distributed_data_[0]-> index_set_.reset(new cpgrid::IndexSet(distributed_data_[0]->cell_to_face_.size(),
-                                                                     distributed_data_[0]-> geomVector<3>().size()));
-
         current_data_ = &distributed_data_;
         return std::make_pair(true, wells_on_proc);
     }
@@ -579,6 +669,226 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 #endif
 }
 
+bool CpGrid::repartition(const std::vector<double>& cellWeights, double imbalanceTol,
+                         bool ownersFirst, bool addCornerCells, int overlapLayers)
+{
+    auto old_data = repartitionGrid(cellWeights, imbalanceTol, ownersFirst,
+                                    addCornerCells, overlapLayers).first;
+    if (!old_data) {
+        return false;
+    }
+    global_id_set_ptr_->eraseIdSet(*old_data);
+    return true;
+}
+
+std::pair<std::shared_ptr<cpgrid::CpGridData>, std::shared_ptr<CpGrid::InterfaceMap>>
+CpGrid::repartitionGrid([[maybe_unused]] const std::vector<double>& cellWeights,
+                        [[maybe_unused]] double imbalanceTol,
+                        [[maybe_unused]] bool ownersFirst,
+                        [[maybe_unused]] bool addCornerCells,
+                        [[maybe_unused]] int overlapLayers)
+{
+#if HAVE_MPI
+    if (distributed_data_.empty() || current_data_ != &distributed_data_) {
+        OPM_THROW(std::logic_error, "Repartitioning needs the distributed view of a load balanced grid.");
+    }
+    if (maxLevel() > 0) {
+        OPM_THROW(std::logic_error, "Repartitioning a grid with local refinement is not supported, yet.");
+    }
+    auto& statistics = distributed_data_[0]->phaseStatistics();
+    auto repartition_timer = statistics.time("repartition");
+
+    // Both the new owners and the overlap are computed on the distributed
+    // view, communicating only with neighbouring processes.
+    std::vector<int> new_part;
+    const int moved = diffusePartition(*this, new_part, cellWeights, imbalanceTol);
+    statistics.addCounter("repartition", "moved_cells", moved);
+    if (moved == 0) {
+        return {};
+    }
+    const auto processes = computeOverlapProcesses(*this, new_part, addCornerCells, overlapLayers);
+
+    return migrateDistributedView(new_part, processes, ownersFirst, "repartition");
+#else
+    return {};
+#endif
+}
+
+std::pair<std::shared_ptr<cpgrid::CpGridData>, std::shared_ptr<CpGrid::InterfaceMap>>
+CpGrid::migrateDistributedView([[maybe_unused]] const std::vector<int>& new_part,
+                               [[maybe_unused]] const std::vector<std::vector<int>>& processes,
+                               [[maybe_unused]] bool ownersFirst,
+                               [[maybe_unused]] const std::string& phase)
+{
+#if HAVE_MPI
+    const auto& cc = comm();
+    const int my_rank = cc.rank();
+    auto& statistics = distributed_data_[0]->phaseStatistics();
+
+    // Each owned cell is sent to all processes storing it afterwards, ordered
+    // by global index, together with its attribute there.
+    const auto& old_index_set = distributed_data_[0]->cellIndexSet();
+    std::vector<std::pair<int, int>> owned; // (global index, old local index)
+    for (const auto& index : old_index_set) {
+        if (index.local().attribute() == AttributeSet::owner) {
+            owned.emplace_back(index.global(), index.local().local());
+        }
+    }
+    std::ranges::sort(owned);
+    std::vector<std::vector<int>> send_cells(cc.size());
+    std::vector<std::vector<int>> send_entries(cc.size()); // (global index, attribute) pairs
+    for (const auto& [global, local] : owned) {
+        for (const int proc : processes[local]) {
+            send_cells[proc].push_back(local);
+            send_entries[proc].push_back(global);
+            send_entries[proc].push_back(proc == new_part[local] ? AttributeSet::owner : AttributeSet::copy);
+        }
+    }
+    // Only the processes exchanging cells communicate.
+    std::vector<int> destinations;
+    std::vector<std::vector<int>> send_lists;
+    for (int dest = 0; dest < cc.size(); ++dest) {
+        if (!send_entries[dest].empty()) {
+            destinations.push_back(dest);
+            send_lists.push_back(std::move(send_entries[dest]));
+        }
+    }
+    const auto [sources, recv_entries] = Opm::sparseAllToAllv(send_lists, destinations, cc);
+
+    // Assign the new local indices like scatterGrid does.
+    std::vector<std::tuple<int, int, char, int>> importList; // (global index, source, attribute, local index)
+    for (std::size_t s = 0; s < sources.size(); ++s) {
+        for (std::size_t i = 0; i < recv_entries[s].size(); i += 2) {
+            importList.emplace_back(recv_entries[s][i], sources[s],
+                                    recv_entries[s][i + 1], -1);
+        }
+    }
+    auto compareImport = [](const std::tuple<int,int,char,int>& t1,
+                            const std::tuple<int,int,char,int>& t2)
+    {
+        return std::get<0>(t1) < std::get<0>(t2);
+    };
+    auto ownerEnd = importList.begin();
+    if ( ownersFirst )
+    {
+        ownerEnd = std::stable_partition(importList.begin(), importList.end(),
+                                         [](const auto& t) { return std::get<2>(t) == AttributeSet::owner; });
+        std::sort(importList.begin(), ownerEnd, compareImport);
+    }
+    std::sort(ownerEnd, importList.end(), compareImport);
+    int localIndex = 0;
+    for (auto&& entry : importList)
+        std::get<3>(entry) = localIndex++;
+    std::inplace_merge(importList.begin(), ownerEnd, importList.end(), compareImport);
+
+    // The new view is set up from the old one. Cells are only moved from
+    // their old owner to the processes storing them afterwards, ordered by
+    // global index on both sides. Cells staying on a process are copied
+    // locally.
+    std::shared_ptr<InterfaceMap> migration(new InterfaceMap, FreeInterfaces{});
+    int num_sent = 0;
+    for (int dest = 0; dest < cc.size(); ++dest) {
+        if (send_cells[dest].empty()) {
+            continue;
+        }
+        auto& send = (*migration)[dest].first;
+        send.reserve(send_cells[dest].size());
+        for (const auto& old_local : send_cells[dest]) {
+            send.add(old_local);
+        }
+        if (dest != my_rank) {
+            num_sent += send_cells[dest].size();
+        }
+    }
+    for (std::size_t s = 0; s < sources.size(); ++s) {
+        (*migration)[sources[s]].second.reserve(recv_entries[s].size() / 2);
+    }
+    for (const auto& entry : importList) {
+        (*migration)[std::get<1>(entry)].second.add(std::get<3>(entry));
+    }
+    statistics.addCounter(phase, "sent_cells", num_sent);
+    statistics.addCounter(phase, "copied_cells", send_cells[my_rank].size());
+
+    // The new view is built next to the old one and only replaces it once it
+    // is complete, such that the grid keeps its old view if anything fails.
+    auto old_data = distributed_data_[0];
+    std::vector<std::shared_ptr<cpgrid::CpGridData>> new_distributed_data;
+    new_distributed_data.push_back(std::make_shared<cpgrid::CpGridData>(cc, new_distributed_data));
+    auto& new_data = *new_distributed_data[0];
+    new_data.phase_statistics_ = old_data->phase_statistics_;
+    new_data.use_unique_boundary_ids_ = old_data->use_unique_boundary_ids_;
+
+    new_data.cellIndexSet().beginResize();
+    for (const auto& entry : importList)
+    {
+        new_data.cellIndexSet()
+            .add(std::get<0>(entry), ParallelIndexSet::LocalIndex(std::get<3>(entry), AttributeSet(std::get<2>(entry)), true));
+    }
+    new_data.cellIndexSet().endResize();
+
+    std::shared_ptr<InterfaceMap> migration_points(new InterfaceMap, FreeInterfaces{});
+    new_data.distributeGlobalGrid(*old_data, *migration, *migration_points);
+    statistics.addCounter(phase, "cells", new_data.size(0));
+    new_data.index_set_.reset(new cpgrid::IndexSet(new_data.cell_to_face_.size(),
+                                                   new_data.geomVector<3>().size()));
+
+    // Set up the scatter/gather interfaces between the global grid on rank 0,
+    // if it exists, and the new view. The points of the new view are already
+    // ordered by global id.
+    std::shared_ptr<InterfaceMap> cell_scatter_gather(new InterfaceMap, FreeInterfaces{});
+    std::shared_ptr<InterfaceMap> point_scatter_gather(new InterfaceMap, FreeInterfaces{});
+    int num_global_cells = data_[0]->size(0);
+    cc.broadcast(&num_global_cells, 1, 0);
+    if (num_global_cells > 0) {
+        std::vector<int> cell_globals(importList.size());
+        std::ranges::transform(importList, cell_globals.begin(),
+                               [](const auto& entry) { return std::get<0>(entry); });
+        std::vector<int> point_ids(new_data.size(3));
+        for (int point = 0; point < new_data.size(3); ++point) {
+            point_ids[point] = new_data.global_id_set_->idLevelZero(cpgrid::EntityRep<3>(point, true));
+        }
+        const auto [all_cells, cell_displ] = Opm::gatherv(cell_globals, cc, 0);
+        const auto [all_points, point_displ] = Opm::gatherv(point_ids, cc, 0);
+        if (my_rank == 0) {
+            cpgrid::ReversePointGlobalIdSet global_points(*data_[0]->global_id_set_);
+            for (int dest = 0; dest < cc.size(); ++dest) {
+                auto& cell_send = (*cell_scatter_gather)[dest].first;
+                cell_send.reserve(cell_displ[dest + 1] - cell_displ[dest]);
+                for (int i = cell_displ[dest]; i < cell_displ[dest + 1]; ++i) {
+                    cell_send.add(all_cells[i]);
+                }
+                auto& point_send = (*point_scatter_gather)[dest].first;
+                point_send.reserve(point_displ[dest + 1] - point_displ[dest]);
+                for (int i = point_displ[dest]; i < point_displ[dest + 1]; ++i) {
+                    point_send.add(global_points[all_points[i]]);
+                }
+            }
+        }
+        auto& cell_recv = (*cell_scatter_gather)[0].second;
+        cell_recv.reserve(importList.size());
+        for (const auto& entry : importList) {
+            cell_recv.add(std::get<3>(entry));
+        }
+        auto& point_recv = (*point_scatter_gather)[0].second;
+        point_recv.reserve(point_ids.size());
+        for (int point = 0; point < new_data.size(3); ++point) {
+            point_recv.add(point);
+        }
+    }
+
+    // Nothing below throws. The new view refers to the level vector it was
+    // created with, which is now the grid's.
+    distributed_data_.swap(new_distributed_data);
+    new_data.level_data_ptr_ = &distributed_data_;
+    (*global_id_set_ptr_).insertIdSet(new_data);
+    cell_scatter_gather_interfaces_ = std::move(cell_scatter_gather);
+    point_scatter_gather_interfaces_ = std::move(point_scatter_gather);
+
+    return {old_data, migration};
+#else
+    return {};
+#endif
+}
 
 void CpGrid::createCartesian(const std::array<int, 3>& dims,
                              const std::array<double, 3>& cellsize,
@@ -1591,6 +1901,26 @@ const Dune::FieldVector<double,3>& CpGrid::cellCentroid(int cell) const
     return current_data_->back()->geomVector<0>()[cpgrid::EntityRep<0>(cell, true)].center();
 }
 
+const cpgrid::GeometryArrays& CpGrid::geometryArrays() const
+{
+    return current_data_->back()->geometryArrays();
+}
+
+std::shared_ptr<const FaceNeighbours> CpGrid::faceNeighbours() const
+{
+    return current_data_->back()->faceNeighbours();
+}
+
+const Opm::PhaseStatistics& CpGrid::phaseStatistics() const
+{
+    return data_[0]->phaseStatistics();
+}
+
+void CpGrid::writePhaseStatistics(std::ostream& os) const
+{
+    data_[0]->phaseStatistics().writeJson(os);
+}
+
 CpGrid::CentroidIterator<0> CpGrid::beginCellCentroids() const
 {
     return CentroidIterator<0>(current_data_->back()->geomVector<0>().begin());
@@ -1710,6 +2040,7 @@ CpGrid::processEclipseFormat(const Opm::EclipseGrid* ecl_grid,
                              const bool pinchActive,
                              const bool edge_conformal)
 {
+    auto timer = current_data_->back()->phaseStatistics().time("processEclipseFormat");
     auto removed_cells = current_data_->back()->
         processEclipseFormat(ecl_grid, ecl_state,
                              periodic_extension,
@@ -1743,25 +2074,104 @@ void CpGrid::processEclipseFormat(const grdecl& input_data,
                                   const bool turn_normals,
                                   const bool edge_conformal)
 {
-    using NNCMap = std::set<std::pair<int, int>>;
-    using NNCMaps = std::array<NNCMap, 2>;
-    NNCMaps nnc;
-    current_data_->back()->processEclipseFormat(input_data,
+    auto timer = current_data_->back()->phaseStatistics().time("processEclipseFormat");
+    // global grid only on rank 0
+    if (current_data_->back()->ccobj_.rank() == 0) {
+        using NNCMap = std::set<std::pair<int, int>>;
+        using NNCMaps = std::array<NNCMap, 2>;
+        NNCMaps nnc;
+        current_data_->back()->processEclipseFormat(input_data,
 #if HAVE_OPM_COMMON
-                                                nullptr,
+                                                    nullptr,
 #endif
-                                                nnc,
-                                                remove_ij_boundary,
-                                                turn_normals,
-                                                /* pinchActive = */ false,
-                                                /* tolerance_unique_ponts = */ 0.0,
-                                                edge_conformal);
+                                                    nnc,
+                                                    remove_ij_boundary,
+                                                    turn_normals,
+                                                    /* pinchActive = */ false,
+                                                    /* tolerance_unique_ponts = */ 0.0,
+                                                    edge_conformal);
+    }
 
     current_data_->back()->ccobj_.broadcast(current_data_->back()->logical_cartesian_size_.data(),
                                             current_data_->back()->logical_cartesian_size_.size(),
                                             0);
 }
 
+void CpGrid::processDistributedEclipseFormat(const grdecl& input_data,
+                                             const cpgrid::PillarSlab& slab,
+                                             const bool turn_normals,
+                                             const bool edge_conformal)
+{
+    if (!distributed_data_.empty()) {
+        OPM_THROW(std::logic_error, "There is already a distributed version of the grid.");
+    }
+
+    const auto& cc = data_[0]->ccobj_;
+    if (cc.size() == 1) {
+        // The only slab is the whole grid.
+        if (slab.owned[0] != 0 || slab.owned[1] != slab.dims[1]) {
+            OPM_THROW(std::invalid_argument, "A single pillar slab has to own all rows.");
+        }
+        processEclipseFormat(input_data, /* remove_ij_boundary = */ false,
+                             turn_normals, edge_conformal);
+        return;
+    }
+
+    distributed_data_.push_back(std::make_shared<cpgrid::CpGridData>(cc, distributed_data_));
+    distributed_data_[0]->phase_statistics_ = data_[0]->phase_statistics_;
+    auto timer = data_[0]->phaseStatistics().time("processDistributedEclipseFormat");
+    distributed_data_[0]->processDistributedEclipseFormat(input_data, slab, turn_normals,
+                                                          /* pinchActive = */ false,
+                                                          /* tolerance_unique_points = */ 0.0,
+                                                          edge_conformal);
+    (*global_id_set_ptr_).insertIdSet(*distributed_data_[0]);
+    current_data_ = &distributed_data_;
+}
+
+void CpGrid::writeSnapshot(const std::string& filename) const
+{
+    if (!distributed_data_.empty() || data_.size() > 1) {
+        OPM_THROW(std::logic_error, "Grid snapshots are only supported for grids that are "
+                  "neither distributed nor refined.");
+    }
+    if (data_[0]->ccobj_.rank() == 0) {
+        data_[0]->writeSnapshot(filename);
+    }
+}
+
+void CpGrid::readSnapshot(const std::string& filename)
+{
+    if (!distributed_data_.empty() || data_.size() > 1) {
+        OPM_THROW(std::logic_error, "Cannot read a grid snapshot into a distributed or refined grid.");
+    }
+
+    auto& data = *data_[0];
+    // Errors on rank 0 have to be propagated, as the broadcast
+    // below would otherwise deadlock.
+    int success = 1;
+    std::string message;
+    if (data.ccobj_.rank() == 0) {
+        try {
+            data.readSnapshot(filename);
+        }
+        catch (const std::exception& e) {
+            success = 0;
+            message = e.what();
+        }
+    }
+    data.ccobj_.broadcast(&success, 1, 0);
+    if (success == 0) {
+        if (data.ccobj_.rank() == 0) {
+            throw std::runtime_error(message);
+        }
+        OPM_THROW(std::runtime_error, "Reading grid snapshot " + filename + " failed on rank 0.");
+    }
+
+    data.ccobj_.broadcast(data.logical_cartesian_size_.data(),
+                          data.logical_cartesian_size_.size(),
+                          0);
+}
+
 template<int dim>
 cpgrid::Entity<dim> createEntity(const CpGrid& grid,int index,bool orientation)
 {
@@ -1962,7 +2372,7 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
     // Following the example above,
     // markedElemAndEquivRefinedCorner_to_corner[{0, 8}] = 5;
     // markedElemAndEquivRefinedCorner_to_corner[{1, 2}] = 5;
-    std::map< std::array<int,2>, int > markedElemAndEquivRefinedCorn_to_corner;
+    Opm::Lgr::IndexPairMap<int> markedElemAndEquivRefinedCorn_to_corner;
     // -- faceInMarkedElemAndRefinedFaces :
     // For each face from level zero, we store the marked elements where the face appears (maximum 2 cells)
     // and its new-born refined faces from each auxiliary marked-element-lgr. Example: face with index 9
@@ -1974,8 +2384,8 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
     faceInMarkedElemAndRefinedFaces.resize(current_data_->back()->face_to_cell_.size());
     // ------------------------ Refined cells parameters
     // --- Refined cells and PreAdapt cells relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell;
     // Integer to count only REFINED cells (new-born refined cells from ANY marked element).
     std::vector<int> refined_cell_count_vec(levels, 0);
     // -- Parent-child relations --
@@ -1983,8 +2393,8 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
     std::vector<std::vector<std::tuple<int,std::vector<int>>>> preAdapt_parent_to_children_cells_vec(preAdaptMaxLevel +1);
     // ------------------------ Adapted cells parameters
     // --- Adapted cells and PreAdapt cells relations ---
-    std::map<std::array<int,2>,int>           elemLgrAndElemLgrCell_to_adaptedCell;
-    std::unordered_map<int,std::array<int,2>> adaptedCell_to_elemLgrAndElemLgrCell;
+    Opm::Lgr::IndexPairMap<int>           elemLgrAndElemLgrCell_to_adaptedCell;
+    std::vector<std::array<int,2>> adaptedCell_to_elemLgrAndElemLgrCell;
     // Integer to count adapted cells (mixed between cells from level0 (not involved in LGRs), and (new-born) refined cells).
     int cell_count = 0;
     // -- Some extra indices relations between preAdapt-grid and adapted-grid --
@@ -2076,9 +2486,9 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
     // Stablish relationships between PreAdapt corners and refined or adapted ones ---
     //
     // --- Refined corners and PreAdapt corners relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner;
-    std::map<std::array<int,2>,std::array<int,2>> vanishedRefinedCorner_to_itsLastAppearance;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> vanishedRefinedCorner_to_itsLastAppearance;
     // Integer to count only refined corners.
     std::vector<int> refined_corner_count_vec(levels, 0);
     Opm::Lgr::identifyRefinedCornersPerLevel(currentLeafData(),
@@ -2096,8 +2506,8 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
                                              cells_per_dim_vec);
 
     // --- Adapted corners and PreAdapt corners relations ---
-    std::map<std::array<int,2>,int>           elemLgrAndElemLgrCorner_to_adaptedCorner;
-    std::unordered_map<int,std::array<int,2>> adaptedCorner_to_elemLgrAndElemLgrCorner;
+    Opm::Lgr::IndexPairMap<int>           elemLgrAndElemLgrCorner_to_adaptedCorner;
+    std::vector<std::array<int,2>> adaptedCorner_to_elemLgrAndElemLgrCorner;
     // Integer to count adapted corners (mixed between corners from pre-refined-leaf corners not involved in LGRs, and new-born refined corners).
     int corner_count = 0;
     Opm::Lgr::identifyLeafGridCorners(currentLeafData(),
@@ -2117,8 +2527,8 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
     // FACES
     // Stablish relationships between PreAdapt faces and refined or adapted ones ---
     // --- Refined faces and PreAdapt faces relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace;
     // Integer to count adapted faces (mixed between faces from level0 (not involved in LGRs), and (new-born) refined faces).
     std::vector<int> refined_face_count_vec(levels, 0);
     Opm::Lgr::identifyRefinedFacesPerLevel(currentLeafData(),
@@ -2132,8 +2542,8 @@ bool CpGrid::refineAndUpdateGrid(bool throwOnFailure,
                                            cells_per_dim_vec);
 
     // --- Adapted faces and PreAdapt faces relations ---
-    std::map< std::array<int,2>, int >           elemLgrAndElemLgrFace_to_adaptedFace;
-    std::unordered_map< int, std::array<int,2> > adaptedFace_to_elemLgrAndElemLgrFace;
+    Opm::Lgr::IndexPairMap<int>           elemLgrAndElemLgrFace_to_adaptedFace;
+    std::vector<std::array<int,2>> adaptedFace_to_elemLgrAndElemLgrFace;
     // Integer to count adapted faces (mixed between faces from pre-refined-leaf faces not involved in LGRs and new-born refined faces).
     int face_count = 0;
     Opm::Lgr::identifyLeafGridFaces(currentLeafData(),
@@ -2528,17 +2938,82 @@ void CpGrid::getFirstChildGlobalIds([[maybe_unused]] std::vector<int>& parentToF
 void CpGrid::syncDistributedGlobalCellIds()
 {
 #if HAVE_MPI
+    // Only the root process holds the undistributed view.
     std::vector<int> parentToFirstChildGlobalIds;
     getFirstChildGlobalIds(parentToFirstChildGlobalIds);
 
-    auto size = comm().max(parentToFirstChildGlobalIds.size());
-
     switchToDistributedView();
 
-    parentToFirstChildGlobalIds.resize(size);
-    comm().broadcast(parentToFirstChildGlobalIds.data(), parentToFirstChildGlobalIds.size(), 0);
-
     const int maxLevel = this->maxLevel();
+    const auto& globalIdSet = this->globalIdSet();
+
+    // Each process asks the root only for the parent cells it owns, instead of
+    // receiving the first child ids of all parent cells of the whole grid.
+    std::vector<int> ownedParents;
+    for (int level = 1; level <= maxLevel; ++level) {
+        for (const auto& element : Dune::elements(levelGridView(level))) {
+            const auto& father = element.father();
+            if (father.partitionType() == InteriorEntity) {
+                ownedParents.push_back(globalIdSet.id(father));
+            }
+        }
+    }
+    std::sort(ownedParents.begin(), ownedParents.end());
+    ownedParents.erase(std::unique(ownedParents.begin(), ownedParents.end()), ownedParents.end());
+
+    // Requests and answers are only stored on the root.
+    auto [requestedParents, requestDispl] = Opm::gatherv(ownedParents, comm(), 0);
+    std::vector<int> answers(requestedParents.size());
+    for (std::size_t i = 0; i < requestedParents.size(); ++i) {
+        answers[i] = parentToFirstChildGlobalIds[requestedParents[i]];
+    }
+    std::vector<int> answerSizes;
+    for (std::size_t proc = 0; proc + 1 < requestDispl.size(); ++proc) {
+        answerSizes.push_back(requestDispl[proc + 1] - requestDispl[proc]);
+    }
+    std::vector<int> ownedFirstChildren(ownedParents.size());
+    comm().scatterv(answers.data(), answerSizes.data(), requestDispl.data(),
+                    ownedFirstChildren.data(), ownedFirstChildren.size(), 0);
+    std::vector<int>().swap(parentToFirstChildGlobalIds);
+
+    // Parent cells in the overlap get their first child ids from their owners, i.e.
+    // only the neighbouring processes of the level zero cell interface communicate.
+    const auto& interfaces = std::get<InteriorBorder_All_Interface>(currentData().front()->cell_interfaces_).interfaces();
+    std::vector<int> neighbors;
+    std::vector<std::vector<int>> sendPairs;
+    for (const auto& [rank, info] : interfaces) {
+        neighbors.push_back(rank);
+        auto& pairs = sendPairs.emplace_back();
+        const auto& sendIndices = info.first;
+        for (std::size_t i = 0; i < sendIndices.size(); ++i) {
+            const int parentId = globalIdSet.id(cpgrid::Entity<0>(*currentData().front(), sendIndices[i], true));
+            const auto candidate = std::lower_bound(ownedParents.begin(), ownedParents.end(), parentId);
+            if (candidate != ownedParents.end() && *candidate == parentId) {
+                pairs.push_back(parentId);
+                pairs.push_back(ownedFirstChildren[candidate - ownedParents.begin()]);
+            }
+        }
+    }
+    // Sorted (parent global id, first child global id) pairs of all parents seen here.
+    std::vector<std::pair<int,int>> firstChildOfParent;
+    for (std::size_t i = 0; i < ownedParents.size(); ++i) {
+        firstChildOfParent.emplace_back(ownedParents[i], ownedFirstChildren[i]);
+    }
+    for (const auto& pairs : Opm::neighborAllToAllv(sendPairs, neighbors, comm())) {
+        for (std::size_t i = 0; i < pairs.size(); i += 2) {
+            firstChildOfParent.emplace_back(pairs[i], pairs[i+1]);
+        }
+    }
+    std::sort(firstChildOfParent.begin(), firstChildOfParent.end());
+    auto firstChildId = [&firstChildOfParent](int parent_globalId)
+    {
+        const auto candidate = std::lower_bound(firstChildOfParent.begin(), firstChildOfParent.end(),
+                                                std::make_pair(parent_globalId, std::numeric_limits<int>::min()));
+        if (candidate == firstChildOfParent.end() || candidate->first != parent_globalId) {
+            OPM_THROW(std::logic_error, "Missing first child global id of parent cell " + std::to_string(parent_globalId));
+        }
+        return candidate->second;
+    };
 
     // Preallocate syncCellIds (and vertexIds, which will NOT be synchronized)
     std::vector<std::vector<int>> syncCellIds(maxLevel);
@@ -2548,15 +3023,13 @@ void CpGrid::syncDistributedGlobalCellIds()
         vertexIds[level-1].resize(currentData()[level]->size(3));
     }
 
-    const auto& globalIdSet = this->globalIdSet();
-
     // Populate syncCellIds and vertexIds
     for (int level = 1; level <= maxLevel; ++level) {
         const auto& elements = Dune::elements(levelGridView(level));
         for (const auto& element : elements) {
             const int parent_globalId = globalIdSet.id(element.father());
             const int idx_in_parent = element.getIdxInParentCell();
-            const int first_child_id = parentToFirstChildGlobalIds[parent_globalId];
+            const int first_child_id = firstChildId(parent_globalId);
             const int new_elem_globalId = first_child_id + idx_in_parent;
 
             syncCellIds[element.level()-1][element.index()] = new_elem_globalId;
@@ -2745,14 +3218,22 @@ void CpGrid::addLgrsUpdateLeafView(const std::vector<std::array<int,3>>& cells_p
     }
 }
 
-void CpGrid::autoRefine(const std::array<int,3>& nxnynz)
+namespace
+{
+// Refinement factors of autoRefine() must be odd and positive.
+void validAutoRefinementFactors(const std::array<int,3>& nxnynz)
 {
-    // Refinement factors must be odd and positive.
     for (const auto& nd : nxnynz) {
         if (nd<=0 || (nd%2==0)) {
             OPM_THROW(std::invalid_argument, "Refinement factor must be odd and positive.\n");
         }
     }
+}
+} // namespace
+
+void CpGrid::autoRefine(const std::array<int,3>& nxnynz)
+{
+    validAutoRefinementFactors(nxnynz);
     const auto endIJK = this->logicalCartesianSize();
     addLgrsUpdateLeafView(/* cells_per_dim_vec = */ {nxnynz},
                           /* startIJK_vec = */ {{0,0,0}},
@@ -2760,6 +3241,15 @@ void CpGrid::autoRefine(const std::array<int,3>& nxnynz)
                           /* lgr_name_vec = */ {"GLOBAL_REFINED"});
 }
 
+cpgrid::ImplicitRefinedLevel CpGrid::autoRefineImplicitly(const std::array<int,3>& nxnynz) const
+{
+    validAutoRefinementFactors(nxnynz);
+    if (maxLevel() > 0) {
+        OPM_THROW(std::logic_error, "Implicit global refinement requires a grid without refined levels.");
+    }
+    return cpgrid::ImplicitRefinedLevel(currentData().front(), nxnynz);
+}
+
 const std::map<std::string,int>& CpGrid::getLgrNameToLevel() const{
     return lgr_names_;
 }
@@ -2775,8 +3265,8 @@ std::array<double,3> CpGrid::getEclCentroid(const cpgrid::Entity<0>& elem) const
 }
 
 void CpGrid::updateCornerHistoryLevels(const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                       const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                       const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                       const Opm::Lgr::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                       const std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                        const int& corner_count,
                                        const std::vector<std::array<int,2>>& preAdaptGrid_corner_history,
                                        const int& preAdaptMaxLevel,
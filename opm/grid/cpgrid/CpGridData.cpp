@@ -1,7 +1,10 @@
 #include"config.h"
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <map>
+#include <numeric>
 #include <set>
 #include <vector>
 #include <utility>
@@ -157,6 +160,100 @@ int CpGridData::size(int codim) const
     }
 }
 
+const GeometryArrays& CpGridData::geometryArrays() const
+{
+    if (!geometry_arrays_) {
+        auto arrays = std::make_unique<GeometryArrays>();
+        const auto& cells = geomVector<0>();
+        const int nc = cells.size();
+        arrays->cell_volume.resize(nc);
+        arrays->cell_centroid_x.resize(nc);
+        arrays->cell_centroid_y.resize(nc);
+        arrays->cell_centroid_z.resize(nc);
+        for (int c = 0; c < nc; ++c) {
+            const auto& geom = cells[EntityRep<0>(c, true)];
+            const auto& center = geom.center();
+            arrays->cell_volume[c] = geom.volume();
+            arrays->cell_centroid_x[c] = center[0];
+            arrays->cell_centroid_y[c] = center[1];
+            arrays->cell_centroid_z[c] = center[2];
+        }
+        const auto& faces = geomVector<1>();
+        const int nf = faces.size();
+        arrays->face_area.resize(nf);
+        arrays->face_centroid_x.resize(nf);
+        arrays->face_centroid_y.resize(nf);
+        arrays->face_centroid_z.resize(nf);
+        arrays->face_normal_x.resize(nf);
+        arrays->face_normal_y.resize(nf);
+        arrays->face_normal_z.resize(nf);
+        for (int f = 0; f < nf; ++f) {
+            const auto& geom = faces[EntityRep<1>(f, true)];
+            const auto& center = geom.center();
+            const auto& normal = face_normals_.get(f);
+            arrays->face_area[f] = geom.volume();
+            arrays->face_centroid_x[f] = center[0];
+            arrays->face_centroid_y[f] = center[1];
+            arrays->face_centroid_z[f] = center[2];
+            arrays->face_normal_x[f] = normal[0];
+            arrays->face_normal_y[f] = normal[1];
+            arrays->face_normal_z[f] = normal[2];
+        }
+        geometry_arrays_ = std::move(arrays);
+    }
+    return *geometry_arrays_;
+}
+
+std::shared_ptr<const FaceNeighbours> CpGridData::faceNeighbours() const
+{
+    if (!face_neighbours_) {
+        auto neighbours = std::make_shared<FaceNeighbours>();
+        const int nf = face_to_cell_.size();
+        const bool has_tags = face_tag_.size() == static_cast<std::size_t>(nf);
+        neighbours->cells.reserve(nf);
+        neighbours->faces.reserve(nf);
+        neighbours->tags.reserve(nf);
+        neighbours->orientations.reserve(nf);
+        for (int f = 0; f < nf; ++f) {
+            const EntityRep<1> face(f, true);
+            const auto row = face_to_cell_[face];
+            if (row.size() != 2) {
+                continue;
+            }
+            std::array<int,2> cells{ row[0].index(), row[1].index() };
+            // In the parallel case non-existent cells along the front
+            // are marked with std::numeric_limits<int>::max().
+            if (cells[0] == std::numeric_limits<int>::max() ||
+                cells[1] == std::numeric_limits<int>::max()) {
+                continue;
+            }
+            // The normal points out of the cell with orientation true.
+            bool normal_from_first = row[0].orientation();
+            if (cells[1] < cells[0]) {
+                std::swap(cells[0], cells[1]);
+                normal_from_first = !normal_from_first;
+            }
+            neighbours->cells.push_back(cells);
+            neighbours->faces.push_back(f);
+            neighbours->tags.push_back(has_tags ? static_cast<int>(face_tag_[face]) : -1);
+            neighbours->orientations.push_back(normal_from_first);
+        }
+
+        const int nc = cell_to_face_.size();
+        neighbours->cell_face_offsets.resize(nc + 1);
+        neighbours->cell_faces.reserve(cell_to_face_.dataSize());
+        for (int c = 0; c < nc; ++c) {
+            const auto row = cell_to_face_[EntityRep<0>(c, true)];
+            for (int i = 0; i < row.size(); ++i) {
+                neighbours->cell_faces.push_back(row[i].index());
+            }
+            neighbours->cell_face_offsets[c + 1] = neighbours->cell_faces.size();
+        }
+        face_neighbours_ = std::move(neighbours);
+    }
+    return face_neighbours_;
+}
+
 #if HAVE_MPI
 
 // A functor that counts existent entries and renumbers them.
@@ -972,6 +1069,41 @@ struct AttributeDataHandle
 };
 
 
+/// \brief Copies the global ids of the corners of interior cells to their copies.
+struct CornerIdDataHandle
+{
+    typedef int DataType;
+
+    CornerIdDataHandle(const std::vector<std::array<int,8> >& cell_to_point,
+                       std::vector<int>& point_ids)
+        : c2p_(cell_to_point), ids_(point_ids)
+    {}
+
+    bool fixedSize()
+    {
+        return true;
+    }
+    std::size_t size(std::size_t)
+    {
+        return 8;
+    }
+    template<class B>
+    void gather(B& buffer, std::size_t i)
+    {
+        for (const auto& point : c2p_[i])
+            buffer.write(ids_[point]);
+    }
+    template<class B>
+    void scatter(B& buffer, std::size_t i, std::size_t)
+    {
+        for (const auto& point : c2p_[i])
+            buffer.read(ids_[point]);
+    }
+    const std::vector<std::array<int,8> >& c2p_;
+    std::vector<int>& ids_;
+};
+
+
 template<class T, class Functor, class FromSet, class ToSet>
 struct InterfaceFunctor
 {
@@ -1206,7 +1338,21 @@ void createInterfaces(std::vector<std::map<int,char> >& attributes,
 
 }
 
-void CpGridData::computeGeometry(const CpGrid& grid,
+struct CpGridData::ViewScatter
+{
+    const CpGridData& source;
+    CpGridData& target;
+    const InterfaceMap& cell_interfaces;
+    const InterfaceMap& point_interfaces;
+
+    template<class DataHandle>
+    void scatterData(DataHandle& data) const
+    {
+        target.scatterData(data, &source, &target, cell_interfaces, point_interfaces);
+    }
+};
+
+void CpGridData::computeGeometry(const ViewScatter& scatter,
                                  const DefaultGeometryPolicy&  globalGeometry,
                                  const std::vector<int>& globalAquiferCells,
                                  const OrientedEntityTable<0, 1>& globalCell2Faces,
@@ -1219,21 +1365,22 @@ void CpGridData::computeGeometry(const CpGrid& grid,
                                       *geometry.geomVector(std::integral_constant<int,1>()));
     FaceViaCellHandleWrapper<FaceGeometryHandle>
         wrappedFaceGeomHandle(faceGeomHandle, globalCell2Faces, cell2Faces);
-    grid.scatterData(wrappedFaceGeomHandle);
+    scatter.scatterData(wrappedFaceGeomHandle);
 
     PointGeometryHandle pointGeomHandle(*globalGeometry.geomVector(std::integral_constant<int,3>()),
                                         *geometry.geomVector(std::integral_constant<int,3>()));
-    grid.scatterData(pointGeomHandle);
+    scatter.scatterData(pointGeomHandle);
 
     CellGeometryHandle cellGeomHandle(*globalGeometry.geomVector(std::integral_constant<int,0>()),
                                       *geometry.geomVector(std::integral_constant<int,0>()),
                                       globalAquiferCells, aquiferCells,
                                       geometry.geomVector(std::integral_constant<int,3>()),
                                       cell2Points);
-    grid.scatterData(cellGeomHandle);
+    scatter.scatterData(cellGeomHandle);
 }
 
-void computeFace2Point(const CpGrid& grid,
+template<class Scatter>
+void computeFace2Point(const Scatter& scatter,
                        const OrientedEntityTable<0, 1>& globalCell2Faces,
                        const LevelGlobalIdSet& globalIds,
                        const OrientedEntityTable<0, 1>& cell2Faces,
@@ -1249,7 +1396,7 @@ void computeFace2Point(const CpGrid& grid,
     RowSizeDataHandle rowSizeHandle(wrappedGlobal, rowSizes);
     FaceViaCellHandleWrapper<RowSizeDataHandle>
         wrappedSizeHandle(rowSizeHandle, globalCell2Faces, cell2Faces);
-    grid.scatterData(wrappedSizeHandle);
+    scatter.scatterData(wrappedSizeHandle);
     face2Points.allocate(rowSizes.begin(), rowSizes.end());
     // Use entity with index INT_MAX to mark unprocessed row entries
     for (int row = 0, size = face2Points.size(); row < size; ++row)
@@ -1262,11 +1409,11 @@ void computeFace2Point(const CpGrid& grid,
     SparseTableDataHandle handle(globalFace2Points, globalIds, face2Points, global2local);
     FaceViaCellHandleWrapper<SparseTableDataHandle>
         wrappedHandle(handle, globalCell2Faces, cell2Faces);
-    grid.scatterData(wrappedHandle);
+    scatter.scatterData(wrappedHandle);
 }
 
-template<class IndexSet>
-void computeFace2Cell(CpGrid& grid,
+template<class Scatter, class IndexSet>
+void computeFace2Cell(const Scatter& scatter,
                       const OrientedEntityTable<0, 1>& globalCell2Faces,
                       const OrientedEntityTable<0, 1>& cell2Faces,
                       const OrientedEntityTable<1, 0>& globalFace2Cells,
@@ -1280,7 +1427,7 @@ void computeFace2Cell(CpGrid& grid,
     RowSizeDataHandle<Table,1> rowSizeHandle(globalFace2Cells, rowSizes);
     FaceViaCellHandleWrapper<RowSizeDataHandle<Table,1> > wrappedSizeHandle(rowSizeHandle,
                                                                             globalCell2Faces, cell2Faces);
-    grid.scatterData(wrappedSizeHandle);
+    scatter.scatterData(wrappedSizeHandle);
     face2Cells.allocate(rowSizes.begin(), rowSizes.end());
     // Use entity with index INT_MAX to mark unprocessed row entries
     for (int row = 0, size = face2Cells.size(); row < size; ++row)
@@ -1294,7 +1441,7 @@ void computeFace2Cell(CpGrid& grid,
     F2CDataHandle<IndexSet> entryHandle(globalFace2Cells, face2Cells, local2Global, global2local);
     FaceViaCellHandleWrapper<F2CDataHandle<IndexSet> > wrappedEntryHandle(entryHandle,
                                                                           globalCell2Faces, cell2Faces);
-    grid.scatterData(wrappedEntryHandle);
+    scatter.scatterData(wrappedEntryHandle);
 #ifndef NDEBUG
     for (int row = 0, size = face2Cells.size(); row < size; ++row)
     {
@@ -1309,7 +1456,8 @@ void computeFace2Cell(CpGrid& grid,
 }
 
 
-std::map<int,int> computeCell2Face(const CpGrid& grid,
+template<class Scatter>
+std::map<int,int> computeCell2Face(const Scatter& scatter,
                                    const OrientedEntityTable<0, 1>& globalCell2Faces,
                                    const LevelGlobalIdSet& globalIds,
                                    OrientedEntityTable<0, 1>& cell2Faces,
@@ -1319,12 +1467,12 @@ std::map<int,int> computeCell2Face(const CpGrid& grid,
     std::vector<int> rowSizes(noCells);
     using Table = OrientedEntityTable<0,1>;
     RowSizeDataHandle<Table,0> rowSizeHandle(globalCell2Faces, rowSizes);
-    grid.scatterData(rowSizeHandle);
+    scatter.scatterData(rowSizeHandle);
     cell2Faces.allocate(rowSizes.begin(), rowSizes.end());
     map2Global.reserve((noCells*6)*1.1);
     C2FDataHandle handle(globalCell2Faces, globalIds, cell2Faces,
                          map2Global);
-    grid.scatterData(handle);
+    scatter.scatterData(handle);
     // make map2Global a map from local index to global id
     std::ranges::sort(map2Global);
     auto newEnd = std::unique(map2Global.begin(),map2Global.end());
@@ -1423,7 +1571,8 @@ void createInterfaceList(const typename CpGridData::InterfaceMap::value_type& pr
         pointList.add(point);
 }
 
-std::map<int,int> computeCell2Point(const CpGrid& grid,
+template<class Scatter>
+std::map<int,int> computeCell2Point(const Scatter& scatter,
                                     const std::vector<std::array<int,8> >& globalCell2Points,
                                     const LevelGlobalIdSet& globalIds,
                                     const OrientedEntityTable<0, 1>& globalCell2Faces,
@@ -1446,7 +1595,7 @@ std::map<int,int> computeCell2Point(const CpGrid& grid,
                                  cell2Points,
                                  map2Global,
                                  additionalPoints);
-    grid.scatterData(handle);
+    scatter.scatterData(handle);
     // make map2Global a map from local index to global id
     std::ranges::sort(map2Global);
     auto newEnd = std::unique(map2Global.begin(),map2Global.end());
@@ -1501,6 +1650,20 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
                                       const std::vector<int>& /* cell_part */)
 {
 #if HAVE_MPI
+    distributeGlobalGrid(view_data, *grid.cell_scatter_gather_interfaces_,
+                         *grid.point_scatter_gather_interfaces_);
+#else // #if HAVE_MPI
+    static_cast<void>(grid);
+    static_cast<void>(view_data);
+#endif
+}
+
+#if HAVE_MPI
+void CpGridData::distributeGlobalGrid(const CpGridData& view_data,
+                                      const InterfaceMap& cell_interfaces,
+                                      InterfaceMap& point_interfaces)
+{
+    const ViewScatter scatter{view_data, *this, cell_interfaces, point_interfaces};
     auto& cell_indexset = cellIndexSet();
     auto& cell_remote_indices = cellRemoteIndices();
     // setup the remote indices.
@@ -1513,11 +1676,11 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
     std::vector<int> map2GlobalFaceId;
     std::vector<int> map2GlobalPointId;
     std::map<int,int> point_indicator =
-        computeCell2Point(grid, view_data.cell_to_point_, *view_data.global_id_set_, view_data.cell_to_face_,
+        computeCell2Point(scatter, view_data.cell_to_point_, *view_data.global_id_set_, view_data.cell_to_face_,
                           view_data.face_to_point_, cell_to_point_,
                           map2GlobalPointId, cell_indexset.size(),
-                          *grid.cell_scatter_gather_interfaces_,
-                          *grid.point_scatter_gather_interfaces_);
+                          cell_interfaces,
+                          point_interfaces);
 
     // create global ids array for cells. The parallel index set uses the global id
     // as the global index.
@@ -1528,7 +1691,7 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
     }
 
     [[maybe_unused]] std::map<int,int> face_indicator =
-        computeCell2Face(grid, view_data.cell_to_face_, *view_data.global_id_set_, cell_to_face_,
+        computeCell2Face(scatter, view_data.cell_to_face_, *view_data.global_id_set_, cell_to_face_,
                          map2GlobalFaceId, cell_indexset.size());
 
     auto noExistingPoints = map2GlobalPointId.size();
@@ -1536,9 +1699,9 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
 
     global_id_set_->swap(map2GlobalCellId, map2GlobalFaceId, map2GlobalPointId);
 
-    computeFace2Cell(grid, view_data.cell_to_face_, cell_to_face_,
+    computeFace2Cell(scatter, view_data.cell_to_face_, cell_to_face_,
                      view_data.face_to_cell_, face_to_cell_, cell_indexset, view_data.cellIndexSet(), noExistingFaces);
-    computeFace2Point(grid,  view_data.cell_to_face_, *view_data.global_id_set_, cell_to_face_,
+    computeFace2Point(scatter,  view_data.cell_to_face_, *view_data.global_id_set_, cell_to_face_,
                       view_data.face_to_point_, face_to_point_, point_indicator,
                       noExistingFaces);
 
@@ -1550,20 +1713,22 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
     geometry_.geomVector(std::integral_constant<int,0>()) -> resize(cell_to_face_.size());
     geometry_.geomVector(std::integral_constant<int,3>()) -> resize(noExistingPoints);
 
-    computeGeometry(grid, view_data.geometry_, view_data.aquifer_cells_, view_data.cell_to_face_,
+    computeGeometry(scatter, view_data.geometry_, view_data.aquifer_cells_, view_data.cell_to_face_,
                     geometry_, aquifer_cells_, cell_to_face_, cell_to_point_);
 
     global_cell_.resize(cell_indexset.size());
 
     // communicate global cell
     DefaultContainerHandle<std::vector<int> > indexHandle(view_data.global_cell_, global_cell_);
-    grid.scatterData(indexHandle);
+    scatter.scatterData(indexHandle);
 
     // Scatter face tags, normals, and boundary ids.
     auto noBids = view_data.unique_boundary_ids_.size();
     bool hasBids = ccobj_.max(noBids);
     face_tag_.resize(noExistingFaces);
     face_normals_.resize(noExistingFaces);
+    geometry_arrays_.reset();
+    face_neighbours_.reset();
 
     if (hasBids)
     {
@@ -1572,7 +1737,7 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
                                           face_tag_, face_normals_, unique_boundary_ids_);
         FaceViaCellHandleWrapper<FaceTagNormalBIdHandle>
             wrappedFaceHandle(faceHandle, view_data.cell_to_face_, cell_to_face_);
-        grid.scatterData(wrappedFaceHandle);
+        scatter.scatterData(wrappedFaceHandle);
     }
     else
     {
@@ -1580,7 +1745,7 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
                                        face_tag_, face_normals_);
         FaceViaCellHandleWrapper<FaceTagNormalHandle>
             wrappedFaceHandle(faceHandle, view_data.cell_to_face_, cell_to_face_);
-        grid.scatterData(wrappedFaceHandle);
+        scatter.scatterData(wrappedFaceHandle);
     }
 
     // Compute the partition type for cell
@@ -1590,11 +1755,8 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
     computePointPartitionType();
 
     computeCommunicationInterfaces(noExistingPoints);
-#else // #if HAVE_MPI
-    static_cast<void>(grid);
-    static_cast<void>(view_data);
-#endif
 }
+#endif // #if HAVE_MPI
 
 void CpGridData::computeCellPartitionType()
 {
@@ -1661,6 +1823,13 @@ void CpGridData::computePointPartitionType()
 void CpGridData::computeCommunicationInterfaces([[maybe_unused]] int noExistingPoints)
 {
 #if HAVE_MPI
+    auto timer = phaseStatistics().time("computeCommunicationInterfaces");
+    // Cached communication plans were set up for the old interfaces. The new
+    // ones share a duplicate of the communicator, which is created here
+    // because duplicating is collective.
+    communication_plans_.clear();
+    communication_plan_count_ = 0;
+    communication_plan_comm_ = duplicateCommunicator(ccobj_);
     // Compute the interface information for cells
     std::get<InteriorBorder_All_Interface>(cell_interfaces_)
         .build(cellRemoteIndices(), EnumItem<AttributeSet, AttributeSet::owner>(),
@@ -1708,6 +1877,197 @@ void CpGridData::computeCommunicationInterfaces([[maybe_unused]] int noExistingP
     }
     createInterfaces(point_attributes, partition_type_indicator_->point_indicator_.begin(),
                      point_interfaces_);
+    timer.stop();
+
+    // Message volume of a full exchange: number of entries sent and received.
+    auto countEntries = [](const InterfaceMap& interfaces) {
+        std::int64_t entries = 0;
+        for (const auto& [proc, send_recv] : interfaces) {
+            entries += send_recv.first.size() + send_recv.second.size();
+        }
+        return entries;
+    };
+    const auto& all_all_cells = std::get<All_All_Interface>(cell_interfaces_).interfaces();
+    auto& statistics = phaseStatistics();
+    statistics.addCounter("computeCommunicationInterfaces", "neighbour_processes",
+                          all_all_cells.size());
+    statistics.addCounter("computeCommunicationInterfaces", "cell_interface_entries",
+                          countEntries(all_all_cells));
+    statistics.addCounter("computeCommunicationInterfaces", "point_interface_entries",
+                          countEntries(std::get<All_All_Interface>(point_interfaces_)));
+#endif
+}
+
+void CpGridData::setupPillarSlabDistribution([[maybe_unused]] const PillarSlab& slab)
+{
+#if HAVE_MPI
+    const int nx = slab.dims[0];
+    const int ny = slab.dims[1];
+    const int nz = slab.dims[2];
+    const int rows = slab.numStoredRows();
+    const int num_cells = size(0);
+    const int num_procs = ccobj_.size();
+
+    // Position of a cell in the (layer, stored row) table.
+    auto rowLayer = [nx, ny, rows, &slab](int cartesian) {
+        const int j = (cartesian / nx) % ny - slab.stored[0];
+        const int k = cartesian / (nx * ny);
+        return static_cast<std::size_t>(k) * rows + j;
+    };
+
+    // Active cells per layer and stored row.
+    std::vector<int> row_count(static_cast<std::size_t>(rows) * nz, 0);
+    for (const auto& cartesian : global_cell_) {
+        ++row_count[rowLayer(cartesian)];
+    }
+
+    // Share the owned rows and the number of owned cells per layer.
+    const int info_size = 2 + nz;
+    std::vector<int> my_info(info_size, 0);
+    my_info[0] = slab.owned[0];
+    my_info[1] = slab.owned[1];
+    for (int k = 0; k < nz; ++k) {
+        for (int j = slab.owned[0]; j < slab.owned[1]; ++j) {
+            my_info[2 + k] += row_count[static_cast<std::size_t>(k) * rows + j - slab.stored[0]];
+        }
+    }
+    std::vector<int> info(static_cast<std::size_t>(info_size) * num_procs);
+    ccobj_.allgather(my_info.data(), info_size, info.data());
+    auto procInfo = [&info, info_size](int proc) {
+        return info.begin() + static_cast<std::size_t>(proc) * info_size;
+    };
+
+    std::vector<int> slab_order(num_procs);
+    std::iota(slab_order.begin(), slab_order.end(), 0);
+    std::ranges::sort(slab_order, [&procInfo](int p1, int p2) {
+        return procInfo(p1)[0] < procInfo(p2)[0];
+    });
+    std::vector<int> slab_begin;
+    slab_begin.reserve(num_procs);
+    int next_row = 0;
+    for (const auto& proc : slab_order) {
+        if (procInfo(proc)[0] != next_row) {
+            OPM_THROW(std::logic_error, "Pillar slabs do not cover the grid without overlap");
+        }
+        slab_begin.push_back(next_row);
+        next_row = procInfo(proc)[1];
+    }
+    if (next_row != ny) {
+        OPM_THROW(std::logic_error, "Pillar slabs do not cover the grid without overlap");
+    }
+
+    // Cells are numbered lexicographically. Hence within a layer the cells
+    // of a slab come right after the ones of the slab in front of it.
+    std::vector<std::int64_t> first_in_layer(static_cast<std::size_t>(num_procs) * nz);
+    std::int64_t num_global_cells = 0;
+    for (int k = 0; k < nz; ++k) {
+        for (const auto& proc : slab_order) {
+            first_in_layer[static_cast<std::size_t>(proc) * nz + k] = num_global_cells;
+            num_global_cells += procInfo(proc)[2 + k];
+        }
+    }
+    if (9 * num_global_cells > std::numeric_limits<int>::max()) {
+        OPM_THROW(std::runtime_error, "Too many cells for integer global ids");
+    }
+
+    // Global index of the first active cell of each stored row and layer.
+    // Rows of other slabs are reached from whichever end of that slab is
+    // stored here, which is always possible as the stored rows are contiguous.
+    std::vector<std::int64_t> first_in_row(row_count.size());
+    std::vector<std::int64_t> before(rows + 1);
+    for (int k = 0; k < nz; ++k) {
+        const auto layer = static_cast<std::size_t>(k) * rows;
+        before[0] = 0;
+        for (int j = 0; j < rows; ++j) {
+            before[j + 1] = before[j] + row_count[layer + j];
+        }
+        for (int j = 0; j < rows; ++j) {
+            const int row = j + slab.stored[0];
+            const auto slab_pos = std::ranges::upper_bound(slab_begin, row) - slab_begin.begin() - 1;
+            const int proc = slab_order[slab_pos];
+            const int begin = procInfo(proc)[0];
+            const int end = procInfo(proc)[1];
+            const auto first = first_in_layer[static_cast<std::size_t>(proc) * nz + k];
+            if (begin >= slab.stored[0]) {
+                first_in_row[layer + j] = first + before[j] - before[begin - slab.stored[0]];
+            } else {
+                assert(end <= slab.stored[1]);
+                first_in_row[layer + j] = first + procInfo(proc)[2 + k]
+                    - (before[end - slab.stored[0]] - before[j]);
+            }
+        }
+    }
+
+    // Global ids: cells first, then corner points, then the remaining points
+    // (fault intersections), then faces. The latter two are only unique, not
+    // matched between processes. Faces cannot be communicated anyway.
+    const int num_points = geomVector<3>().size();
+    const int num_faces = face_to_cell_.size();
+    constexpr int unset = std::numeric_limits<int>::max();
+    std::vector<int> map2GlobalPointId(num_points, unset);
+
+    std::vector<int> map2GlobalCellId(num_cells);
+    std::vector<int> next_in_row(row_count.size(), 0);
+    auto& cell_indexset = cellIndexSet();
+    cell_indexset.beginResize();
+    for (int cell = 0; cell < num_cells; ++cell) {
+        const auto pos = rowLayer(global_cell_[cell]);
+        const int id = static_cast<int>(first_in_row[pos] + next_in_row[pos]++);
+        map2GlobalCellId[cell] = id;
+        const int row = (global_cell_[cell] / nx) % ny;
+        const bool owned = row >= slab.owned[0] && row < slab.owned[1];
+        cell_indexset.add(id, ParallelIndexSet::LocalIndex(cell, owned ? AttributeSet::owner
+                                                                       : AttributeSet::copy, true));
+        // A corner is identified by the first cell (and corner number) it
+        // belongs to. Only correct if all cells at the corner are stored.
+        for (int corner = 0; corner < 8; ++corner) {
+            auto& point_id = map2GlobalPointId[cell_to_point_[cell][corner]];
+            point_id = std::min(point_id, static_cast<int>(num_global_cells + 8 * id + corner));
+        }
+    }
+    cell_indexset.endResize();
+    cellRemoteIndices().template rebuild<false>();
+
+    const int num_other_points = std::ranges::count(map2GlobalPointId, unset);
+    const std::array<int,2> counts{ num_other_points, num_faces };
+    std::vector<int> all_counts(2 * num_procs);
+    ccobj_.allgather(counts.data(), 2, all_counts.data());
+    std::int64_t total_other_points = 0;
+    std::int64_t total_faces = 0;
+    for (int proc = 0; proc < num_procs; ++proc) {
+        total_other_points += all_counts[2 * proc];
+        total_faces += all_counts[2 * proc + 1];
+    }
+    std::int64_t point_offset = 9 * num_global_cells;
+    std::int64_t face_offset = point_offset + total_other_points;
+    if (face_offset + total_faces > unset) {
+        OPM_THROW(std::runtime_error, "Too many entities for integer global ids");
+    }
+    for (int proc = 0; proc < ccobj_.rank(); ++proc) {
+        point_offset += all_counts[2 * proc];
+        face_offset += all_counts[2 * proc + 1];
+    }
+    for (auto& point_id : map2GlobalPointId) {
+        if (point_id == unset) {
+            point_id = point_offset++;
+        }
+    }
+    std::vector<int> map2GlobalFaceId(num_faces);
+    std::iota(map2GlobalFaceId.begin(), map2GlobalFaceId.end(), static_cast<int>(face_offset));
+
+    computeCellPartitionType();
+    computePointPartitionType();
+    computeCommunicationInterfaces(num_points);
+
+    // Corners of overlap cells at the outer boundary of the halo may also
+    // belong to cells that are not stored here. Their owners see all these
+    // cells and hence know the correct ids.
+    const auto& interface = std::get<InteriorBorder_All_Interface>(cell_interfaces_);
+    Communicator comm(interface.communicator(), interface.interfaces());
+    CornerIdDataHandle corner_handle(cell_to_point_, map2GlobalPointId);
+    comm.forward(corner_handle);
+
+    global_id_set_->swap(map2GlobalCellId, map2GlobalFaceId, map2GlobalPointId);
 #endif
 }
 
@@ -1791,7 +2151,18 @@ CpGridData::refineSingleCell(const std::array<int,3>& cells_per_dim, const int&
 {
     // To store the LGR/refined-grid.
     std::vector<std::shared_ptr<CpGridData>> refined_data;
-    std::shared_ptr<CpGridData> refined_grid_ptr = std::make_shared<CpGridData>(refined_data); // ccobj_
+    return refineSingleCell(cells_per_dim, parent_idx, std::make_shared<CpGridData>(refined_data)); // ccobj_
+}
+
+std::tuple< const std::shared_ptr<CpGridData>,
+            const std::vector<std::array<int,2>>,
+            const std::vector<std::tuple<int,std::vector<int>>>,
+            const std::tuple<int, std::vector<int>>,
+            const std::vector<std::array<int,2>>,
+            const std::vector<std::array<int,2>>>
+CpGridData::refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx,
+                             std::shared_ptr<CpGridData> refined_grid_ptr) const
+{
     auto& refined_grid = *refined_grid_ptr;
     DefaultGeometryPolicy& refined_geometries = refined_grid.geometry_;
     std::vector<std::array<int,8>>& refined_cell_to_point = refined_grid.cell_to_point_;
@@ -63,17 +63,27 @@
 #include <opm/input/eclipse/EclipseState/Grid/NNC.hpp>
 #endif
 
+#include <opm/grid/common/FaceNeighbours.hpp>
 #include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/utility/PhaseStatistics.hpp>
 
+#include "CommunicationPlan.hpp"
 #include "Entity2IndexDataHandle.hpp"
 #include "CpGridDataTraits.hpp"
 //#include "DataHandleWrappers.hpp"
 //#include "GlobalIdMapping.hpp"
 #include "Geometry.hpp"
+#include "GeometryArrays.hpp"
+#include "PillarSlab.hpp"
 
 #include <array>
 #include <initializer_list>
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
+#include <tuple>
+#include <typeindex>
 #include <vector>
 
 namespace Opm
@@ -89,6 +99,7 @@ namespace cpgrid
 
 class IndexSet;
 class IdSet;
+class ImplicitRefinedLevel;
 class LevelGlobalIdSet;
 class PartitionTypeIndicator;
 template<int,int> class Geometry;
@@ -313,6 +324,61 @@ public:
                               double tolerance_unique_points,
                               bool edge_conformal);
 
+    /// Read one pillar slab of the Eclipse grid format ('.grdecl').
+    ///
+    /// In contrast to processEclipseFormat() this is called on all
+    /// processes, each with the rows of its own slab (see
+    /// extractPillarSlab()). No process ever holds the whole grid. Cells
+    /// in the owned rows of the slab become interior cells, those in the
+    /// halo rows overlap cells. Global ids are agreed upon collectively.
+    ///
+    /// \param[in] input_data The grid description of the stored rows of
+    /// the slab.
+    ///
+    /// \param[in] slab The rows owned and stored by this process.
+    ///
+    /// \param[in] turn_normals Whether or not to turn all normals.
+    /// This is intended for handling inputs with wrong orientations.
+    ///
+    /// \param[in] pinchActive Whether or not to force specific pinch
+    /// behaviour. See processEclipseFormat().
+    ///
+    /// \param[in] tolerance_unique_points Tolerance used to identify points
+    /// based on their cooridinate.
+    ///
+    /// \param[in] edge_conformal Whether or not to construct an
+    /// edge-conformal grid.  Typically useful in geo-mechanical
+    /// applications.
+    void processDistributedEclipseFormat(const grdecl& input_data,
+                                         const PillarSlab& slab,
+                                         bool turn_normals,
+                                         bool pinchActive,
+                                         double tolerance_unique_points,
+                                         bool edge_conformal);
+
+    /// Write the processed grid to a binary snapshot file.
+    ///
+    /// The snapshot holds the topology, the geometry, the global cell
+    /// indices, face tags, boundary ids, aquifer cells and ZCORN of this
+    /// grid, such that readSnapshot() can restore it without processing
+    /// the corner-point description again. Only supported for a serial
+    /// grid without refinement.
+    ///
+    /// \param[in] filename The file to write.
+    void writeSnapshot(const std::string& filename) const;
+
+    /// Read a grid written by writeSnapshot().
+    ///
+    /// The file is memory mapped and all sections are validated before
+    /// this grid is modified, hence a corrupt file leaves the grid unchanged.
+    /// The grid containers own their storage, so every section is copied
+    /// once out of the mapping; the reload is not zero-copy, but does not
+    /// parse or process the corner-point description. Like
+    /// processEclipseFormat() this is only supported on rank 0.
+    ///
+    /// \param[in] filename The file to read.
+    void readSnapshot(const std::string& filename);
+
     /// @brief
     ///    Extract Cartesian index triplet (i,j,k) of an active cell.
     ///
@@ -483,6 +549,28 @@ public:
         return geometry_;
     }
 
+    /// \brief Get the cell and face geometry as structure of arrays.
+    ///
+    /// The arrays are created on the first call and kept until the
+    /// geometry is rebuilt. The first call is not thread safe.
+    const GeometryArrays& geometryArrays() const;
+
+    /// \brief Get the flat face-cell adjacency.
+    ///
+    /// Created on the first call and shared by all later callers.
+    /// Faces along the front of a distributed grid, whose other cell
+    /// is not present on this process, are not interior faces.
+    /// The first call is not thread safe.
+    std::shared_ptr<const FaceNeighbours> faceNeighbours() const;
+
+    /// \brief Get the timings and counters of the setup phases run on this data.
+    ///
+    /// Shared with the other data of the same CpGrid.
+    Opm::PhaseStatistics& phaseStatistics() const
+    {
+        return *phase_statistics_;
+    }
+
     int getLeafIdxFromLevelIdx(int level_cell_idx) const
     {
         if (level_to_leaf_cells_.empty()) {
@@ -520,6 +608,22 @@ public:
                 const std::vector<std::array<int,2>>>                // child_to_parent_cells
     refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx) const;
 
+    /// @brief Refine a single cell into a given, newly constructed CpGridData object.
+    ///
+    /// Same as refineSingleCell() above, but does not construct the refined grid. Constructing a
+    /// CpGridData object calls MPI, whereas filling it does not. Hence the refined grids can be
+    /// constructed serially and then be filled from several threads.
+    ///
+    /// @param [in] refined_grid_ptr              Empty grid to store the refined cell in.
+    std::tuple< const std::shared_ptr<CpGridData>,
+                const std::vector<std::array<int,2>>,
+                const std::vector<std::tuple<int,std::vector<int>>>,
+                const std::tuple<int, std::vector<int>>,
+                const std::vector<std::array<int,2>>,
+                const std::vector<std::array<int,2>>>
+    refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx,
+                     std::shared_ptr<CpGridData> refined_grid_ptr) const;
+
     // @breif Compute center of an entity/element/cell in the Eclipse way:
     //        - Average of the 4 corners of the bottom face.
     //        - Average of the 4 corners of the top face.
@@ -594,7 +698,8 @@ public:
 
     /// \brief Redistribute a global grid.
     ///
-    /// The whole grid must be available on all processors.
+    /// The whole grid must be available on all processors. The data is moved
+    /// through the scatter/gather interfaces of the grid.
     void distributeGlobalGrid(CpGrid& grid,
                               const CpGridData& view_data,
                               const std::vector<int>& cell_part);
@@ -607,6 +712,30 @@ public:
     template<class DataHandle>
     void communicate(DataHandle& data, InterfaceType iftype, CommunicationDirection dir);
 
+    /// \brief Create a persistent plan for communicating data of fixed size.
+    /// \param data The data handle describing the data. Has to adhere to the
+    /// Dune::DataHandleIF interface.
+    /// \param iftype The interface to use for the communication.
+    /// \param dir The direction of the communication along the interface (forward or backward).
+    template<class DataHandle>
+    CommunicationPlan<DataHandle> communicationPlan(DataHandle& data, InterfaceType iftype,
+                                                    CommunicationDirection dir);
+
+    /// \brief Start communicating objects for all codims on a given level.
+    ///
+    /// Data of fixed size is communicated with a plan that is cached for the
+    /// type of the data handle, the interface, the direction and the number of
+    /// items per cell and point. All cached plans send on one duplicate of the
+    /// communicator, hence creating them does not communicate. Data of variable
+    /// size is communicated before returning.
+    /// \param data The data handle describing the data. Has to adhere to the
+    /// Dune::DataHandleIF interface.
+    /// \param iftype The interface to use for the communication.
+    /// \param dir The direction of the communication along the interface (forward or backward).
+    template<class DataHandle>
+    PendingCommunication<DataHandle> startCommunicate(DataHandle& data, InterfaceType iftype,
+                                                      CommunicationDirection dir);
+
     void computeCellPartitionType();
 
     void computePointPartitionType();
@@ -685,6 +814,10 @@ private:
     /// \brief Adds entries to the parallel index set of the cells during grid construction
     void populateGlobalCellIndexSet();
 
+    /// \brief Sets up global ids, index set, partition types and interfaces
+    /// of a grid built by processDistributedEclipseFormat().
+    void setupPillarSlabDistribution(const PillarSlab& slab);
+
 #if HAVE_MPI
 
     /// \brief Gather data on a global grid representation.
@@ -753,9 +886,23 @@ private:
     void communicateCodim(Entity2IndexDataHandle<DataHandle, codim>& data, CommunicationDirection dir,
                           const InterfaceMap& interface);
 
-#endif
-
-    void computeGeometry(const CpGrid& grid,
+    /// \brief Set up this view from another view of the same grid.
+    ///
+    /// The cells of this view are given by its cell index set. Their data is
+    /// moved from view_data through the given cell interfaces, the point
+    /// interfaces are computed on the way. The grid and its interfaces are
+    /// not used.
+    /// \param view_data The view to read the cells from.
+    /// \param cell_interfaces The interfaces from the cells of view_data to the cells of this view.
+    /// \param point_interfaces Filled with the interfaces for the points.
+    void distributeGlobalGrid(const CpGridData& view_data,
+                              const InterfaceMap& cell_interfaces,
+                              InterfaceMap& point_interfaces);
+
+    /// \brief Scatters data from another view to this one through given interfaces.
+    struct ViewScatter;
+
+    void computeGeometry(const ViewScatter& scatter,
                          const DefaultGeometryPolicy&  globalGeometry,
                          const std::vector<int>& globalAquiferCells,
                          const OrientedEntityTable<0, 1>& globalCell2Faces,
@@ -763,6 +910,7 @@ private:
                          std::vector<int>& aquiferCells,
                          const OrientedEntityTable<0, 1>& cell2Faces,
                          const std::vector< std::array<int,8> >& cell2Points);
+#endif
 
     // Representing the topology
     /** @brief Container for lookup of the faces attached to each cell. */
@@ -801,6 +949,12 @@ private:
     typedef FieldVector<double, 3> PointType;
     /** @brief The face normals of the grid. */
     cpgrid::SignedEntityVariable<PointType, 1> face_normals_;
+    /** @brief The geometry as structure of arrays, created on demand. */
+    mutable std::unique_ptr<GeometryArrays> geometry_arrays_;
+    /** @brief The flat face-cell adjacency, created on demand. */
+    mutable std::shared_ptr<const FaceNeighbours> face_neighbours_;
+    /** @brief Timings and counters of the setup phases. */
+    std::shared_ptr<Opm::PhaseStatistics> phase_statistics_ = std::make_shared<Opm::PhaseStatistics>();
     /** @brief The boundary ids. */
     cpgrid::EntityVariable<int, 1> unique_boundary_ids_;
     /** @brief The index set of the grid (level). */
@@ -859,6 +1013,18 @@ private:
     /// \brief OwnerOverlap communication for cells
     CommunicationType cell_comm_;
 
+    /// \brief Type of the data handle, interface, direction and the number of
+    ///        items per cell and per point (zero if not communicated).
+    using CommunicationPlanKey = std::tuple<std::type_index, InterfaceType, CommunicationDirection,
+                                            std::size_t, std::size_t>;
+    /// \brief Plans used by startCommunicate(). There is more than one plan for
+    ///        a key only if several communications of that kind were active at once.
+    std::map<CommunicationPlanKey, std::vector<std::shared_ptr<void>>> communication_plans_;
+    /// \brief The duplicate of the communicator shared by the cached plans.
+    SharedCommunicator communication_plan_comm_;
+    /// \brief The number of cached plans created, which determines their tags.
+    int communication_plan_count_ = 0;
+
     /// \brief Communication interface for the cells.
     std::tuple<Interface,Interface,Interface,Interface,Interface> cell_interfaces_;
     /*
@@ -884,6 +1050,7 @@ private:
     friend class Dune::CpGrid;
     template<int> friend class Entity;
     template<int> friend class EntityRep;
+    friend class ImplicitRefinedLevel;
     friend class Intersection;
     friend class PartitionTypeIndicator;
 };
@@ -962,6 +1129,63 @@ void CpGridData::communicate(DataHandle& data, InterfaceType iftype,
     (void) dir;
 #endif
 }
+
+template<class DataHandle>
+CommunicationPlan<DataHandle> CpGridData::communicationPlan([[maybe_unused]] DataHandle& data,
+                                                            [[maybe_unused]] InterfaceType iftype,
+                                                            [[maybe_unused]] CommunicationDirection dir)
+{
+#if HAVE_MPI
+    return CommunicationPlan<DataHandle>(*this, ccobj_, data,
+                                         getInterface(iftype, cell_interfaces_).interfaces(),
+                                         getInterface(iftype, point_interfaces_), dir);
+#else
+    return {};
+#endif
+}
+
+template<class DataHandle>
+PendingCommunication<DataHandle> CpGridData::startCommunicate(DataHandle& data, InterfaceType iftype,
+                                                              CommunicationDirection dir)
+{
+    if ((data.contains(3, 0) && !data.fixedSize(3, 0)) ||
+        (data.contains(3, 3) && !data.fixedSize(3, 3)))
+    {
+        // The message sizes are only known after a handshake.
+        communicate(data, iftype, dir);
+        return {};
+    }
+#if HAVE_MPI
+    using Plan = CommunicationPlan<DataHandle>;
+    // Fixed size data has the same number of items for all entities and
+    // processes. Processes without cells do not communicate, hence all
+    // processes that exchange messages agree on the keys, create their plans
+    // in the same order and thereby give them the same tags.
+    const auto items = [this, &data](auto codim) -> std::size_t
+    {
+        constexpr int c = decltype(codim)::value;
+        return (data.contains(3, c) && size(c) > 0) ? data.size(Entity<c>(*this, 0, true)) : 0;
+    };
+    auto& plans = communication_plans_[{std::type_index(typeid(DataHandle)), iftype, dir,
+                                        items(std::integral_constant<int, 0>()),
+                                        items(std::integral_constant<int, 3>())}];
+    for (const auto& cached : plans) {
+        auto plan = std::static_pointer_cast<Plan>(cached);
+        if (!plan->active())
+            return PendingCommunication<DataHandle>(std::move(plan), data);
+    }
+    // Each plan uses two tags, the upper bound of tags is at least 32767.
+    if (communication_plan_count_ == 16383)
+        OPM_THROW(std::runtime_error, "Too many kinds of data were communicated with startCommunicate");
+    auto plan = std::make_shared<Plan>(*this, communication_plan_comm_, 2 * communication_plan_count_++,
+                                       data, getInterface(iftype, cell_interfaces_).interfaces(),
+                                       getInterface(iftype, point_interfaces_), dir);
+    plans.push_back(plan);
+    return PendingCommunication<DataHandle>(std::move(plan), data);
+#else
+    return {};
+#endif
+}
 }}
 
 #if HAVE_MPI
@@ -0,0 +1,71 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_CPGRID_GEOMETRYARRAYS_HEADER_INCLUDED
+#define OPM_GRID_CPGRID_GEOMETRYARRAYS_HEADER_INCLUDED
+
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Cell and face geometry of a grid stored as structure of arrays.
+///
+/// Each array is indexed by the cell or face index, and holds the
+/// same values as the corresponding Geometry objects and face normals
+/// of the grid. Kernels that stream through all cells or faces can use
+/// these contiguous arrays directly instead of Entity::geometry().
+struct GeometryArrays
+{
+    /// \brief The volume of each cell.
+    std::vector<double> cell_volume;
+    /// \brief The centroid of each cell.
+    std::vector<double> cell_centroid_x;
+    std::vector<double> cell_centroid_y;
+    std::vector<double> cell_centroid_z;
+    /// \brief The area of each face.
+    std::vector<double> face_area;
+    /// \brief The centroid of each face.
+    std::vector<double> face_centroid_x;
+    std::vector<double> face_centroid_y;
+    std::vector<double> face_centroid_z;
+    /// \brief The unit normal of each face.
+    std::vector<double> face_normal_x;
+    std::vector<double> face_normal_y;
+    std::vector<double> face_normal_z;
+
+    /// \brief Number of cells.
+    int numCells() const
+    {
+        return cell_volume.size();
+    }
+
+    /// \brief Number of faces.
+    int numFaces() const
+    {
+        return face_area.size();
+    }
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_GRID_CPGRID_GEOMETRYARRAYS_HEADER_INCLUDED
@@ -0,0 +1,488 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#include <opm/grid/cpgrid/CpGridData.hpp>
+#include <opm/grid/cpgrid/Indexsets.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Layout of a snapshot file (native byte order):
+//
+//   header:   8 byte magic, uint32 version, uint32 byte order mark,
+//             int32 logical Cartesian size[3], int32 use_unique_boundary_ids
+//   sections: uint64 number of entries, uint64 entry size, entries,
+//             padding to a multiple of 8 bytes
+//
+// The sections are stored in the fixed order of writeSnapshot(). All
+// offsets stay 8 byte aligned, such that the mapped sections can be
+// read in place.
+
+namespace Dune
+{
+namespace cpgrid
+{
+namespace
+{
+
+constexpr char snapshotMagic[8] = {'O', 'P', 'M', 'C', 'P', 'G', 'R', 'D'};
+constexpr std::uint32_t snapshotVersion = 1;
+constexpr std::uint32_t snapshotByteOrder = 0x01020304;
+
+struct SnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::int32_t dims[3];
+    std::int32_t use_unique_boundary_ids;
+};
+static_assert(sizeof(SnapshotHeader) % 8 == 0);
+
+template<class Table>
+std::vector<int> encodeEntityTable(const Table& table, std::vector<int>& row_starts)
+{
+    std::vector<int> data;
+    data.reserve(table.dataSize());
+    row_starts.assign(1, 0);
+    row_starts.reserve(table.size() + 1);
+    for (int i = 0; i < table.size(); ++i) {
+        const auto row = table[typename Table::FromType(i, true)];
+        for (int j = 0; j < row.size(); ++j) {
+            // Same representation as EntityRep uses internally.
+            data.push_back(row[j].orientation() ? row[j].index() : ~row[j].index());
+        }
+        row_starts.push_back(row_starts.back() + row.size());
+    }
+    return data;
+}
+
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(const std::string& filename)
+        : filename_(filename), out_(filename, std::ios::binary)
+    {
+        if (!out_) {
+            OPM_THROW(std::runtime_error, "Could not open grid snapshot " + filename + " for writing.");
+        }
+    }
+
+    void write(const void* data, std::size_t size)
+    {
+        out_.write(static_cast<const char*>(data), size);
+        if (!out_) {
+            OPM_THROW(std::runtime_error, "Could not write grid snapshot " + filename_ + ".");
+        }
+    }
+
+    template<class T>
+    void section(const T* data, std::size_t count)
+    {
+        const std::uint64_t section_header[2] = {count, sizeof(T)};
+        write(section_header, sizeof(section_header));
+        if (count > 0) {
+            write(data, count * sizeof(T));
+        }
+        const std::size_t padding = (8 - (count * sizeof(T)) % 8) % 8;
+        const char zeros[8] = {};
+        write(zeros, padding);
+    }
+
+    template<class T>
+    void section(const std::vector<T>& data)
+    {
+        section(data.data(), data.size());
+    }
+
+private:
+    std::string filename_;
+    std::ofstream out_;
+};
+
+/// Read-only memory mapping of a whole snapshot file.
+class MappedSnapshot
+{
+public:
+    explicit MappedSnapshot(const std::string& filename)
+        : filename_(filename)
+    {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            OPM_THROW(std::runtime_error, "Could not open grid snapshot " + filename + ".");
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            OPM_THROW(std::runtime_error, "Could not determine size of grid snapshot " + filename + ".");
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0) {
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                OPM_THROW(std::runtime_error, "Could not map grid snapshot " + filename + ".");
+            }
+            data_ = static_cast<const char*>(addr);
+        }
+        // The mapping stays valid after closing the file.
+        ::close(fd);
+    }
+
+    ~MappedSnapshot()
+    {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    MappedSnapshot(const MappedSnapshot&) = delete;
+    MappedSnapshot& operator=(const MappedSnapshot&) = delete;
+
+    const char* take(std::size_t size)
+    {
+        if (size > size_ - pos_) {
+            OPM_THROW(std::runtime_error, "Grid snapshot " + filename_ + " is truncated.");
+        }
+        const char* ptr = data_ + pos_;
+        pos_ += size;
+        return ptr;
+    }
+
+    /// Get the next section, checking its entry size and, if
+    /// expected is not negative, its number of entries.
+    template<class T>
+    std::pair<const T*, std::size_t> section(long long expected = -1)
+    {
+        std::uint64_t section_header[2];
+        std::memcpy(section_header, take(sizeof(section_header)), sizeof(section_header));
+        const auto count = section_header[0];
+        if (section_header[1] != sizeof(T) ||
+            (expected >= 0 && count != static_cast<std::uint64_t>(expected)) ||
+            count > (size_ - pos_) / sizeof(T)) {
+            OPM_THROW(std::runtime_error, "Inconsistent section in grid snapshot " + filename_ + ".");
+        }
+        const auto bytes = static_cast<std::size_t>(count) * sizeof(T);
+        const auto* ptr = reinterpret_cast<const T*>(take(bytes));
+        take((8 - bytes % 8) % 8);
+        return {ptr, static_cast<std::size_t>(count)};
+    }
+
+    template<class T>
+    std::vector<T> vector(long long expected = -1)
+    {
+        const auto [ptr, count] = section<T>(expected);
+        return std::vector<T>(ptr, ptr + count);
+    }
+
+    std::vector<FieldVector<double, 3>> points(long long expected)
+    {
+        static_assert(sizeof(FieldVector<double, 3>) == 3 * sizeof(double));
+        const auto [ptr, count] = section<double>(3 * expected);
+        std::vector<FieldVector<double, 3>> result(expected);
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(result.data()), ptr, count * sizeof(double));
+        }
+        return result;
+    }
+
+private:
+    std::string filename_;
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t pos_ = 0;
+};
+
+template<int codim>
+std::vector<EntityRep<codim>> decodeEntities(const std::vector<int>& data)
+{
+    std::vector<EntityRep<codim>> result;
+    result.reserve(data.size());
+    for (const int erep : data) {
+        result.emplace_back(erep < 0 ? ~erep : erep, erep >= 0);
+    }
+    return result;
+}
+
+std::vector<int> rowSizes(const std::vector<int>& row_starts, std::size_t data_size,
+                          const std::string& filename)
+{
+    if (row_starts.empty() || row_starts.front() != 0 ||
+        static_cast<std::size_t>(row_starts.back()) != data_size) {
+        OPM_THROW(std::runtime_error, "Invalid row starts in grid snapshot " + filename + ".");
+    }
+    std::vector<int> sizes(row_starts.size() - 1);
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        sizes[i] = row_starts[i + 1] - row_starts[i];
+        if (sizes[i] < 0) {
+            OPM_THROW(std::runtime_error, "Invalid row starts in grid snapshot " + filename + ".");
+        }
+    }
+    return sizes;
+}
+
+} // anonymous namespace
+
+void CpGridData::writeSnapshot(const std::string& filename) const
+{
+    if (level_data_ptr_->size() > 1) {
+        OPM_THROW(std::logic_error, "Grid snapshots are not supported for refined grids.");
+    }
+    SnapshotWriter out(filename);
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = snapshotVersion;
+    header.byte_order = snapshotByteOrder;
+    for (int d = 0; d < 3; ++d) {
+        header.dims[d] = logical_cartesian_size_[d];
+    }
+    header.use_unique_boundary_ids = use_unique_boundary_ids_;
+    out.write(&header, sizeof(header));
+
+    std::vector<int> row_starts;
+    out.section(encodeEntityTable(cell_to_face_, row_starts));
+    out.section(row_starts);
+    out.section(encodeEntityTable(face_to_cell_, row_starts));
+    out.section(row_starts);
+    out.section(face_to_point_.dataStorage());
+    out.section(face_to_point_.rowStarts());
+    out.section(cell_to_point_.empty() ? nullptr : cell_to_point_.front().data(),
+                8 * cell_to_point_.size());
+    out.section(global_cell_);
+    std::vector<std::int32_t> tags(face_tag_.begin(), face_tag_.end());
+    out.section(tags);
+
+    const auto& points = geomVector<3>();
+    const auto& cells = geomVector<0>();
+    const auto& faces = geomVector<1>();
+    std::vector<double> coords;
+    std::vector<double> measures;
+    auto writeGeometry = [&](const auto& geoms, bool with_measure) {
+        coords.clear();
+        measures.clear();
+        for (const auto& geom : geoms) {
+            const auto& center = geom.center();
+            coords.insert(coords.end(), center.begin(), center.end());
+            if (with_measure) {
+                measures.push_back(geom.volume());
+            }
+        }
+        out.section(coords);
+        if (with_measure) {
+            out.section(measures);
+        }
+    };
+    writeGeometry(points, false);
+    writeGeometry(cells, true);
+    writeGeometry(faces, true);
+    coords.clear();
+    const int num_normals = face_normals_.size();
+    for (int f = 0; f < num_normals; ++f) {
+        const auto& normal = face_normals_.get(f);
+        coords.insert(coords.end(), normal.begin(), normal.end());
+    }
+    out.section(coords);
+
+    out.section(unique_boundary_ids_.data(), unique_boundary_ids_.size());
+    out.section(aquifer_cells_);
+    out.section(zcorn);
+}
+
+void CpGridData::readSnapshot(const std::string& filename)
+{
+    if (ccobj_.rank() != 0) {
+        OPM_THROW(std::logic_error, "Reading a grid snapshot is only supported on rank 0");
+    }
+
+    MappedSnapshot in(filename);
+    SnapshotHeader header;
+    std::memcpy(&header, in.take(sizeof(header)), sizeof(header));
+    if (std::memcmp(header.magic, snapshotMagic, sizeof(snapshotMagic)) != 0) {
+        OPM_THROW(std::runtime_error, filename + " is not a grid snapshot.");
+    }
+    if (header.byte_order != snapshotByteOrder) {
+        OPM_THROW(std::runtime_error, "Grid snapshot " + filename + " has a different byte order.");
+    }
+    if (header.version != snapshotVersion) {
+        OPM_THROW(std::runtime_error, "Unsupported version " + std::to_string(header.version) +
+                  " of grid snapshot " + filename + ".");
+    }
+
+    // Topology
+    const auto cell_faces = in.vector<int>();
+    const auto cell_face_starts = in.vector<int>();
+    const auto cell_face_sizes = rowSizes(cell_face_starts, cell_faces.size(), filename);
+    const auto cell_face_reps = decodeEntities<1>(cell_faces);
+    const long long nc = cell_face_sizes.size();
+
+    const auto face_cells = in.vector<int>();
+    const auto face_cell_starts = in.vector<int>();
+    const auto face_cell_sizes = rowSizes(face_cell_starts, face_cells.size(), filename);
+    const auto face_cell_reps = decodeEntities<0>(face_cells);
+    const long long nf = face_cell_sizes.size();
+
+    auto face_points = in.vector<int>();
+    auto face_point_starts = in.vector<int>(nf + 1);
+    rowSizes(face_point_starts, face_points.size(), filename);
+
+    std::vector<std::array<int, 8>> cell_points(nc);
+    {
+        const auto [ptr, count] = in.section<int>(8 * nc);
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(cell_points.data()), ptr, count * sizeof(int));
+        }
+    }
+    auto global_cell = in.vector<int>(nc);
+    const auto tags = in.vector<std::int32_t>(nf);
+
+    // Geometry
+    const auto [point_coords, np3] = in.section<double>();
+    if (np3 % 3 != 0) {
+        OPM_THROW(std::runtime_error, "Inconsistent section in grid snapshot " + filename + ".");
+    }
+    const auto np = static_cast<int>(np3 / 3);
+    const auto cell_centroids = in.points(nc);
+    const auto [cell_volumes, nc_vol] = in.section<double>(nc);
+    const auto face_centroids = in.points(nf);
+    const auto [face_areas, nf_area] = in.section<double>(nf);
+    const auto normals = in.points(nf);
+
+    const auto boundary_ids = in.vector<int>(nf);
+    auto aquifer_cells = in.vector<int>();
+    auto zcorn_values = in.vector<double>();
+
+    // Validate the indices against the entity counts of the file.
+    auto checkRange = [&filename](const auto& values, long long end, const std::string& what) {
+        for (const auto& value : values) {
+            if (value < 0 || value >= end) {
+                OPM_THROW(std::runtime_error, "Invalid " + what + " in grid snapshot " + filename + ".");
+            }
+        }
+    };
+    auto indices = [](const auto& entity_reps) {
+        std::vector<int> result;
+        result.reserve(entity_reps.size());
+        for (const auto& erep : entity_reps) {
+            result.push_back(erep.index());
+        }
+        return result;
+    };
+    checkRange(indices(cell_face_reps), nf, "cell face");
+    checkRange(indices(face_cell_reps), nc, "face cell");
+    checkRange(face_points, np, "face point");
+    for (const auto& corners : cell_points) {
+        checkRange(corners, np, "cell corner");
+    }
+    long long num_cartesian_cells = 1;
+    for (int d = 0; d < 3; ++d) {
+        if (header.dims[d] < 0) {
+            OPM_THROW(std::runtime_error, "Invalid logical Cartesian size in grid snapshot " + filename + ".");
+        }
+        num_cartesian_cells *= header.dims[d];
+    }
+    checkRange(global_cell, num_cartesian_cells, "global cell");
+    // I_FACE is the first and NNC_FACE the last face tag.
+    checkRange(tags, NNC_FACE + 1, "face tag");
+
+    // Set up the grid in local containers, only the final moves modify this grid.
+    OrientedEntityTable<0, 1> cell_to_face(cell_face_reps.begin(), cell_face_reps.end(),
+                                           cell_face_sizes.begin(), cell_face_sizes.end());
+    OrientedEntityTable<1, 0> face_to_cell(face_cell_reps.begin(), face_cell_reps.end(),
+                                           face_cell_sizes.begin(), face_cell_sizes.end());
+    Opm::SparseTable<int> face_to_point(std::move(face_points), std::move(face_point_starts));
+    EntityVariable<enum face_tag, 1> face_tag;
+    face_tag.reserve(nf);
+    for (const auto& tag : tags) {
+        face_tag.push_back(static_cast<enum face_tag>(tag));
+    }
+    SignedEntityVariable<PointType, 1> face_normals;
+    face_normals.assign(normals.begin(), normals.end());
+    EntityVariable<int, 1> unique_boundary_ids;
+    unique_boundary_ids.assign(boundary_ids.begin(), boundary_ids.end());
+
+    // The cell geometries refer to the point container and the corners of this grid.
+    // Both stay at their addresses when moved into place below.
+    auto point_geom_ptr = geometry_.geomVector(std::integral_constant<int, 3>());
+    EntityVariable<Geometry<0, 3>, 3> point_geom;
+    point_geom.reserve(np);
+    for (int p = 0; p < np; ++p) {
+        PointType pt;
+        for (int d = 0; d < 3; ++d) {
+            pt[d] = point_coords[3 * p + d];
+        }
+        point_geom.push_back(Geometry<0, 3>(pt));
+    }
+    EntityVariable<Geometry<3, 3>, 0> cell_geom;
+    cell_geom.reserve(nc);
+    for (long long c = 0; c < nc; ++c) {
+        cell_geom.push_back(Geometry<3, 3>(cell_centroids[c], cell_volumes[c],
+                                           point_geom_ptr, cell_points[c].data()));
+    }
+    EntityVariable<Geometry<2, 3>, 1> face_geom;
+    face_geom.reserve(nf);
+    for (long long f = 0; f < nf; ++f) {
+        face_geom.push_back(Geometry<2, 3>(face_centroids[f], face_areas[f]));
+    }
+    auto index_set = std::make_unique<IndexSet>(nc, np);
+
+    // Everything has been read and validated, replace the grid.
+    cell_to_face_ = std::move(cell_to_face);
+    face_to_cell_ = std::move(face_to_cell);
+    face_to_point_ = std::move(face_to_point);
+    cell_to_point_ = std::move(cell_points);
+    global_cell_ = std::move(global_cell);
+    face_tag_ = std::move(face_tag);
+    for (int d = 0; d < 3; ++d) {
+        logical_cartesian_size_[d] = header.dims[d];
+    }
+    use_unique_boundary_ids_ = header.use_unique_boundary_ids != 0;
+    unique_boundary_ids_ = std::move(unique_boundary_ids);
+    aquifer_cells_ = std::move(aquifer_cells);
+    zcorn = std::move(zcorn_values);
+
+    geometry_arrays_.reset();
+    face_neighbours_.reset();
+    *point_geom_ptr = std::move(point_geom);
+    *geometry_.geomVector(std::integral_constant<int, 0>()) = std::move(cell_geom);
+    *geometry_.geomVector(std::integral_constant<int, 1>()) = std::move(face_geom);
+    face_normals_ = std::move(face_normals);
+    index_set_ = std::move(index_set);
+
+    if (ccobj_.size() > 1) {
+        populateGlobalCellIndexSet();
+    }
+}
+
+} // namespace cpgrid
+} // namespace Dune
@@ -0,0 +1,187 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/grid/cpgrid/ImplicitRefinedLevel.hpp>
+
+#include <opm/grid/common/Volumes.hpp>
+#include <opm/grid/cpgrid/EntityRep.hpp>
+#include <opm/grid/cpgrid/LgrHelpers.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+
+using GlobalCoordinate = Dune::cpgrid::ImplicitRefinedLevel::GlobalCoordinate;
+
+/// Volume of a hexahedron as the sum of 24 tetrahedra, each one built with the center of the hexahedron,
+/// the centroid of one of its faces and one edge of that face, as in Geometry<3,3>::refineCellifiedPatch().
+double hexahedronVolume(const std::array<GlobalCoordinate,8>& corners)
+{
+    GlobalCoordinate center = {0., 0., 0.};
+    for (const auto& corner : corners) {
+        center += corner;
+    }
+    center /= 8.;
+    // Corners of bottom, front, left, right, back, and top faces. {0,1}, {0,2}, {1,3}, {2,3} are the edges of each face.
+    static constexpr int face_corners[6][4] = { {0, 1, 2, 3}, {0, 1, 4, 5}, {0, 2, 4, 6},
+                                                {1, 3, 5, 7}, {2, 3, 6, 7}, {4, 5, 6, 7} };
+    static constexpr int face_edges[4][2] = { {0, 1}, {0, 2}, {1, 3}, {2, 3} };
+    double volume = 0.;
+    for (const auto& face : face_corners) {
+        GlobalCoordinate face_center = {0., 0., 0.};
+        for (const auto& corner : face) {
+            face_center += corners[corner];
+        }
+        face_center /= 4.;
+        for (const auto& edge : face_edges) {
+            const GlobalCoordinate tetra_corners[4] = { corners[face[edge[0]]],
+                                                        corners[face[edge[1]]],
+                                                        face_center,
+                                                        center };
+            volume += std::fabs(Dune::simplex_volume(tetra_corners));
+        }
+    }
+    return volume;
+}
+
+} // namespace
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+ImplicitRefinedLevel::ImplicitRefinedLevel(std::shared_ptr<const CpGridData> parent_grid,
+                                           const std::array<int,3>& cells_per_dim)
+    : parent_grid_(std::move(parent_grid))
+    , cells_per_dim_(cells_per_dim)
+{
+    for (const auto& nd : cells_per_dim_) {
+        if (nd <= 0) {
+            OPM_THROW(std::invalid_argument, "Refinement factor must be positive.");
+        }
+    }
+
+    const int num_parents = parent_grid_->size(0);
+    volume_correction_.resize(num_parents, 1.);
+    for (int parent = 0; parent < num_parents; ++parent) {
+        // Neighbors across parent faces are only well-defined if each side of the parent cell is a single face.
+        for (const auto& tag : {face_tag::K_FACE, face_tag::I_FACE, face_tag::J_FACE}) {
+            parentNeighbor(parent, tag, false);
+            parentNeighbor(parent, tag, true);
+        }
+        // Same rescaling as in refineCellifiedPatch(): the volumes of the children add up to the parent volume.
+        double sum_all_refined_cell_volumes = 0.;
+        for (int idx = 0; idx < childrenPerParent(); ++idx) {
+            sum_all_refined_cell_volumes += hexahedronVolume(corners(refinedCell(parent, idx)));
+        }
+        const double parent_volume = parent_grid_->geomVector<0>()[EntityRep<0>(parent, true)].volume();
+        if (std::fabs(sum_all_refined_cell_volumes - parent_volume) > std::numeric_limits<double>::epsilon()) {
+            volume_correction_[parent] = parent_volume / sum_all_refined_cell_volumes;
+        }
+    }
+}
+
+std::array<ImplicitRefinedLevel::GlobalCoordinate,8> ImplicitRefinedLevel::corners(int cell) const
+{
+    const auto& parent_geometry = parent_grid_->geomVector<0>()[EntityRep<0>(parentCell(cell), true)];
+    const auto& reference_corners = parent_grid_->getReferenceRefinedCorners(idxInParentCell(cell), cells_per_dim_);
+    std::array<GlobalCoordinate,8> refined_corners;
+    for (int corn = 0; corn < 8; ++corn) {
+        refined_corners[corn] = parent_geometry.global(reference_corners[corn]);
+    }
+    return refined_corners;
+}
+
+ImplicitRefinedLevel::GlobalCoordinate ImplicitRefinedLevel::center(int cell) const
+{
+    GlobalCoordinate refined_cell_center = {0., 0., 0.};
+    for (const auto& corner : corners(cell)) {
+        refined_cell_center += corner;
+    }
+    refined_cell_center /= 8.;
+    return refined_cell_center;
+}
+
+double ImplicitRefinedLevel::volume(int cell) const
+{
+    return volume_correction_[parentCell(cell)] * hexahedronVolume(corners(cell));
+}
+
+std::array<int,6> ImplicitRefinedLevel::neighbors(int cell) const
+{
+    const int parent = parentCell(cell);
+    const auto [i, j, k] = Opm::Lgr::getIJK(idxInParentCell(cell), cells_per_dim_);
+    const auto& [nx, ny, nz] = cells_per_dim_;
+    const auto child = [nx = nx, ny = ny](int ii, int jj, int kk) { return (kk*nx*ny) + (jj*nx) + ii; };
+    // Child of the neighboring parent cell across a parent face, or -1 on the boundary.
+    const auto across = [this](int nb_parent, int idx) { return (nb_parent < 0) ? -1 : refinedCell(nb_parent, idx); };
+
+    return {
+        (k > 0)    ? refinedCell(parent, child(i, j, k-1))
+                   : across(parentNeighbor(parent, face_tag::K_FACE, false), child(i, j, nz-1)),
+        (j > 0)    ? refinedCell(parent, child(i, j-1, k))
+                   : across(parentNeighbor(parent, face_tag::J_FACE, false), child(i, ny-1, k)),
+        (i > 0)    ? refinedCell(parent, child(i-1, j, k))
+                   : across(parentNeighbor(parent, face_tag::I_FACE, false), child(nx-1, j, k)),
+        (i < nx-1) ? refinedCell(parent, child(i+1, j, k))
+                   : across(parentNeighbor(parent, face_tag::I_FACE, true), child(0, j, k)),
+        (j < ny-1) ? refinedCell(parent, child(i, j+1, k))
+                   : across(parentNeighbor(parent, face_tag::J_FACE, true), child(i, 0, k)),
+        (k < nz-1) ? refinedCell(parent, child(i, j, k+1))
+                   : across(parentNeighbor(parent, face_tag::K_FACE, true), child(i, j, 0)) };
+}
+
+int ImplicitRefinedLevel::parentNeighbor(int parent_cell, enum face_tag tag, bool orientation) const
+{
+    int side_face = -1;
+    for (const auto& face : parent_grid_->cell_to_face_[EntityRep<0>(parent_cell, true)]) {
+        if ((parent_grid_->face_tag_[EntityRep<1>(face.index(), true)] != tag) || (face.orientation() != orientation)) {
+            continue;
+        }
+        if (side_face != -1) {
+            OPM_THROW(std::logic_error, "Cell " + std::to_string(parent_cell) +
+                      " has more than one face on one of its sides. It cannot be refined implicitly.");
+        }
+        side_face = face.index();
+    }
+    if (side_face == -1) {
+        OPM_THROW(std::logic_error, "Cell " + std::to_string(parent_cell) +
+                  " has no face on one of its sides. It cannot be refined implicitly.");
+    }
+    for (const auto& nb : parent_grid_->face_to_cell_[EntityRep<1>(side_face, true)]) {
+        // On a distributed grid, neighbors stored on another process are marked with the maximal int.
+        if ((nb.index() != parent_cell) && (nb.index() != std::numeric_limits<int>::max())) {
+            return nb.index();
+        }
+    }
+    return -1;
+}
+
+} // namespace cpgrid
+} // namespace Dune
@@ -0,0 +1,129 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IMPLICITREFINEDLEVEL_HEADER_INCLUDED
+#define OPM_IMPLICITREFINEDLEVEL_HEADER_INCLUDED
+
+#include <opm/grid/cpgrid/CpGridData.hpp>
+#include <opm/grid/cpgrid/Geometry.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// @brief Uniform refinement of all cells of a level grid, stored implicitly.
+///
+///        Each parent cell is subdivided into cells_per_dim[0]*cells_per_dim[1]*cells_per_dim[2] children,
+///        as in CpGrid::autoRefine(). Instead of explicitly storing corners, faces, cell geometries and
+///        topology for every refined cell, only the parent grid, the refinement factors and one volume
+///        correction per parent cell are kept. Everything else is computed on demand from the parent cell
+///        via CpGridData::getReferenceRefinedCorners() and the trilinear map of the parent geometry.
+///
+///        Refined cell 'cell' is child number cell % n of parent cell cell / n, with n the number of
+///        children per parent. Children are numbered k*cells_per_dim[0]*cells_per_dim[1] + j*cells_per_dim[0] + i
+///        inside their parent, as the cells of the explicit refined level grids. Corners, centers and volumes
+///        agree with the ones computed by Geometry<3,3>::refineCellifiedPatch().
+class ImplicitRefinedLevel
+{
+public:
+    using GlobalCoordinate = Geometry<3,3>::GlobalCoordinate;
+
+    /// @brief Refine all cells of parent_grid uniformly.
+    ///
+    /// @param [in] parent_grid    Grid whose cells get refined, usually level zero. It is kept alive by this object.
+    /// @param [in] cells_per_dim  Number of children of each parent cell in x-, y-, and z-direction.
+    ///
+    /// @throw std::invalid_argument if a refinement factor is not positive.
+    /// @throw std::logic_error if a parent cell does not have exactly one I_FACE, J_FACE and K_FACE
+    ///        on each of its sides, since then the neighbors across parent faces are not well-defined.
+    ImplicitRefinedLevel(std::shared_ptr<const CpGridData> parent_grid,
+                         const std::array<int,3>& cells_per_dim);
+
+    /// @brief Number of refined cells.
+    int size() const
+    {
+        return parent_grid_->size(0) * childrenPerParent();
+    }
+
+    const std::array<int,3>& cellsPerDim() const
+    {
+        return cells_per_dim_;
+    }
+
+    const CpGridData& parentGrid() const
+    {
+        return *parent_grid_;
+    }
+
+    /// @brief Index of the parent cell of a refined cell, in the parent grid.
+    int parentCell(int cell) const
+    {
+        return cell / childrenPerParent();
+    }
+
+    /// @brief Index of a refined cell inside its parent cell.
+    int idxInParentCell(int cell) const
+    {
+        return cell % childrenPerParent();
+    }
+
+    /// @brief Index of the refined cell that is child idx_in_parent_cell of parent_cell.
+    int refinedCell(int parent_cell, int idx_in_parent_cell) const
+    {
+        return (parent_cell * childrenPerParent()) + idx_in_parent_cell;
+    }
+
+    /// @brief The 8 corners of a refined cell, in the order of Geometry<3,3>::corner().
+    std::array<GlobalCoordinate,8> corners(int cell) const;
+
+    /// @brief Center of a refined cell, the average of its 8 corners.
+    GlobalCoordinate center(int cell) const;
+
+    /// @brief Volume of a refined cell. Volumes of the children of a parent cell add up to its volume.
+    double volume(int cell) const;
+
+    /// @brief Refined cells sharing a face with a refined cell, ordered bottom, front, left, right, back, top.
+    ///        Entry is -1 for faces on the boundary of the parent grid, or towards cells not stored on this process.
+    std::array<int,6> neighbors(int cell) const;
+
+private:
+    int childrenPerParent() const
+    {
+        return cells_per_dim_[0]*cells_per_dim_[1]*cells_per_dim_[2];
+    }
+
+    /// @brief The parent cell sharing with parent_cell its only face with the given tag and orientation,
+    ///        or -1 if there is no such cell on this process. Throws if there is not exactly one such face.
+    int parentNeighbor(int parent_cell, enum face_tag tag, bool orientation) const;
+
+    std::shared_ptr<const CpGridData> parent_grid_;
+    std::array<int,3> cells_per_dim_;
+    /// Factor making the volumes of the children of each parent cell add up to the parent volume.
+    std::vector<double> volume_correction_;
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_IMPLICITREFINEDLEVEL_HEADER_INCLUDED
@@ -0,0 +1,159 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_CPGRID_INDEXPAIRMAP_HEADER_INCLUDED
+#define OPM_GRID_CPGRID_INDEXPAIRMAP_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+namespace Lgr
+{
+
+/// @brief Map from pairs of indices {first, second} to values, stored in dense arrays.
+///
+/// The bookkeeping of the refinement relates entities given by an element (or a level) and
+/// the index of an entity within it, e.g. {marked element, corner of its single-cell-refinement}
+/// or {refined level, refined corner}. The first index is -1 for entities not involved in any
+/// refinement, all other indices are non-negative and bounded by the number of entities.
+/// Hence, the values are stored in one contiguous row per used first index, accessed by the
+/// second index. In contrast to std::map, inserting and finding take constant time and the
+/// entries of one element are adjacent in memory.
+template<class T>
+class IndexPairMap
+{
+public:
+    using key_type = std::array<int,2>;
+    using mapped_type = T;
+
+    /// @brief Access the value of a key, inserting a default constructed value if the key is missing.
+    T& operator[](const key_type& key)
+    {
+        assert(key[0] >= -1 && key[1] >= 0);
+        auto& [values, present] = rows_[rowIndex(key[0])];
+        const std::size_t col = key[1];
+        if (col >= values.size()) {
+            values.resize(col + 1);
+            present.resize(col + 1, false);
+        }
+        if (!present[col]) {
+            present[col] = true;
+            ++size_;
+        }
+        return values[col];
+    }
+
+    /// @brief Insert a value or overwrite the value of an existing key.
+    void insert_or_assign(const key_type& key, const T& value)
+    {
+        (*this)[key] = value;
+    }
+
+    /// @brief Pointer to the value of a key, or nullptr if the key is missing.
+    const T* find(const key_type& key) const
+    {
+        if (key[0] < -1 || key[1] < 0) {
+            return nullptr;
+        }
+        const std::size_t first = key[0] + 1;
+        if (first >= row_of_first_.size() || row_of_first_[first] < 0) {
+            return nullptr;
+        }
+        const auto& [values, present] = rows_[row_of_first_[first]];
+        const std::size_t col = key[1];
+        if (col >= values.size() || !present[col]) {
+            return nullptr;
+        }
+        return &values[col];
+    }
+
+    bool contains(const key_type& key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    /// @brief Value of a key. Throws std::out_of_range if the key is missing.
+    const T& at(const key_type& key) const
+    {
+        const T* value = find(key);
+        if (!value) {
+            OPM_THROW(std::out_of_range, "IndexPairMap has no entry {" + std::to_string(key[0]) +
+                      ", " + std::to_string(key[1]) + "}.");
+        }
+        return *value;
+    }
+
+    /// @brief Reserve memory for the second indices [0, count) of a first index.
+    void reserve(int first, std::size_t count)
+    {
+        auto& [values, present] = rows_[rowIndex(first)];
+        values.reserve(count);
+        present.reserve(count);
+    }
+
+    /// @brief Number of stored keys.
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    struct Row
+    {
+        std::vector<T> values;
+        std::vector<bool> present;
+    };
+
+    // Index of the row of a first index, the row is added if it does not exist yet.
+    std::size_t rowIndex(int first)
+    {
+        const std::size_t pos = first + 1;
+        if (pos >= row_of_first_.size()) {
+            row_of_first_.resize(pos + 1, -1);
+        }
+        if (row_of_first_[pos] < 0) {
+            row_of_first_[pos] = rows_.size();
+            rows_.emplace_back();
+        }
+        return row_of_first_[pos];
+    }
+
+    // Only first indices that are used get a row, e.g. the marked elements.
+    std::vector<int> row_of_first_;
+    std::vector<Row> rows_;
+    std::size_t size_ = 0;
+};
+
+} // namespace Lgr
+} // namespace Opm
+
+#endif // OPM_GRID_CPGRID_INDEXPAIRMAP_HEADER_INCLUDED
@@ -87,6 +87,11 @@ void GlobalIdSet::insertIdSet(const CpGridData& view)
 {
     idSets_.insert(std::make_pair(&view,view.global_id_set_));
 }
+
+void GlobalIdSet::eraseIdSet(const CpGridData& view)
+{
+    idSets_.erase(&view);
+}
 GlobalIdSet::GlobalIdSet(const CpGridData& view)
 {
     idSets_.insert(std::make_pair(&view,view.global_id_set_));
@@ -514,6 +514,9 @@ namespace Dune
         IdType subId(const typename Codim<0>::Entity& e, int i, int cc) const;
 
         void insertIdSet(const CpGridData& view);
+
+        /// \brief Remove the id set of a view that is about to be destroyed.
+        void eraseIdSet(const CpGridData& view);
     private:
         /// \brief Get the correct id set of a level (global or distributed)
         const LevelGlobalIdSet& levelIdSet(const CpGridData* const data) const
@@ -37,6 +37,15 @@
 #include <opm/grid/common/LevelCartesianIndexMapper.hpp>
 #include <opm/grid/CpGrid.hpp>
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 namespace Dune
 {
 class CpGrid;
@@ -48,13 +57,24 @@ namespace Opm
 // Further documentation in opm/grid/common/LevelCartesianIndexMapper.hpp
 //
 // Specialization for CpGrid
+//
+// Besides the per-cell queries, the mapper provides dense lookup tables between level Cartesian,
+// level compressed and leaf indices. They are built on first use and shared among copies of the
+// mapper, so that repeated lookups (output, property assignment) do not rebuild hash maps.
+// The tables describe the grid at construction time; create a new mapper after adapting the grid.
+// They have cartesianSize(level) entries, also on each process of a distributed grid, where level
+// zero has the Cartesian size of the global grid. Levels created by adapt() without startIJK have
+// no tables: their refined cells inherit the level Cartesian index of their parent cell, hence
+// the indices are not unique (see uniqueCartesianIndices()).
 template<>
 class LevelCartesianIndexMapper<Dune::CpGrid>
 {
 public:
     static constexpr int dimension = 3 ;
 
-    explicit LevelCartesianIndexMapper(const Dune::CpGrid& grid) : grid_{ &grid }
+    explicit LevelCartesianIndexMapper(const Dune::CpGrid& grid)
+        : grid_{ &grid }
+        , cache_{ std::make_shared<Cache>(grid.maxLevel()+1) }
     {}
 
     LevelCartesianIndexMapper() = delete;
@@ -90,8 +110,122 @@ public:
         grid_->currentData()[level]->getIJK( compressedElementIndexOnLevel, coordsOnLevel);
     }
 
+    /// @brief Whether the cells of a level have distinct level Cartesian indices. This is not the case
+    ///        for levels created by adapt() without startIJK, where refined cells inherit the level
+    ///        Cartesian index of their parent cell.
+    bool uniqueCartesianIndices(int level) const
+    {
+        validCachedLevel(level);
+        return buildCompressedMap(level).unique;
+    }
+
+    /// @brief Dense map from level Cartesian index to level compressed index, -1 for inactive cells.
+    ///        The size of the vector is cartesianSize(level).
+    /// @throw std::logic_error if the level Cartesian indices of the level are not unique.
+    const std::vector<int>& cartesianToCompressed(int level) const
+    {
+        validCachedLevel(level);
+        const auto& levelCache = buildCompressedMap(level);
+        if (!levelCache.unique) {
+            throw std::logic_error("Level Cartesian indices of level " + std::to_string(level) + " are not unique.\n");
+        }
+        return levelCache.cartesian_to_compressed;
+    }
+
+    /// @brief Dense map from level Cartesian index to leaf index. -1 for inactive cells and for
+    ///        cells that do not appear on the leaf grid view (refined or vanished cells).
+    ///        The size of the vector is cartesianSize(level).
+    ///        Dense counterpart of CpGrid::mapLocalCartesianIndexSetsToLeafIndexSet()[level].
+    /// @throw std::logic_error if the level Cartesian indices of the level are not unique.
+    const std::vector<int>& cartesianToLeaf(int level) const
+    {
+        validCachedLevel(level);
+        buildLeafMaps();
+        if (!cache_->levels[level].unique) {
+            throw std::logic_error("Level Cartesian indices of level " + std::to_string(level) + " are not unique.\n");
+        }
+        return cache_->levels[level].cartesian_to_leaf;
+    }
+
+    /// @brief Map from leaf index to { level, level Cartesian index } of the leaf cell.
+    ///        Same as CpGrid::mapLeafIndexSetToLocalCartesianIndexSets(), computed once per mapper.
+    const std::vector<std::array<int,2>>& leafToLevelCartesianIndex() const
+    {
+        buildLeafMaps();
+        return cache_->leaf_to_level_cartesian;
+    }
+
 private:
+    struct LevelCache
+    {
+        std::once_flag compressed_flag;
+        bool unique = true;
+        std::vector<int> cartesian_to_compressed;
+        std::vector<int> cartesian_to_leaf;
+    };
+
+    struct Cache
+    {
+        explicit Cache(int numLevels)
+            : num_levels(numLevels)
+            , levels(std::make_unique<LevelCache[]>(numLevels))
+        {}
+
+        int num_levels;
+        std::unique_ptr<LevelCache[]> levels;
+        std::once_flag leaf_flag;
+        std::vector<std::array<int,2>> leaf_to_level_cartesian;
+    };
+
     const Dune::CpGrid* grid_;
+    std::shared_ptr<Cache> cache_;
+
+    void validCachedLevel(int level) const
+    {
+        validLevel(level);
+        // Otherwise, the grid has been adapted after creating this mapper.
+        assert(level < cache_->num_levels);
+    }
+
+    const LevelCache& buildCompressedMap(int level) const
+    {
+        auto& levelCache = cache_->levels[level];
+        std::call_once(levelCache.compressed_flag, [this, level, &levelCache]() {
+            const auto& globalCell = grid_->currentData()[level]->globalCell();
+            levelCache.cartesian_to_compressed.assign(computeCartesianSize(level), -1);
+            for (std::size_t compressedIdx = 0; compressedIdx < globalCell.size(); ++compressedIdx) {
+                auto& entry = levelCache.cartesian_to_compressed[globalCell[compressedIdx]];
+                if (entry >= 0) {
+                    // A dense map would drop cells, do not keep one.
+                    levelCache.unique = false;
+                    levelCache.cartesian_to_compressed = {};
+                    return;
+                }
+                entry = compressedIdx;
+            }
+        });
+        return levelCache;
+    }
+
+    void buildLeafMaps() const
+    {
+        std::call_once(cache_->leaf_flag, [this]() {
+            for (int level = 0; level < cache_->num_levels; ++level) {
+                if (buildCompressedMap(level).unique) {
+                    cache_->levels[level].cartesian_to_leaf.assign(computeCartesianSize(level), -1);
+                }
+            }
+            cache_->leaf_to_level_cartesian.resize(grid_->leafGridView().size(0));
+            for (const auto& element : Dune::elements(grid_->leafGridView())) {
+                const int level = element.level();
+                const int levelCartesianIdx = grid_->currentData()[level]->globalCell()[element.getLevelElem().index()];
+                if (cache_->levels[level].unique) {
+                    cache_->levels[level].cartesian_to_leaf[levelCartesianIdx] = element.index();
+                }
+                cache_->leaf_to_level_cartesian[element.index()] = { level, levelCartesianIdx };
+            }
+        });
+    }
 
     int computeCartesianSize(int level) const
     {
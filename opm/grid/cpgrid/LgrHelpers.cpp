@@ -19,6 +19,7 @@
 #include "config.h"
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/CommunicationUtils.hpp>
 #include <opm/grid/cpgrid/CpGridData.hpp>
 #include <opm/grid/cpgrid/Entity.hpp>
 #include <opm/grid/cpgrid/LgrHelpers.hpp>
@@ -28,13 +29,12 @@
 
 #include <algorithm>    // for std::max
 #include <array>
-#include <map>
+#include <exception>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>  // for std::integral_constant
-#include <unordered_map>
 #include <utility> // for std::pair
 #include <vector>
 
@@ -43,18 +43,57 @@ namespace Opm
 namespace Lgr
 {
 
-void insertBidirectional(std::map<std::array<int,2>,int>& a_to_b,
-                         std::unordered_map<int,std::array<int,2>>& b_to_a,
+namespace
+{
+
+/// @brief Call body(i) for each i in [0, n), in parallel if OpenMP is available.
+///
+/// Exceptions must not leave an OpenMP region; the first one thrown by any iteration
+/// is stored and rethrown after the loop.
+template <class Body>
+void parallelForEach(int n, const Body& body)
+{
+    std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; ++i) {
+        try {
+            body(i);
+        }
+        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(LgrHelpersParallelForEach)
+#endif
+            {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace
+
+void insertBidirectional(IndexPairMap<int>& a_to_b,
+                         std::vector<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          int& counter)
 {
     a_to_b[keyA] = counter;
+    if (b_to_a.size() <= static_cast<std::size_t>(counter)) {
+        b_to_a.resize(counter + 1);
+    }
     b_to_a[counter] = keyA;
     ++counter;
 }
 
-void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
-                         std::map<std::array<int,2>,std::array<int,2>>& b_to_a,
+void insertBidirectional(IndexPairMap<std::array<int,2>>& a_to_b,
+                         IndexPairMap<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          const std::array<int,2>& keyB,
                          int& counter)
@@ -64,8 +103,8 @@ void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
     ++counter;
 }
 
-void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
-                         std::map<std::array<int,2>,std::array<int,2>>& b_to_a,
+void insertBidirectional(IndexPairMap<std::array<int,2>>& a_to_b,
+                         IndexPairMap<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          int keyBfirst,
                          int& counter)
@@ -79,17 +118,17 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid, /* Marked
                                             std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                             int& markedElem_count,
                                             std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                            std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                            IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                             std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                             /* Refined cells parameters */
-                                            std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                            std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                            IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                            IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                             std::vector<int>& refined_cell_count_vec,
                                             const std::vector<int>& assignRefinedLevel,
                                             std::vector<std::vector<std::tuple<int,std::vector<int>>>>& preAdapt_parent_to_children_cells_vec,
                                             /* Adapted cells parameters */
-                                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                            std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                            IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                            std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                             int& cell_count,
                                             std::vector<std::vector<int>>& preAdapt_level_to_leaf_cells_vec,
                                             /* Additional parameters */
@@ -103,6 +142,39 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid, /* Marked
     // Max level before calling adapt.
     const int& preAdaptMaxLevel = grid.maxLevel();
 
+    // The single-cell-refinements of the marked elements are independent of each other, hence they are
+    // built in parallel. The indices of refined and adapted cells depend on the order of the elements and
+    // are assigned afterwards, in a serial pass running over the elements in the same order as before.
+    // Constructing a CpGridData object calls MPI, which may not support calls from several threads.
+    // Therefore the auxiliary LGRs are constructed here and only filled in the parallel loop.
+    std::vector<int> markedElems;
+    std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>> markedElemLgrs;
+    std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>> refined_data; // Level data of the auxiliary LGRs, not used by them.
+    for (const auto& element : Dune::elements(grid.leafGridView())) {
+        if (grid.getMark(element) ==  1) {
+            markedElems.push_back(element.index());
+            markedElemLgrs.push_back(std::make_shared<Dune::cpgrid::CpGridData>(refined_data));
+        }
+    }
+    std::vector<std::vector<std::array<int,2>>> markedElem_parentCorners_to_equivalentRefinedCorners(markedElems.size());
+    std::vector<std::vector<std::tuple<int,std::vector<int>>>> markedElem_parentFace_to_itsRefinedFaces(markedElems.size());
+    parallelForEach(static_cast<int>(markedElems.size()), [&](int pos) {
+        const int elemIdx = markedElems[pos];
+        // Build auxiliary LGR for the refinement of this element
+        const auto& [elemLgr_ptr,
+                     parentCorners_to_equivalentRefinedCorners,
+                     parentFace_to_itsRefinedFaces,
+                     parentCell_to_itsRefinedCells,
+                     refinedFace_to_itsParentFace,
+                     refinedCell_to_itsParentCell]
+            = grid.currentLeafData().refineSingleCell(cells_per_dim_vec[assignRefinedLevel[elemIdx] - preAdaptMaxLevel-1], elemIdx,
+                                                      markedElemLgrs[pos]);
+        markedElem_to_itsLgr[elemIdx] = elemLgr_ptr;
+        markedElem_parentCorners_to_equivalentRefinedCorners[pos] = parentCorners_to_equivalentRefinedCorners;
+        markedElem_parentFace_to_itsRefinedFaces[pos] = parentFace_to_itsRefinedFaces;
+    });
+
+    int markedElemPos = 0;
     for (const auto& element : Dune::elements(grid.leafGridView())) {
         // When the element is not involved in any LGR, it will appear in the updated leaf grid
         // with same geometrical features (center, volume).
@@ -110,7 +182,7 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid, /* Marked
             preAdapt_level_to_leaf_cells_vec[element.level()][element.getLevelElem().index()] = cell_count;
 
             insertBidirectional(elemLgrAndElemLgrCell_to_adaptedCell,  // map a_to_b
-                                adaptedCell_to_elemLgrAndElemLgrCell,  // unordered_map b_to_a
+                                adaptedCell_to_elemLgrAndElemLgrCell,  // vector b_to_a
                                 std::array{-1, element.index()},       // keyA
                                 cell_count);                           // counter (keyB)
         }
@@ -120,22 +192,19 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid, /* Marked
             assert(markedElemLevel > preAdaptMaxLevel);
             // Shift the markedElemRefinedLevel to access data containers
             const auto& shiftedLevel = markedElemLevel - preAdaptMaxLevel-1;
-            // Build auxiliary LGR for the refinement of this element
-            const auto& [elemLgr_ptr,
-                         parentCorners_to_equivalentRefinedCorners,
-                         parentFace_to_itsRefinedFaces,
-                         parentCell_to_itsRefinedCells,
-                         refinedFace_to_itsParentFace,
-                         refinedCell_to_itsParentCell]
-                = grid.currentLeafData().refineSingleCell(cells_per_dim_vec[shiftedLevel], element.index());
-            markedElem_to_itsLgr[ element.index() ] = elemLgr_ptr;
+            // Relations provided by the auxiliary LGR of this element, built above.
+            const auto& parentCorners_to_equivalentRefinedCorners = markedElem_parentCorners_to_equivalentRefinedCorners[markedElemPos];
+            const auto& parentFace_to_itsRefinedFaces = markedElem_parentFace_to_itsRefinedFaces[markedElemPos];
+            ++markedElemPos;
 
             const int childrenCount = cells_per_dim_vec[shiftedLevel][0]*cells_per_dim_vec[shiftedLevel][1]*cells_per_dim_vec[shiftedLevel][2];
             std::vector<int> refinedChildrenList(childrenCount);
+            elemLgrAndElemLgrCell_to_adaptedCell.reserve(element.index(), childrenCount);
+            elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell.reserve(element.index(), childrenCount);
 
             for (int refinedCell = 0; refinedCell < childrenCount; ++refinedCell) {
                 insertBidirectional(elemLgrAndElemLgrCell_to_adaptedCell,     // map a_to_b
-                                    adaptedCell_to_elemLgrAndElemLgrCell,     // unordered_map b_to_a
+                                    adaptedCell_to_elemLgrAndElemLgrCell,     // vector b_to_a
                                     std::array{element.index(), refinedCell}, // keyA
                                     cell_count);                              // counter (keyB)
 
@@ -163,9 +232,9 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid, /* Marked
 std::tuple<std::vector<std::vector<std::array<int,2>>>, std::vector<std::vector<int>>, std::vector<std::array<int,2>>, std::vector<int>>
 defineChildToParentAndIdxInParentCell(const Dune::cpgrid::CpGridData& current_data,
                                       int preAdaptMaxLevel,
-                                      const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                      const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                       const std::vector<int>& refined_cell_count_vec,
-                                      const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                      const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                       const int& cell_count)
 {
     // Per refinement level: child -> {parentLevel, parentIndex}. {-1,-1} if no parent.
@@ -231,11 +300,11 @@ defineChildToParentAndIdxInParentCell(const Dune::cpgrid::CpGridData& current_da
 std::pair<std::vector<std::vector<int>>, std::vector<std::array<int,2>>>
 defineLevelToLeafAndLeafToLevelCells(const Dune::cpgrid::CpGridData& current_data,
                                      int preAdaptMaxLevel,
-                                     const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                     const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                     const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                     const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                      const std::vector<int>& refined_cell_count_vec,
-                                     const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                     const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                     const IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                     const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                      const int& cell_count)
 {
     // Relation between the refined grid and leafview cell indices.
@@ -270,10 +339,10 @@ defineLevelToLeafAndLeafToLevelCells(const Dune::cpgrid::CpGridData& current_dat
 
 void identifyRefinedCornersPerLevel(const Dune::cpgrid::CpGridData& current_data,
                                     int preAdaptMaxLevel,
-                                    std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                    std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+                                    IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                    IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
                                     std::vector<int>& refined_corner_count_vec,
-                                    std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                    IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                     const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                     const std::vector<int>& assignRefinedLevel,
                                     const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
@@ -725,7 +794,7 @@ int replaceLgr1CornerIdxByLgr2CornerIdx(const Dune::cpgrid::CpGridData& current_
 
 void markVanishedCorner(const std::array<int,2>& vanished,
                         const std::array<int,2>& lastAppearance,
-                        std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance)
+                        IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance)
 {
     vanishedRefinedCorner_to_itsLastAppearance[vanished] = lastAppearance;
 }
@@ -733,8 +802,8 @@ void markVanishedCorner(const std::array<int,2>& vanished,
 void processInteriorCorners(int elemIdx, int shiftedLevel,
                             const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                             int& corner_count,
-                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                            std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                            IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                            std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                             const std::vector<std::array<int,3>>& cells_per_dim_vec)
 {
     // Interior refined corners
@@ -743,7 +812,7 @@ void processInteriorCorners(int elemIdx, int shiftedLevel,
     for (int corner = 0; corner < lgr->size(3); ++corner) {
         if (isRefinedCornerInInteriorLgr(cells_per_dim_vec[shiftedLevel], corner)) {
             insertBidirectional(elemLgrAndElemLgrCorner_to_adaptedCorner,    // map a_to_b
-                                adaptedCorner_to_elemLgrAndElemLgrCorner,    // unordered_map b_to_a
+                                adaptedCorner_to_elemLgrAndElemLgrCorner,    // vector b_to_a
                                 std::array{elemIdx, corner},                 // keyA
                                 corner_count);                               // counter (keyB)
         }
@@ -753,9 +822,9 @@ void processInteriorCorners(int elemIdx, int shiftedLevel,
 void processEdgeCorners(int elemIdx, int shiftedLevel,
                         const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                         int& corner_count,
-                        std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                        std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                        std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                        IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                        std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                        IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                         const Dune::cpgrid::CpGridData& current_data,
                         int preAdaptMaxLevel,
                         const std::vector<int>& assignRefinedLevel,
@@ -795,7 +864,7 @@ void processEdgeCorners(int elemIdx, int shiftedLevel,
 
         if (maxLast == elemIdx) {
             insertBidirectional(elemLgrAndElemLgrCorner_to_adaptedCorner, // map a_to_b
-                                adaptedCorner_to_elemLgrAndElemLgrCorner, // unordered_map b_to_a
+                                adaptedCorner_to_elemLgrAndElemLgrCorner, // vector b_to_a
                                 std::array{elemIdx, corner},              // keyA
                                 corner_count);                            // counter (keyB)
         }
@@ -805,9 +874,9 @@ void processEdgeCorners(int elemIdx, int shiftedLevel,
 void processBoundaryCorners(int elemIdx, int shiftedLevel,
                             const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                             int& corner_count,
-                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                            std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                            std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                            IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                            std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                            IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                             const Dune::cpgrid::CpGridData& current_data,
                             int preAdaptMaxLevel,
                             const std::vector<int>& assignRefinedLevel,
@@ -840,7 +909,7 @@ void processBoundaryCorners(int elemIdx, int shiftedLevel,
 
         if (lastLgr == elemIdx) {
             insertBidirectional(elemLgrAndElemLgrCorner_to_adaptedCorner, // map a_to_b
-                                adaptedCorner_to_elemLgrAndElemLgrCorner, // unordered_map b_to_a
+                                adaptedCorner_to_elemLgrAndElemLgrCorner, // vector b_to_a
                                 std::array{elemIdx, corner},              // keyA
                                 corner_count);                            // counter (keyB)
         }
@@ -849,13 +918,13 @@ void processBoundaryCorners(int elemIdx, int shiftedLevel,
 
 void identifyLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
                              int preAdaptMaxLevel,
-                             std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                             std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                             IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                             std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                              int& corner_count,
                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                              const std::vector<int>& assignRefinedLevel,
                              const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                             std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                             IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                              const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                              const std::vector<std::array<int,3>>& cells_per_dim_vec)
 {
@@ -872,7 +941,7 @@ void identifyLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
             // {lgr, lgrCorner} = {marked element idx, corner idx in the aux. single-cell-refinement of marked element}
             const auto& [lgr, lgrCorner] = cornerInMarkedElemWithEquivRefinedCorner[corner].back();
             insertBidirectional(elemLgrAndElemLgrCorner_to_adaptedCorner, // map a_to_b
-                                adaptedCorner_to_elemLgrAndElemLgrCorner, // unordered_map b_to_a
+                                adaptedCorner_to_elemLgrAndElemLgrCorner, // vector b_to_a
                                 std::array{lgr, lgrCorner},               // keyA
                                 corner_count);                            // counter (keyB)
         }
@@ -909,8 +978,8 @@ void identifyLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
 
 void identifyRefinedFacesPerLevel(const Dune::cpgrid::CpGridData& current_data,
                                   int preAdaptMaxLevel,
-                                  std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
-                                  std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                  IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                  IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
                                   std::vector<int>& refined_face_count_vec,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const std::vector<int>& assignRefinedLevel,
@@ -999,8 +1068,8 @@ void identifyRefinedFacesPerLevel(const Dune::cpgrid::CpGridData& current_data,
 
 void identifyLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                            int preAdaptMaxLevel,
-                           std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
-                           std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                           IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                           std::vector<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
                            int& face_count,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            const std::vector<int>& assignRefinedLevel,
@@ -1023,7 +1092,7 @@ void identifyLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
             if (isInterior) {
                 // Interior refined face->store immediately
                 insertBidirectional(elemLgrAndElemLgrFace_to_adaptedFace, // map a_to_b
-                                    adaptedFace_to_elemLgrAndElemLgrFace, // unordered_map b_to_a
+                                    adaptedFace_to_elemLgrAndElemLgrFace, // vector b_to_a
                                     {elem, face},                         // keyA
                                     face_count);                          // counter (keyB)
             }
@@ -1043,7 +1112,7 @@ void identifyLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                 if (lastLgr == elem) {
                     // Store only at last appearance
                     insertBidirectional(elemLgrAndElemLgrFace_to_adaptedFace, // map a_to_b
-                                        adaptedFace_to_elemLgrAndElemLgrFace, // unordered_map b_to_a
+                                        adaptedFace_to_elemLgrAndElemLgrFace, // vector b_to_a
                                         {elem, face},                         // keyA
                                         face_count);                          // counter (keyB)
                 }
@@ -1055,7 +1124,7 @@ void identifyLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
     for (int face = 0; face < current_data.numFaces(); ++face) {
         if (faceInMarkedElemAndRefinedFaces[face].empty()) {
             insertBidirectional(elemLgrAndElemLgrFace_to_adaptedFace, // map a_to_b
-                                adaptedFace_to_elemLgrAndElemLgrFace, // unordered_map b_to_a
+                                adaptedFace_to_elemLgrAndElemLgrFace, // vector b_to_a
                                 {-1, face},                           // keyA
                                 face_count);                          // counter (keyB)
         }
@@ -1218,14 +1287,15 @@ void populateRefinedCorners(std::vector<Dune::cpgrid::EntityVariableBase<Dune::c
                             const std::vector<int>& refined_corner_count_vec,
                             const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                             const int& preAdaptMaxLevel,
-                            const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner)
+                            const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner)
 {
     for (std::size_t shiftedLevel = 0; shiftedLevel < refined_corner_count_vec.size(); ++shiftedLevel) {
         refined_corners_vec[shiftedLevel].resize(refined_corner_count_vec[shiftedLevel]);
-        for (int corner = 0; corner < refined_corner_count_vec[shiftedLevel]; ++corner) {
+        // Each refined corner is copied from its LGR, independently of the other corners.
+        parallelForEach(refined_corner_count_vec[shiftedLevel], [&](int corner) {
             const auto& [elemLgr, elemLgrCorner] = refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner.at({static_cast<int>(shiftedLevel) + preAdaptMaxLevel +1,corner});
             refined_corners_vec[shiftedLevel][corner] =  markedElem_to_itsLgr[elemLgr] -> getGeometry().geomVector(std::integral_constant<int,3>()) -> get(elemLgrCorner);
-        }
+        });
     }
 }
 
@@ -1235,13 +1305,13 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
                           std::vector<Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>>& mutable_refined_face_normals_vec,
                           std::vector<Opm::SparseTable<int>>& refined_face_to_point_vec,
                           const std::vector<int>& refined_face_count_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                          const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                          const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                          const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                           const int& preAdaptMaxLevel,
                           const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                          const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner)
+                          const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner)
 {
     for (std::size_t shiftedLevel = 0; shiftedLevel < refined_face_count_vec.size(); ++shiftedLevel) {
 
@@ -1250,12 +1320,11 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
         mutable_refined_face_tags_vec[shiftedLevel].resize(refined_face_count_vec[shiftedLevel]);
         mutable_refined_face_normals_vec[shiftedLevel].resize(refined_face_count_vec[shiftedLevel]);
 
-        // Auxiliary integer to count all the points in refined_face_to_point.
-        int refined_num_points = 0;
         // Auxiliary vector to store refined_face_to_point with non consecutive indices.
         std::vector<std::vector<int>> aux_refined_face_to_point;
         aux_refined_face_to_point.resize(refined_face_count_vec[shiftedLevel]);
-        for (int face = 0; face < refined_face_count_vec[shiftedLevel]; ++face) {
+        // Each face only writes its own entries, so the faces are processed in parallel.
+        parallelForEach(refined_face_count_vec[shiftedLevel], [&](int face) {
 
             const auto& [elemLgr, elemLgrFace] = refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace.at({static_cast<int>(shiftedLevel) + preAdaptMaxLevel +1,face});
             const auto& elemLgrFaceEntity =  Dune::cpgrid::EntityRep<1>(elemLgrFace, true);
@@ -1269,25 +1338,21 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
             // Get face_to_point_ before adapting - we need to replace the level corners by the adapted ones.
             //Opm::SparseTable<int>::mutable_row_type
             const auto& preAdapt_face_to_point = markedElem_to_itsLgr.at(elemLgr)->faceToPoint(elemLgrFace);
-            // Add the amount of points to the count num_points.
-            refined_num_points += preAdapt_face_to_point.size();
 
             // Face_to_point
             for (std::size_t corn = 0; corn < preAdapt_face_to_point.size(); ++corn) {
                 const auto& elemLgrCorn = preAdapt_face_to_point[corn];
                 std::size_t refinedCorn = 0; // It'll be rewritten.
                 // Corner is stored in adapted_corners
-                if (auto candidate = elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find({elemLgr, elemLgrCorn});
-                    candidate != elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.end())  {
-                    refinedCorn = candidate->second[1];
+                if (const auto* candidate = elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find({elemLgr, elemLgrCorn}))  {
+                    refinedCorn = (*candidate)[1];
                 }
                 else{
                     // Corner might have vanished - Search its equivalent lgr-corner in that case -
                     // last lgr where the corner appears -
                     std::array<int,2> lastAppearanceLgr_lgrEquivCorner = {0, 0}; // It'll get rewritten.
-                    if(auto corner_candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, elemLgrCorn});
-                       corner_candidate != markedElemAndEquivRefinedCorn_to_corner.end()) {
-                        lastAppearanceLgr_lgrEquivCorner = cornerInMarkedElemWithEquivRefinedCorner[corner_candidate->second].back();
+                    if(const auto* corner_candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, elemLgrCorn})) {
+                        lastAppearanceLgr_lgrEquivCorner = cornerInMarkedElemWithEquivRefinedCorner[*corner_candidate].back();
                     }
                     else {
                         // To locate vanished corners, we need a while-loop, since {elemLgr, elemLgrcorner} leads to
@@ -1297,8 +1362,7 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
                         // This corner lies on the area occupied by a coarse face that got refined and belonged to two marked elements.
                         // Get the index of this corner with respect to the greatest marked element index, using find instead of count.
                         lastAppearanceLgr_lgrEquivCorner = vanishedRefinedCorner_to_itsLastAppearance.at({elemLgr, elemLgrCorn});
-                        while (elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find(lastAppearanceLgr_lgrEquivCorner) ==
-                               elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.end()) {
+                        while (!elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.contains(lastAppearanceLgr_lgrEquivCorner)) {
                             const auto& tempLgr_lgrCorner  = lastAppearanceLgr_lgrEquivCorner;
                             lastAppearanceLgr_lgrEquivCorner =  vanishedRefinedCorner_to_itsLastAppearance.at(tempLgr_lgrCorner);
                         }
@@ -1307,6 +1371,11 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
                 }
                 aux_refined_face_to_point[face].push_back(refinedCorn);
             }
+        });
+        // Auxiliary integer to count all the points in refined_face_to_point.
+        int refined_num_points = 0;
+        for (const auto& points : aux_refined_face_to_point) {
+            refined_num_points += points.size();
         }
         // Refined face_to_point.
         refined_face_to_point_vec[shiftedLevel].reserve(refined_face_count_vec[shiftedLevel], refined_num_points);
@@ -1323,16 +1392,16 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                           const std::vector<int>& refined_cell_count_vec,
                           std::vector<Dune::cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                           std::vector<Dune::cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                          const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                           const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                           const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                          const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                          const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                           const std::vector<int>& assignRefinedLevel,
                           const int& preAdaptMaxLevel,
-                          const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                          const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                           const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                           const std::vector<std::array<int,3>>&  cells_per_dim_vec)
 {
@@ -1345,13 +1414,17 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
 
         const auto& allLevelCorners = refined_geometries_vec[shiftedLevel].geomVector(std::integral_constant<int,3>());
 
-        for (int cell = 0; cell < refined_cell_count_vec[shiftedLevel]; ++cell) {
+        // Auxiliary cell_to_face per refined cell. Rows of refined_cell_to_face must be appended in order,
+        // which is done after the (parallel) loop over the refined cells.
+        std::vector<std::vector<Dune::cpgrid::EntityRep<1>>> aux_refined_cell_to_face_vec(refined_cell_count_vec[shiftedLevel]);
+
+        parallelForEach(refined_cell_count_vec[shiftedLevel], [&](int cell) {
 
             const auto& [elemLgr, elemLgrCell] = refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell.at({static_cast<int>(shiftedLevel) + preAdaptMaxLevel +1, cell});
             assert(elemLgr >-1);
             const auto& elemLgrCellEntity = Dune::cpgrid::EntityRep<0>(elemLgrCell, true);
             // Auxiliary cell_to_face
-            std::vector<Dune::cpgrid::EntityRep<1>> aux_refined_cell_to_face;
+            auto& aux_refined_cell_to_face = aux_refined_cell_to_face_vec[cell];
 
             // global_cell_ values of refined cells from level grid created via adapt() (i.e., without parameters startIJK, endIJK
             // delimiting a block of parent cells) inherit the global_cell_ value of its parent cell.
@@ -1366,13 +1439,13 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
             for (int corn = 0; corn < 8; ++corn) {
                 int refinedCorn;
                 const auto& preAdaptCorn = preAdapt_cell_to_point[corn];
-                auto refined_candidate = elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find({elemLgr, preAdaptCorn});
-                if (refined_candidate == elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.end()) {
+                const auto* refined_candidate = elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find({elemLgr, preAdaptCorn});
+                if (!refined_candidate) {
                     // Corner might have vanished - Search its equivalent lgr-corner in that case -
                     // last lgr where the corner appears -
                     std::array<int,2> lastAppearanceLgr_lgrCorner = {0, 0}; // It'll be rewritten
-                    if(auto candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, preAdaptCorn}); candidate != markedElemAndEquivRefinedCorn_to_corner.end()) {
-                        lastAppearanceLgr_lgrCorner = cornerInMarkedElemWithEquivRefinedCorner[candidate->second].back();
+                    if(const auto* candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, preAdaptCorn})) {
+                        lastAppearanceLgr_lgrCorner = cornerInMarkedElemWithEquivRefinedCorner[*candidate].back();
                     }
                     else {
                         // To locate vanished corners, we need a while-loop, since {elemLgr, elemLgrcorner} leads to
@@ -1382,7 +1455,7 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                         // This corner lies on the area occupied by a coarse face that got refined and belonged to two marked elements.
                         // Get the index of this corner with respect to the greatest marked element index.
                         lastAppearanceLgr_lgrCorner = vanishedRefinedCorner_to_itsLastAppearance.at({elemLgr, preAdaptCorn});
-                        while (elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.find(lastAppearanceLgr_lgrCorner) == elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.end()) {
+                        while (!elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner.contains(lastAppearanceLgr_lgrCorner)) {
                             const auto& tempLgr_lgrCorner =   lastAppearanceLgr_lgrCorner;
                             lastAppearanceLgr_lgrCorner =  vanishedRefinedCorner_to_itsLastAppearance.at(tempLgr_lgrCorner);
                         }
@@ -1391,7 +1464,7 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                 }
                 // Corner is stored in adapted_corners
                 else {
-                    refinedCorn = refined_candidate->second[1];
+                    refinedCorn = (*refined_candidate)[1];
                 }
                 refined_cell_to_point_vec[shiftedLevel][cell][corn] = refinedCorn;
             } // end-cell_to_point
@@ -1402,8 +1475,8 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                 int refinedFace = 0; // It'll be rewritten.
                 // Face might have vanished - Search its refined lgr-children faces in that case -
                 // last lgr where the face appears
-                auto face_candidate = elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace.find({elemLgr, preAdaptFace});
-                if (face_candidate == elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace.end()) {
+                const auto* face_candidate = elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace.find({elemLgr, preAdaptFace});
+                if (!face_candidate) {
                     // Get the index of the marked face where the refined face was born.
                     const auto& markedFace = getParentFaceWhereNewRefinedFaceLiesOn(current_data,
                                                                                     cells_per_dim_vec[shiftedLevel],
@@ -1420,19 +1493,21 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                 }
                 // Face is stored in adapted_faces
                 else {
-                    refinedFace = face_candidate->second[1];
+                    refinedFace = (*face_candidate)[1];
                     aux_refined_cell_to_face.push_back({refinedFace, face.orientation()});
                 }
             } // end-cell_to_face
-            // Refined cell to face.
-            refined_cell_to_face_vec[shiftedLevel].appendRow(aux_refined_cell_to_face.begin(), aux_refined_cell_to_face.end());
             // Get the cell geometry.
             const auto& elemLgrGeom =  (*( markedElem_to_itsLgr.at(elemLgr)->getGeometry().geomVector(std::integral_constant<int,0>())))[elemLgrCellEntity];
 
             // Create a pointer to the first element of "refined_cell_to_point" (required as the fourth argement to construct a Geometry<3,3> type object).
             int* indices_storage_ptr = refined_cell_to_point_vec[shiftedLevel][cell].data();
             refined_cells_vec[shiftedLevel][cell] = Dune::cpgrid::Geometry<3,3>(elemLgrGeom.center(), elemLgrGeom.volume(), allLevelCorners, indices_storage_ptr);
-        } // refined_cells
+        }); // refined_cells
+        // Refined cell to face.
+        for (const auto& aux_refined_cell_to_face : aux_refined_cell_to_face_vec) {
+            refined_cell_to_face_vec[shiftedLevel].appendRow(aux_refined_cell_to_face.begin(), aux_refined_cell_to_face.end());
+        }
         // Refined face to cell.
         refined_cell_to_face_vec[shiftedLevel].makeInverseRelation(refined_face_to_cell_vec[shiftedLevel]);
     } // end-shiftedLevel-for-loop
@@ -1497,7 +1572,7 @@ void populateLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
                              Dune::cpgrid::EntityVariableBase<Dune::cpgrid::Geometry<0,3>>& adapted_corners,
                              const int& corner_count,
                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
-                             const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner)
+                             const std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner)
 {
     adapted_corners.resize(corner_count);
     for (int corner = 0; corner < corner_count; ++corner) {
@@ -1516,12 +1591,12 @@ void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                            Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>& mutable_face_normals,
                            Opm::SparseTable<int>& adapted_face_to_point,
                            const int& face_count,
-                           const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                           const std::vector<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                           const IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                           const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            [[maybe_unused]] const std::vector<int>& assignRefinedLevel,
-                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                           const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                            [[maybe_unused]] const std::vector<std::array<int,3>>& cells_per_dim_vec,
                            [[maybe_unused]] const int& preAdaptMaxLevel)
@@ -1558,8 +1633,8 @@ void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
             std::size_t adaptedCorn = 0; // It'll get rewritten.
             const auto& elemLgrCorn = preAdapt_face_to_point[corn];
             // Corner is stored in adapted_corners
-            if (auto candidate = elemLgrAndElemLgrCorner_to_adaptedCorner.find({elemLgr, elemLgrCorn}); candidate !=  elemLgrAndElemLgrCorner_to_adaptedCorner.end()) {
-                adaptedCorn = candidate->second;
+            if (const auto* candidate = elemLgrAndElemLgrCorner_to_adaptedCorner.find({elemLgr, elemLgrCorn})) {
+                adaptedCorn = *candidate;
             }
             else{
                 // Corner might have vanished - Search its equivalent lgr-corner in that case -
@@ -1569,8 +1644,8 @@ void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                     lastAppearanceLgr_lgrEquivCorner = cornerInMarkedElemWithEquivRefinedCorner[elemLgrCorn].back();
                 }
                 if (elemLgr>-1) { // It represents the refinement of the element with index "elemIdx == elemLgr"
-                    if (auto corner_candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, elemLgrCorn}); corner_candidate != markedElemAndEquivRefinedCorn_to_corner.end()) {
-                        lastAppearanceLgr_lgrEquivCorner =  cornerInMarkedElemWithEquivRefinedCorner[corner_candidate->second].back();
+                    if (const auto* corner_candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, elemLgrCorn})) {
+                        lastAppearanceLgr_lgrEquivCorner =  cornerInMarkedElemWithEquivRefinedCorner[*corner_candidate].back();
                     }
                     else {
 #ifndef NDEBUG
@@ -1585,7 +1660,7 @@ void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                         // This corner lies on the area occupied by a coarse face that got refined and belonged to two marked elements.
                         // Get the index of this corner with respect to the greatest marked element index, using find instead of count.
                         lastAppearanceLgr_lgrEquivCorner = vanishedRefinedCorner_to_itsLastAppearance.at({elemLgr, elemLgrCorn});
-                        while (elemLgrAndElemLgrCorner_to_adaptedCorner.find( lastAppearanceLgr_lgrEquivCorner ) == elemLgrAndElemLgrCorner_to_adaptedCorner.end()) {
+                        while (!elemLgrAndElemLgrCorner_to_adaptedCorner.contains(lastAppearanceLgr_lgrEquivCorner)) {
                             const auto& tempLgr_lgrCorner = lastAppearanceLgr_lgrEquivCorner;
                             lastAppearanceLgr_lgrEquivCorner =  vanishedRefinedCorner_to_itsLastAppearance.at(tempLgr_lgrCorner);
                         }
@@ -1609,15 +1684,15 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
                            const int& cell_count,
                            Dune::cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                            Dune::cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
-                           const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                           const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                           const IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                            const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                            const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                           const IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                           const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            const std::vector<int>& assignRefinedLevel,
-                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                           const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                            const std::vector<std::array<int,3>>& cells_per_dim_vec,
                            const int& preAdaptMaxLevel)
@@ -1648,8 +1723,8 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
         for (int corn = 0; corn < 8; ++corn) {
             int adaptedCorn = 0; // It'll get rewritten.
             const auto& preAdaptCorn = preAdapt_cell_to_point[corn];
-            auto adapted_candidate =  elemLgrAndElemLgrCorner_to_adaptedCorner.find({elemLgr, preAdaptCorn});
-            if ( adapted_candidate == elemLgrAndElemLgrCorner_to_adaptedCorner.end() ) {
+            const auto* adapted_candidate =  elemLgrAndElemLgrCorner_to_adaptedCorner.find({elemLgr, preAdaptCorn});
+            if ( !adapted_candidate ) {
                 // Corner might have vanished - Search its equivalent lgr-corner in that case -
                 // last lgr where the corner appears -
                 std::array<int,2> lastAppearanceLgr_lgrEquivCorner = {0, 0}; // It'll get rewritten.
@@ -1659,8 +1734,8 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
                 if (elemLgr > -1) {
                     // Corner might have vanished - Search its equivalent lgr-corner in that case -
                     // last lgr where the corner appears -
-                    if(auto candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, preAdaptCorn}); candidate != markedElemAndEquivRefinedCorn_to_corner.end()) {
-                        lastAppearanceLgr_lgrEquivCorner = cornerInMarkedElemWithEquivRefinedCorner[candidate->second].back();
+                    if(const auto* candidate = markedElemAndEquivRefinedCorn_to_corner.find({elemLgr, preAdaptCorn})) {
+                        lastAppearanceLgr_lgrEquivCorner = cornerInMarkedElemWithEquivRefinedCorner[*candidate].back();
                     }
                     else {
                         // To locate vanished corners, we need a while-loop, since {elemLgr, elemLgrcorner} leads to
@@ -1670,7 +1745,7 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
                         // This corner lies on the area occupied by a coarse face that got refined and belonged to two marked elements.
                         // Get the index of this corner with respect to the greatest marked element index.
                         lastAppearanceLgr_lgrEquivCorner = vanishedRefinedCorner_to_itsLastAppearance.at({elemLgr, preAdaptCorn});
-                        while (elemLgrAndElemLgrCorner_to_adaptedCorner.find(lastAppearanceLgr_lgrEquivCorner) == elemLgrAndElemLgrCorner_to_adaptedCorner.end()) {
+                        while (!elemLgrAndElemLgrCorner_to_adaptedCorner.contains(lastAppearanceLgr_lgrEquivCorner)) {
                             const auto& tempLgr_lgrCorner =  lastAppearanceLgr_lgrEquivCorner;
                             lastAppearanceLgr_lgrEquivCorner =  vanishedRefinedCorner_to_itsLastAppearance.at(tempLgr_lgrCorner);
                         }
@@ -1680,8 +1755,7 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
             }
             // Corner is stored in adapted_corners
             else {
-                assert(adapted_candidate != elemLgrAndElemLgrCorner_to_adaptedCorner.end());
-                adaptedCorn = adapted_candidate->second;
+                adaptedCorn = *adapted_candidate;
             }
             adapted_cell_to_point[cell][corn] = adaptedCorn;
         } // end-cell_to_point
@@ -1690,8 +1764,8 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
         for (const auto& face : preAdapt_cell_to_face) {
             const auto& preAdaptFace = face.index();
             // Face is stored in adapted_faces
-            if (auto candidate = elemLgrAndElemLgrFace_to_adaptedFace.find({elemLgr, preAdaptFace}); candidate != elemLgrAndElemLgrFace_to_adaptedFace.end()) {
-                const int adaptedFace = candidate->second;
+            if (const auto* candidate = elemLgrAndElemLgrFace_to_adaptedFace.find({elemLgr, preAdaptFace})) {
+                const int adaptedFace = *candidate;
                 aux_cell_to_face.push_back({adaptedFace, face.orientation()});
             }
             else{
@@ -1762,7 +1836,6 @@ void predictMinCellAndPointGlobalIdPerProcess([[maybe_unused]] const Dune::CpGri
     auto max_globalId_levelZero = grid.comm().max(grid.currentData().front()->globalIdSet().getMaxGlobalId());
 
     // Predict how many new cell ids per process are needed.
-    std::vector<std::size_t> cell_ids_needed_by_proc(grid.comm().size());
     std::size_t local_cell_ids_needed = 0;
     for ( const auto& element : Dune::elements( grid.levelGridView(0), Dune::Partitions::interior) ) {
         // Get old mark (from level zero). After calling adapt, all marks are set to zero.
@@ -1774,11 +1847,11 @@ void predictMinCellAndPointGlobalIdPerProcess([[maybe_unused]] const Dune::CpGri
             local_cell_ids_needed += cells_per_dim_vec[level-1][0]*cells_per_dim_vec[level-1][1]*cells_per_dim_vec[level-1][2];
         }
     }
-    grid.comm().allgather(&local_cell_ids_needed, 1, cell_ids_needed_by_proc.data());
+    // Only the sums over lower ranks and over all ranks are needed, no values of single ranks.
+    const auto [cell_ids_needed_before, cell_ids_needed] = Opm::exclusiveSum(local_cell_ids_needed, grid.comm());
 
     // Overestimate ('predict') how many new point ids per process are needed.
     // Assign for all partition type points a 'candidate of global id' (unique in each process).
-    std::vector<std::size_t> point_ids_needed_by_proc(grid.comm().size());
     std::size_t local_point_ids_needed = 0;
     for (std::size_t level = 1; level < cells_per_dim_vec.size()+1; ++level){
         if(lgr_with_at_least_one_active_cell[level-1]>0) {
@@ -1794,17 +1867,11 @@ void predictMinCellAndPointGlobalIdPerProcess([[maybe_unused]] const Dune::CpGri
             }
         }
     }
-    grid.comm().allgather(&local_point_ids_needed, 1, point_ids_needed_by_proc.data());
-
-    auto expected_max_globalId_cell = std::accumulate(cell_ids_needed_by_proc.begin(),
-                                                      cell_ids_needed_by_proc.end(),
-                                                      max_globalId_levelZero + 1);
-    min_globalId_cell_in_proc = std::accumulate(cell_ids_needed_by_proc.begin(),
-                                                cell_ids_needed_by_proc.begin()+grid.comm().rank(),
-                                                max_globalId_levelZero + 1);
-    min_globalId_point_in_proc = std::accumulate(point_ids_needed_by_proc.begin(),
-                                                 point_ids_needed_by_proc.begin()+ grid.comm().rank(),
-                                                 expected_max_globalId_cell+1);
+    const auto point_ids_needed_before = Opm::exclusiveSum(local_point_ids_needed, grid.comm()).first;
+
+    const int expected_max_globalId_cell = max_globalId_levelZero + 1 + static_cast<int>(cell_ids_needed);
+    min_globalId_cell_in_proc = max_globalId_levelZero + 1 + static_cast<int>(cell_ids_needed_before);
+    min_globalId_point_in_proc = expected_max_globalId_cell + 1 + static_cast<int>(point_ids_needed_before);
 #endif
 }
 
@@ -24,13 +24,12 @@
 #include <dune/common/version.hh>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/IndexPairMap.hpp>
 
 #include <array>
-#include <map>
 #include <memory>
 #include <string>
 #include <tuple>
-#include <unordered_map>
 #include <utility> // for std::pair
 #include <vector>
 
@@ -89,17 +88,17 @@ void refineAndProvideMarkedRefinedRelations(const Dune::CpGrid& grid,/* Marked e
                                             std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                             int& markedElem_count,
                                             std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                            std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                            IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                             std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                             /* Refined cells parameters */
-                                            std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAdRefinedCell,
-                                            std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                            IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAdRefinedCell,
+                                            IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                             std::vector<int>& refined_cell_count_vec,
                                             const std::vector<int>& assignRefinedLevel,
                                             std::vector<std::vector<std::tuple<int,std::vector<int>>>>& preAdapt_parent_to_children_cells_vec,
                                             /* Adapted cells parameters */
-                                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                            std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                            IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                            std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                             int& cell_count,
                                             std::vector<std::vector<int>>& preAdapt_level_to_leaf_cells_vec,
                                             /* Additional parameters */
@@ -129,9 +128,9 @@ std::tuple< std::vector<std::vector<std::array<int,2>>>,
             std::vector<int>>
 defineChildToParentAndIdxInParentCell(const Dune::cpgrid::CpGridData& current_data,
                                       int preAdaptMaxLevel,
-                                      const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                      const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                       const std::vector<int>& refined_cell_count_vec,
-                                      const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                      const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                       const int& cell_count);
 
 /// @brief Define index mappings between refined level grids and the leaf (adapted) grid:
@@ -157,11 +156,11 @@ defineChildToParentAndIdxInParentCell(const Dune::cpgrid::CpGridData& current_da
 std::pair<std::vector<std::vector<int>>, std::vector<std::array<int,2>>>
 defineLevelToLeafAndLeafToLevelCells(const Dune::cpgrid::CpGridData& current_data,
                                      int preAdaptMaxLevel,
-                                     const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                     const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                     const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                     const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                      const std::vector<int>& refined_cell_count_vec,
-                                     const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                     const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                     const IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                     const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                      const int& cell_count);
 
 /// @brief Define refined corner relations:
@@ -185,10 +184,10 @@ defineLevelToLeafAndLeafToLevelCells(const Dune::cpgrid::CpGridData& current_dat
 /// @param [in] cells_per_dim_vec
 void identifyRefinedCornersPerLevel(const Dune::cpgrid::CpGridData& current_data,
                                     int preAdaptMaxLevel,
-                                    std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                    std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+                                    IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                    IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
                                     std::vector<int>& refined_corner_count_vec,
-                                    std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                    IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                     const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                     const std::vector<int>& assignRefinedLevel,
                                     const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
@@ -302,33 +301,33 @@ int replaceLgr1CornerIdxByLgr2CornerIdx(const Dune::cpgrid::CpGridData& current_
 /// @param [in] cells_per_dim_vec
 void identifyLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
                              int preAdaptMaxLevel,
-                             std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                             std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                             IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                             std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                              int& corner_count,
                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                              const std::vector<int>& assignRefinedLevel,
                              const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                             std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                             IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                              const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                              const std::vector<std::array<int,3>>& cells_per_dim_vec);
 
 void markVanishedCorner(const std::array<int,2>& vanished,
                                const std::array<int,2>& lastAppearance,
-                        std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance);
+                        IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance);
 
 void processInteriorCorners(int elemIdx, int shiftedLevel,
                             const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                             int& corner_count,
-                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                            std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                            IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                            std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                             const std::vector<std::array<int,3>>& cells_per_dim_vec);
 
 void processEdgeCorners(int elemIdx, int shiftedLevel,
                         const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                         int& corner_count,
-                        std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                        std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                        std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                        IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                        std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                        IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                         const Dune::cpgrid::CpGridData& current_data,
                         int preAdaptMaxLevel,
                         const std::vector<int>& assignRefinedLevel,
@@ -338,9 +337,9 @@ void processEdgeCorners(int elemIdx, int shiftedLevel,
 void processBoundaryCorners(int elemIdx, int shiftedLevel,
                             const std::shared_ptr<Dune::cpgrid::CpGridData>& lgr,
                             int& corner_count,
-                            std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                            std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                            std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                            IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                            std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                            IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                             const Dune::cpgrid::CpGridData& current_data,
                             int preAdaptMaxLevel,
                             const std::vector<int>& assignRefinedLevel,
@@ -349,22 +348,22 @@ void processBoundaryCorners(int elemIdx, int shiftedLevel,
 
 // To insert bidirectional mapping and increment counter
 // keyB is equal to counter, before it gets increased by one.
-void insertBidirectional(std::map<std::array<int,2>,int>& a_to_b,
-                         std::unordered_map<int,std::array<int,2>>& b_to_a,
+void insertBidirectional(IndexPairMap<int>& a_to_b,
+                         std::vector<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          int& counter);
 
 // To insert bidirectional mapping and increment counter
-void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
-                         std::map<std::array<int,2>,std::array<int,2>>& b_to_a,
+void insertBidirectional(IndexPairMap<std::array<int,2>>& a_to_b,
+                         IndexPairMap<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          const std::array<int,2>& keyB,
                          int& counter);
 
 // To insert bidirectional mapping and increment counter
 // keyB = {keyBfirst, counter before it gets increased by one}.
-void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
-                         std::map<std::array<int,2>,std::array<int,2>>& b_to_a,
+void insertBidirectional(IndexPairMap<std::array<int,2>>& a_to_b,
+                         IndexPairMap<std::array<int,2>>& b_to_a,
                          const std::array<int,2>& keyA,
                          int keyBfirst,
                          int& counter);
@@ -385,8 +384,8 @@ void insertBidirectional(std::map<std::array<int,2>,std::array<int,2>>& a_to_b,
 /// @param [in] cells_per_dim_vec
 void identifyRefinedFacesPerLevel(const Dune::cpgrid::CpGridData& current_data,
                                   int preAdaptMaxLevel,
-                                  std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
-                                  std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                  IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                  IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
                                   std::vector<int>& refined_face_count_vec,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const std::vector<int>& assignRefinedLevel,
@@ -409,8 +408,8 @@ void identifyRefinedFacesPerLevel(const Dune::cpgrid::CpGridData& current_data,
 /// @param [in] cells_per_dim_vec
 void identifyLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                            int preAdaptMaxLevel,
-                           std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
-                           std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                           IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                           std::vector<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
                            int& face_count,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            const std::vector<int>& assignRefinedLevel,
@@ -470,7 +469,7 @@ void populateRefinedCorners(std::vector<Dune::cpgrid::EntityVariableBase<Dune::c
                             const std::vector<int>& refined_corner_count_vec,
                             const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                             const int& preAdaptMaxLevel,
-                            const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner);
+                            const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner);
 
 /// @brief Define the faces, face tags, face normarls, and face_to_point_, for each refined level grid.
 void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpgrid::Geometry<2,3>>>& refined_faces_vec,
@@ -478,13 +477,13 @@ void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<Dune::cpg
                           std::vector<Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>>& mutable_refine_face_normals_vec,
                           std::vector<Opm::SparseTable<int>>& refined_face_to_point_vec,
                           const std::vector<int>& refined_face_count_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                          const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                          const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                          const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                           const int& preAdaptMaxLevel,
                           const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                          const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner);
+                          const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner);
 
 
 /// @brief Define the cells, cell_to_point_, global_cell_, cell_to_face_, face_to_cell_, for each refined level grid.
@@ -495,16 +494,16 @@ void populateRefinedCells(const Dune::cpgrid::CpGridData& current_data,
                           const std::vector<int>& refined_cell_count_vec,
                           std::vector<Dune::cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                           std::vector<Dune::cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                          const IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                           const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                           const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                          const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                          const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                          const IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                          const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                           const std::vector<int>& assignRefinedLevel,
                           const int& preAdaptMaxLevel,
-                          const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                          const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                           const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                           const std::vector<std::array<int,3>>&  cells_per_dim_vec);
 
@@ -527,7 +526,7 @@ void populateLeafGridCorners(const Dune::cpgrid::CpGridData& current_data,
                              Dune::cpgrid::EntityVariableBase<Dune::cpgrid::Geometry<0,3>>& adapted_corners,
                              const int& corners_count,
                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
-                             const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner);
+                             const std::vector<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner);
 
 /// @brief Define the faces, face tags, face normarls, and face_to_point_, for the leaf grid view.
 void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
@@ -536,12 +535,12 @@ void populateLeafGridFaces(const Dune::cpgrid::CpGridData& current_data,
                            Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>& mutable_face_normals,
                            Opm::SparseTable<int>& adapted_face_to_point,
                            const int& face_count,
-                           const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                           const std::vector<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                           const IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                           const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            const std::vector<int>& assignRefinedLevel,
-                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                           const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                            const std::vector<std::array<int,3>>& cells_per_dim_vec,
                            const int& preAdaptMaxLevel);
@@ -553,15 +552,15 @@ void populateLeafGridCells(const Dune::cpgrid::CpGridData& current_data,
                            const int& cell_count,
                            Dune::cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                            Dune::cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
-                           const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                           const std::vector<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                           const IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                            const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                            const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                           const IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                           const IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                            const std::vector<int>& assignRefinedLevel,
-                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                           const IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                            const std::vector<std::array<int,3>>& cells_per_dim_vec,
                            const int& preAdaptMaxLevel);
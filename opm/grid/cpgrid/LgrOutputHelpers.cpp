@@ -28,7 +28,8 @@
 #include <opm/grid/cpgrid/LgrOutputHelpers.hpp>
 #include <opm/grid/cpgrid/LevelCartesianIndexMapper.hpp>
 
-#include <algorithm> // for std::sort
+#include <algorithm> // for std::ranges::stable_sort
+#include <cassert>
 #include <utility>   // for std::pair
 #include <vector>
 
@@ -43,25 +44,38 @@ std::vector<int> mapLevelIndicesToCartesianOutputOrder(const Dune::CpGrid& grid,
 {
     const int lgr_cells = grid.levelGridView(level).size(0);
 
-    std::vector<std::pair<int,int>> sorted_levelIdxToLevelCartIdx;
-    sorted_levelIdxToLevelCartIdx.reserve(lgr_cells);
+    std::vector<int> toOutput; // Consecutive numbers, from 0 to total elemts in LGR1 -1
+    toOutput.reserve(lgr_cells);
 
-    for (const auto& element : Dune::elements(grid.levelGridView(level))) {
-        sorted_levelIdxToLevelCartIdx.push_back(std::make_pair(element.index(),
-                                                               levelCartMapp.cartesianIndex(element.index(),level)));
-    }
+    if (!levelCartMapp.uniqueCartesianIndices(level)) {
+        // Refined cells of levels created by adapt() share the level Cartesian index of their parent cell.
+        // Sorting keeps all of them, ordered by level index among cells with the same Cartesian index.
+        std::vector<std::pair<int,int>> sorted_levelIdxToLevelCartIdx;
+        sorted_levelIdxToLevelCartIdx.reserve(lgr_cells);
 
-    std::ranges::sort(sorted_levelIdxToLevelCartIdx,
-                      [](const auto& a, const auto& b)
-                      { return a.second < b.second; });
+        for (const auto& element : Dune::elements(grid.levelGridView(level))) {
+            sorted_levelIdxToLevelCartIdx.push_back(std::make_pair(element.index(),
+                                                                   levelCartMapp.cartesianIndex(element.index(),level)));
+        }
 
-    std::vector<int> toOutput; // Consecutive numbers, from 0 to total elemts in LGR1 -1
-    toOutput.reserve(lgr_cells);
+        std::ranges::stable_sort(sorted_levelIdxToLevelCartIdx,
+                                 [](const auto& a, const auto& b)
+                                 { return a.second < b.second; });
 
-    // Redefinition of level Cartesian indices (output-style)
-    for (const auto& [sorted_elemIdx, sorted_cartIdx] : sorted_levelIdxToLevelCartIdx) {
-        toOutput.push_back(sorted_elemIdx);
+        for (const auto& [sorted_elemIdx, sorted_cartIdx] : sorted_levelIdxToLevelCartIdx) {
+            toOutput.push_back(sorted_elemIdx);
+        }
+        return toOutput;
+    }
+
+    // Redefinition of level Cartesian indices (output-style): traversing the dense level Cartesian
+    // to level compressed map visits the active cells in increasing level Cartesian index, no sorting needed.
+    for (const auto& elemIdx : levelCartMapp.cartesianToCompressed(level)) {
+        if (elemIdx >= 0) {
+            toOutput.push_back(elemIdx);
+        }
     }
+    assert(static_cast<int>(toOutput.size()) == lgr_cells);
     return toOutput;
 }
 
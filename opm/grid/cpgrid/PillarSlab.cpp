@@ -0,0 +1,118 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#include <opm/grid/cpgrid/PillarSlab.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+PillarSlab partitionPillarSlabs(const std::array<int,3>& dims,
+                                int rank, int size, int halo)
+{
+    if (size < 1 || rank < 0 || rank >= size) {
+        OPM_THROW(std::invalid_argument, "Invalid rank " + std::to_string(rank) +
+                  " for " + std::to_string(size) + " processes.");
+    }
+    if (dims[1] < size) {
+        OPM_THROW(std::invalid_argument, "Cannot split " + std::to_string(dims[1]) +
+                  " rows into " + std::to_string(size) + " pillar slabs.");
+    }
+    if (size > 1 && halo < 1) {
+        OPM_THROW(std::invalid_argument, "Pillar slabs need at least one halo row.");
+    }
+
+    // The first (ny % size) slabs get one additional row.
+    const int base = dims[1] / size;
+    const int extra = dims[1] % size;
+    PillarSlab slab;
+    slab.dims = dims;
+    slab.owned[0] = rank * base + std::min(rank, extra);
+    slab.owned[1] = slab.owned[0] + base + (rank < extra ? 1 : 0);
+    slab.stored[0] = std::max(slab.owned[0] - halo, 0);
+    slab.stored[1] = std::min(slab.owned[1] + halo, dims[1]);
+    return slab;
+}
+
+void extractPillarSlab(const grdecl& global,
+                       const PillarSlab& slab,
+                       std::vector<double>& coord,
+                       std::vector<double>& zcorn,
+                       std::vector<int>& actnum,
+                       grdecl& output)
+{
+    const int nx = global.dims[0];
+    const int ny = global.dims[1];
+    const int nz = global.dims[2];
+    if (nx != slab.dims[0] || ny != slab.dims[1] || nz != slab.dims[2]) {
+        OPM_THROW(std::invalid_argument, "Grid dimensions do not match those of the pillar slab.");
+    }
+    if (slab.stored[0] < 0 || slab.stored[1] > ny ||
+        slab.stored[0] > slab.owned[0] || slab.owned[0] >= slab.owned[1] ||
+        slab.owned[1] > slab.stored[1]) {
+        OPM_THROW(std::invalid_argument, "Invalid row ranges of pillar slab.");
+    }
+    const int rows = slab.numStoredRows();
+    const auto first = static_cast<std::size_t>(slab.stored[0]);
+
+    // Pillars are stored row by row, so rows [stored[0], stored[1]]
+    // are one contiguous chunk.
+    const std::size_t pillar_row = 6 * static_cast<std::size_t>(nx + 1);
+    coord.assign(global.coord + first * pillar_row,
+                 global.coord + (first + rows + 1) * pillar_row);
+
+    // Each of the 2*nz corner layers of ZCORN holds 2*ny corner rows
+    // of 2*nx values.
+    const std::size_t zrow = 2 * static_cast<std::size_t>(nx);
+    const std::size_t zlayer = zrow * 2 * ny;
+    zcorn.clear();
+    zcorn.reserve(zrow * 2 * rows * 2 * nz);
+    for (int kz = 0; kz < 2 * nz; ++kz) {
+        const double* begin = global.zcorn + kz * zlayer + 2 * first * zrow;
+        zcorn.insert(zcorn.end(), begin, begin + 2 * rows * zrow);
+    }
+
+    actnum.clear();
+    if (global.actnum != nullptr) {
+        actnum.reserve(static_cast<std::size_t>(nx) * rows * nz);
+        for (int k = 0; k < nz; ++k) {
+            const int* begin = global.actnum
+                + (static_cast<std::size_t>(k) * ny + first) * nx;
+            actnum.insert(actnum.end(), begin, begin + static_cast<std::size_t>(rows) * nx);
+        }
+    }
+
+    output.dims[0] = nx;
+    output.dims[1] = rows;
+    output.dims[2] = nz;
+    output.coord = coord.data();
+    output.zcorn = zcorn.data();
+    output.actnum = actnum.empty() ? nullptr : actnum.data();
+}
+
+} // namespace cpgrid
+} // namespace Dune
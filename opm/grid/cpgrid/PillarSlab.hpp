@@ -0,0 +1,95 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_CPGRID_PILLARSLAB_HEADER_INCLUDED
+#define OPM_GRID_CPGRID_PILLARSLAB_HEADER_INCLUDED
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <array>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief A slab of cell rows (J direction) of a corner-point grid.
+///
+/// Each process owns the cells in rows [owned[0], owned[1]) and all
+/// I and K indices. It additionally stores the halo rows needed to
+/// build the geometry of its owned cells exactly, i.e. rows
+/// [stored[0], stored[1]). Cells in halo rows become overlap cells
+/// of the distributed grid.
+struct PillarSlab
+{
+    /// \brief Logical Cartesian dimensions of the whole grid.
+    std::array<int,3> dims{};
+    /// \brief First and one past last row owned by this process.
+    std::array<int,2> owned{};
+    /// \brief First and one past last row stored by this process.
+    std::array<int,2> stored{};
+
+    /// \brief Number of cell rows stored by this process.
+    int numStoredRows() const
+    {
+        return stored[1] - stored[0];
+    }
+};
+
+/// \brief Compute the pillar slab of a process.
+///
+/// The rows of the grid are split into size slabs of (nearly) equal
+/// width, in rank order.
+///
+/// \param dims The logical Cartesian dimensions of the whole grid.
+/// \param rank The rank of the process.
+/// \param size The number of processes.
+/// \param halo The number of halo rows on each side of the owned rows.
+///             Has to be at least one if size > 1.
+PillarSlab partitionPillarSlabs(const std::array<int,3>& dims,
+                                int rank, int size, int halo = 1);
+
+/// \brief Extract the stored rows of a slab from a grid description.
+///
+/// COORD is copied for the pillar rows [stored[0], stored[1]], ZCORN
+/// and ACTNUM for the cell rows [stored[0], stored[1]). For each of
+/// these the copied data consists of contiguous chunks of the input
+/// (one for COORD, one per layer for ACTNUM, and two per layer for ZCORN),
+/// which allows readers to only load the slab from file.
+///
+/// \param global The description of the whole grid.
+/// \param slab The slab to extract.
+/// \param coord Storage for the COORD values of the slab.
+/// \param zcorn Storage for the ZCORN values of the slab.
+/// \param actnum Storage for the ACTNUM values of the slab. Left empty if
+///               global has no ACTNUM.
+/// \param output The grid description of the slab referring to the
+///               storage above.
+void extractPillarSlab(const grdecl& global,
+                       const PillarSlab& slab,
+                       std::vector<double>& coord,
+                       std::vector<double>& zcorn,
+                       std::vector<int>& actnum,
+                       grdecl& output);
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_GRID_CPGRID_PILLARSLAB_HEADER_INCLUDED
@@ -46,6 +46,7 @@
 #include <opm/grid/RepairZCORN.hpp>
 #include <opm/grid/utility/OpmLog.hpp>
 #include <opm/grid/utility/StopWatch.hpp>
+#include <opm/grid/utility/createThreadIterators.hpp>
 
 #include <opm/grid/cpgrid/Entity.hpp>
 #include <opm/grid/cpgrid/Geometry.hpp>
@@ -64,6 +65,7 @@
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <ranges>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -71,6 +73,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Dune
 {
 
@@ -205,10 +211,16 @@ namespace cpgrid
                     return transMult.getMultiplier(cartindex, ::Opm::FaceDir::ZPlus) *
                         transMult.getMultiplier(cartindex, ::Opm::FaceDir::ZMinus);
                 };
+                auto minpv_timer = phaseStatistics().time("MinpvProcessor::process");
                 minpv_result = mp.process(thickness, z_tolerance, ecl_grid.getPinchMaxEmptyGap(),
                                           poreVolume, ecl_grid.getMinpvVector(), actnumData, false,
                                           zcornData.data(), nogap, pinchOptionALL,
                                           permZ, multZ, tolerance_unique_points);
+                minpv_timer.stop();
+                phaseStatistics().addCounter("MinpvProcessor::process", "removed_cells",
+                                             minpv_result.removed_cells.size());
+                phaseStatistics().addCounter("MinpvProcessor::process", "nncs",
+                                             minpv_result.nnc.size());
                 if (!minpv_result.nnc.empty()) {
                     this->zcorn = zcornData;
                 }
@@ -457,6 +469,7 @@ namespace cpgrid
 
         processed_grid output{};
         int process_ok{};
+        auto process_timer = phaseStatistics().time("process_grdecl");
 
 #if HAVE_OPM_COMMON
         if ((ecl_state != nullptr) && ecl_state->aquifer().hasNumericalAquifer()) {
@@ -497,6 +510,10 @@ namespace cpgrid
                       "Failed to build unstructured "
                       "grid from COORD/ZCORN");
         }
+        process_timer.stop();
+        phaseStatistics().addCounter("process_grdecl", "cells", output.number_of_cells);
+        phaseStatistics().addCounter("process_grdecl", "faces", output.number_of_faces);
+        phaseStatistics().addCounter("process_grdecl", "nodes", output.number_of_nodes);
 
         if (remove_ij_boundary) {
             removeOuterCellLayer(output);
@@ -537,10 +554,14 @@ namespace cpgrid
         std::cout << "Building topology." << std::endl;
 #endif
         std::vector<int> face_to_output_face{};
+        auto topo_timer = phaseStatistics().time("buildTopo");
         buildTopo(output, nnc, global_cell_,
                   cell_to_face_, face_to_cell_,
                   face_to_point_, cell_to_point_,
                   face_to_output_face);
+        topo_timer.stop();
+        phaseStatistics().addCounter("buildTopo", "nnc_faces",
+                                     std::ranges::count(face_to_output_face, NNCFace));
 
         std::copy_n(output.dimensions, 3, logical_cartesian_size_.begin());
 
@@ -568,6 +589,9 @@ namespace cpgrid
         }
 #endif
 
+        geometry_arrays_.reset();
+        face_neighbours_.reset();
+        auto geom_timer = phaseStatistics().time("buildGeom");
         buildGeom(output, cell_to_face_, cell_to_point_,
                   face_to_output_face,
                   aquifer_cell_volumes_local,
@@ -576,6 +600,7 @@ namespace cpgrid
                   geometry_.geomVector(std::integral_constant<int,3>()),
                   face_normals_,
                   turn_normals);
+        geom_timer.stop();
 
 #ifdef VERBOSE
         std::cout << "Assigning face tags." << std::endl;
@@ -611,6 +636,105 @@ namespace cpgrid
 #endif
     }
 
+
+    /// Read one pillar slab of the Eclipse grid format ('.grdecl').
+    void CpGridData::processDistributedEclipseFormat(const grdecl& input_data,
+                                                     const PillarSlab& slab,
+                                                     const bool turn_normals,
+                                                     const bool pinchActive,
+                                                     const double tolerance_unique_points,
+                                                     const bool edge_conformal)
+    {
+        if (input_data.dims[0] != slab.dims[0] ||
+            input_data.dims[1] != slab.numStoredRows() ||
+            input_data.dims[2] != slab.dims[2]) {
+            OPM_THROW(std::invalid_argument, "Grid description does not match "
+                      "the stored rows of the pillar slab");
+        }
+        // Owned cells need all their neighbours to get the same
+        // points and faces as in a grid built from the whole model.
+        if (slab.stored[0] < 0 || slab.stored[1] > slab.dims[1] ||
+            slab.stored[0] > slab.owned[0] || slab.owned[1] > slab.stored[1] ||
+            slab.owned[0] >= slab.owned[1] ||
+            (slab.owned[0] > 0 && slab.stored[0] >= slab.owned[0]) ||
+            (slab.owned[1] < slab.dims[1] && slab.stored[1] <= slab.owned[1])) {
+            OPM_THROW(std::invalid_argument, "Pillar slab needs at least one "
+                      "halo row next to each inner slab boundary");
+        }
+
+        processed_grid output{};
+        auto process_timer = phaseStatistics().time("process_grdecl");
+        const int process_ok = process_grdecl(static_cast<int>(pinchActive),
+                                              static_cast<int>(edge_conformal),
+                                              tolerance_unique_points,
+                                              &input_data,
+                                              /* is_aquifer_cell = */ nullptr,
+                                              &output);
+        process_timer.stop();
+
+        // All processes have to fail together, as the setup below is collective.
+        if (ccobj_.min(process_ok) == 0) {
+            free_processed_grid(&output);
+            OPM_THROW(std::runtime_error,
+                      "Failed to build unstructured "
+                      "grid from COORD/ZCORN of pillar slab");
+        }
+
+        phaseStatistics().addCounter("process_grdecl", "cells", output.number_of_cells);
+        phaseStatistics().addCounter("process_grdecl", "faces", output.number_of_faces);
+        phaseStatistics().addCounter("process_grdecl", "nodes", output.number_of_nodes);
+
+        const NNCMaps nnc{};
+        std::vector<int> face_to_output_face{};
+        auto topo_timer = phaseStatistics().time("buildTopo");
+        buildTopo(output, nnc, global_cell_,
+                  cell_to_face_, face_to_cell_,
+                  face_to_point_, cell_to_point_,
+                  face_to_output_face);
+        topo_timer.stop();
+
+        // Translate Cartesian indices of the slab to those of the whole grid.
+        // This keeps the lexicographic order of the cells.
+        const int nx = slab.dims[0];
+        const int rows = slab.numStoredRows();
+        for (auto& cartesian : global_cell_) {
+            const int i = cartesian % nx;
+            const int j = (cartesian / nx) % rows + slab.stored[0];
+            const int k = cartesian / (nx * rows);
+            cartesian = i + nx * (j + slab.dims[1] * k);
+        }
+        logical_cartesian_size_ = slab.dims;
+
+        geometry_arrays_.reset();
+        face_neighbours_.reset();
+        auto geom_timer = phaseStatistics().time("buildGeom");
+        buildGeom(output, cell_to_face_, cell_to_point_,
+                  face_to_output_face,
+                  /* aquifer_cell_volumes = */ {},
+                  *geometry_.geomVector(std::integral_constant<int,0>()),
+                  *geometry_.geomVector(std::integral_constant<int,1>()),
+                  geometry_.geomVector(std::integral_constant<int,3>()),
+                  face_normals_,
+                  turn_normals);
+        geom_timer.stop();
+
+        const int nf = face_to_output_face.size();
+        std::vector<enum face_tag> temp_tags(nf);
+        for (int i = 0; i < nf; ++i) {
+            temp_tags[i] = output.face_tag[face_to_output_face[i]];
+        }
+        face_tag_.assign(temp_tags.begin(), temp_tags.end());
+
+        free_processed_grid(&output);
+
+        index_set_ = std::make_unique<IndexSet>(cell_to_face_.size(), geomVector<3>().size());
+
+        if (ccobj_.size() > 1) {
+            auto distribution_timer = phaseStatistics().time("setupPillarSlabDistribution");
+            setupPillarSlabDistribution(slab);
+        }
+    }
+
     } // end namespace cpgrid
 
 
@@ -1312,6 +1436,27 @@ namespace cpgrid
 
 
 
+        /// Split [0, n) into one contiguous chunk per OpenMP thread and
+        /// call body(begin, end) for each chunk, in parallel if available.
+        template <class Body>
+        void forEachChunk(int n, const Body& body)
+        {
+#ifdef _OPENMP
+            const std::size_t num_chunks = omp_get_max_threads();
+#else
+            const std::size_t num_chunks = 1;
+#endif
+            const auto indices = std::views::iota(0, n);
+            const auto chunks = Opm::createChunkIterators(indices, n, num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                body(static_cast<int>(chunks[chunk] - chunks.front()),
+                     static_cast<int>(chunks[chunk + 1] - chunks.front()));
+            }
+        }
+
         void buildGeom(const processed_grid& output,
                        const cpgrid::OrientedEntityTable<0, 1>& c2f,
                        const std::vector<std::array<int,8> >& c2p,
@@ -1361,80 +1506,89 @@ namespace cpgrid
             int nf = face_to_output_face.size();
             const int* fn = output.face_nodes;
             const unsigned* fp = output.face_node_ptr;
-            for (int face = 0; face < nf; ++face) {
-                // Computations in this loop could be speeded up
-                // by doing more of them simultaneously.
-                int output_face = face_to_output_face[face];
-                if (output_face == cpgrid::NNCFace) {
-                    // NNC faces are purely topological constructs,
-                    // and do not have any embedded geometry.
-                    // However, since the ewoms code will multiply and
-                    // divide by the face area even if not necessary
-                    // for the cell-centered FV discretization (because
-                    // it wants to deal with velocities rather than fluxes),
-                    // we have to set the areas to 1 to avoid trouble.
-                    face_normals.push_back({-1e100, -1e100, -1e100});
-                    face_centroids.push_back({-1e100, -1e100, -1e100});
-                    face_areas.push_back(1.0);
-                } else {
-                    IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
-                    point_t avg = average(face_pts);
-                    point_t centroid = polygonCentroid(face_pts, avg);
-                    point_t normal = polygonNormal(face_pts, centroid);
-                    double area = polygonArea(face_pts, centroid);
-                    face_normals.push_back(normal);
-                    face_centroids.push_back(centroid);
-                    face_areas.push_back(area);
+            face_normals.resize(nf);
+            face_centroids.resize(nf);
+            face_areas.resize(nf);
+            // Faces are independent of each other, so they are computed in parallel.
+            forEachChunk(nf, [&](int begin, int end) {
+                for (int face = begin; face < end; ++face) {
+                    // Computations in this loop could be speeded up
+                    // by doing more of them simultaneously.
+                    int output_face = face_to_output_face[face];
+                    if (output_face == cpgrid::NNCFace) {
+                        // NNC faces are purely topological constructs,
+                        // and do not have any embedded geometry.
+                        // However, since the ewoms code will multiply and
+                        // divide by the face area even if not necessary
+                        // for the cell-centered FV discretization (because
+                        // it wants to deal with velocities rather than fluxes),
+                        // we have to set the areas to 1 to avoid trouble.
+                        face_normals[face] = {-1e100, -1e100, -1e100};
+                        face_centroids[face] = {-1e100, -1e100, -1e100};
+                        face_areas[face] = 1.0;
+                    } else {
+                        IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
+                        point_t avg = average(face_pts);
+                        point_t centroid = polygonCentroid(face_pts, avg);
+                        face_normals[face] = polygonNormal(face_pts, centroid);
+                        face_centroids[face] = centroid;
+                        face_areas[face] = polygonArea(face_pts, centroid);
+                    }
                 }
-            }
+            });
 #ifdef VERBOSE
             std::cout << "Faces:              " << clock.secsSinceLast() << std::endl;
 #endif
             // Get the cell data.
+            // Cells only read the face data above, so they are computed in parallel.
             int nc = output.number_of_cells;
-            std::vector<int> face_indices;
-            for (int cell = 0; cell < nc; ++cell) {
-                cpgrid::EntityRep<0> cell_ent(cell, true);
-                cpgrid::OrientedEntityTable<0, 1>::row_type cf = c2f[cell_ent];
-                face_indices.clear();
-                for (int local_index = 0; local_index < cf.size(); ++local_index) {
-                    if (face_to_output_face[cf[local_index].index()] != cpgrid::NNCFace) {
-                        face_indices.push_back(cf[local_index].index());
+            cell_centroids.resize(nc);
+            cell_volumes.resize(nc);
+            forEachChunk(nc, [&](int begin, int end) {
+                std::vector<int> face_indices;
+                for (int cell = begin; cell < end; ++cell) {
+                    cpgrid::EntityRep<0> cell_ent(cell, true);
+                    cpgrid::OrientedEntityTable<0, 1>::row_type cf = c2f[cell_ent];
+                    face_indices.clear();
+                    for (int local_index = 0; local_index < cf.size(); ++local_index) {
+                        if (face_to_output_face[cf[local_index].index()] != cpgrid::NNCFace) {
+                            face_indices.push_back(cf[local_index].index());
+                        }
                     }
-                }
-                IndirectArray<point_t> cell_pts(face_centroids, &face_indices[0], &face_indices[0] + face_indices.size());
-                point_t cell_avg = average(cell_pts);
-                point_t cell_centroid(0.0);
-                double tot_cell_vol = 0.0;
-                for (int local_index = 0; local_index < cf.size(); ++local_index) {
-                    int face = cf[local_index].index();
-                    int output_face = face_to_output_face[face];
-                    if (output_face == cpgrid::NNCFace) {
-                        // Skip NNC face, do not contribute to cell geometry.
-                        continue;
+                    IndirectArray<point_t> cell_pts(face_centroids, &face_indices[0], &face_indices[0] + face_indices.size());
+                    point_t cell_avg = average(cell_pts);
+                    point_t cell_centroid(0.0);
+                    double tot_cell_vol = 0.0;
+                    for (int local_index = 0; local_index < cf.size(); ++local_index) {
+                        int face = cf[local_index].index();
+                        int output_face = face_to_output_face[face];
+                        if (output_face == cpgrid::NNCFace) {
+                            // Skip NNC face, do not contribute to cell geometry.
+                            continue;
+                        }
+                        IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
+                        double small_vol = polygonCellVolume(face_pts, face_centroids[face], cell_avg);
+                        tot_cell_vol += small_vol;
+                        point_t face_contrib = polygonCellCentroid(face_pts, face_centroids[face], cell_avg);
+                        face_contrib *= small_vol;
+                        cell_centroid += face_contrib;
+                    }
+                    // TODO: for the cell with zero volumes, data in cell_centroid is NaN already. We need to
+                    // find solution to deal with those cells to get sensible cell_centroid.
+                    if (tot_cell_vol > 0.) {
+                        cell_centroid /= tot_cell_vol;
                     }
-                    IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
-                    double small_vol = polygonCellVolume(face_pts, face_centroids[face], cell_avg);
-                    tot_cell_vol += small_vol;
-                    point_t face_contrib = polygonCellCentroid(face_pts, face_centroids[face], cell_avg);
-                    face_contrib *= small_vol;
-                    cell_centroid += face_contrib;
-                }
-                // TODO: for the cell with zero volumes, data in cell_centroid is NaN already. We need to
-                // find solution to deal with those cells to get sensible cell_centroid.
-                if (tot_cell_vol > 0.) {
-                    cell_centroid /= tot_cell_vol;
-                }
 // #define HACK_CELL_CENTROIDS     // when this is defined, you get the average of top and bottom face centroids.
 #ifdef HACK_CELL_CENTROIDS
-                int numf = cf.size();
-                cell_centroid = face_centroids[face_indices[numf - 2]];
-                cell_centroid += face_centroids[face_indices[numf - 1]];
-                cell_centroid *= 0.5;
+                    int numf = cf.size();
+                    cell_centroid = face_centroids[face_indices[numf - 2]];
+                    cell_centroid += face_centroids[face_indices[numf - 1]];
+                    cell_centroid *= 0.5;
 #endif
-                cell_centroids.push_back(cell_centroid);
-                cell_volumes.push_back(tot_cell_vol);
-            }
+                    cell_centroids[cell] = cell_centroid;
+                    cell_volumes[cell] = tot_cell_vol;
+                }
+            });
             // update the volumes of numerical aquifer cells
             for (const auto& [index, volume] : aquifer_cell_volumes) {
                 cell_volumes[index] = volume;
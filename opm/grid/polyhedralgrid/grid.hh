@@ -3,6 +3,8 @@
 #ifndef DUNE_POLYHEDRALGRID_GRID_HH
 #define DUNE_POLYHEDRALGRID_GRID_HH
 
+#include <algorithm>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include <opm/grid/utility/ErrorMacros.hpp>
 
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/common/FaceNeighbours.hpp>
 #include <opm/grid/cart_grid.h>
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/GridManager.hpp>
@@ -402,6 +405,56 @@ namespace Dune
 
     /** \} */
 
+    /** \brief obtain the flat face-cell adjacency of the grid
+     *
+     *  Contains the cells, face index, face tag and orientation of all
+     *  interior faces and the cell-to-face relation in compressed row
+     *  format. It is created on the first call, which is not thread safe,
+     *  and shared with all later callers.
+     */
+    std::shared_ptr< const FaceNeighbours > faceNeighbours () const
+    {
+      if( !faceNeighbours_ )
+      {
+        auto neighbours = std::make_shared< FaceNeighbours >();
+        const int nc = grid_.number_of_cells;
+        const int nf = grid_.number_of_faces;
+
+        // the direction of a face is given by the tags of its half faces
+        std::vector< int > faceTags( nf, -1 );
+        neighbours->cell_face_offsets.resize( nc+1 );
+        neighbours->cell_faces.assign( grid_.cell_faces, grid_.cell_faces + grid_.cell_facepos[ nc ] );
+        for( int c = 0; c < nc; ++c )
+        {
+          neighbours->cell_face_offsets[ c+1 ] = grid_.cell_facepos[ c+1 ];
+          if( grid_.cell_facetag )
+          {
+            for( int hf = grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[ c+1 ]; ++hf )
+              faceTags[ grid_.cell_faces[ hf ] ] = grid_.cell_facetag[ hf ] / 2;
+          }
+        }
+
+        neighbours->cells.reserve( nf );
+        neighbours->faces.reserve( nf );
+        neighbours->tags.reserve( nf );
+        neighbours->orientations.reserve( nf );
+        for( int face = 0; face < nf; ++face )
+        {
+          // the normal points from the first to the second cell
+          const int c0 = grid_.face_cells[ 2*face ];
+          const int c1 = grid_.face_cells[ 2*face+1 ];
+          if( c0 < 0 || c1 < 0 )
+            continue;
+          neighbours->cells.push_back( { std::min( c0, c1 ), std::max( c0, c1 ) } );
+          neighbours->faces.push_back( face );
+          neighbours->tags.push_back( faceTags[ face ] );
+          neighbours->orientations.push_back( c0 < c1 );
+        }
+        faceNeighbours_ = std::move( neighbours );
+      }
+      return faceNeighbours_;
+    }
+
     /** \name Size Methods
      *  \{ */
 
@@ -1675,6 +1728,7 @@ namespace Dune
     mutable LeafIndexSet leafIndexSet_;
     mutable GlobalIdSet globalIdSet_;
     mutable LocalIdSet localIdSet_;
+    mutable std::shared_ptr< const FaceNeighbours > faceNeighbours_;
 
     size_t nBndSegments_;
 
@@ -0,0 +1,133 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/grid/utility/PhaseStatistics.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <sys/resource.h>
+
+namespace Opm
+{
+
+void PhaseStatistics::writeJsonString(std::ostream& os, const std::string& value)
+{
+    os << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        }
+        else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+PhaseStatistics::Timer::Timer(PhaseStatistics& statistics, const std::string& name)
+    : statistics_(&statistics), name_(name), peak_rss_kb_(peakResidentSetSizeKb())
+{
+    clock_.start();
+}
+
+PhaseStatistics::Timer::~Timer()
+{
+    stop();
+}
+
+void PhaseStatistics::Timer::stop()
+{
+    if (statistics_ == nullptr) {
+        return;
+    }
+    clock_.stop();
+    auto& phase = statistics_->phase(name_);
+    ++phase.calls;
+    phase.seconds += clock_.secsSinceStart();
+    phase.peak_rss_increase_kb += peakResidentSetSizeKb() - peak_rss_kb_;
+    statistics_ = nullptr;
+}
+
+void PhaseStatistics::addCounter(const std::string& phase_name,
+                                 const std::string& counter,
+                                 std::int64_t value)
+{
+    phase(phase_name).counters[counter] += value;
+}
+
+const PhaseStatistics::Phase* PhaseStatistics::find(const std::string& name) const
+{
+    const auto it = std::ranges::find(phases_, name, &Phase::name);
+    return it == phases_.end() ? nullptr : &*it;
+}
+
+PhaseStatistics::Phase& PhaseStatistics::phase(const std::string& name)
+{
+    auto it = std::ranges::find(phases_, name, &Phase::name);
+    if (it == phases_.end()) {
+        phases_.push_back(Phase{name, 0, 0.0, 0, {}});
+        return phases_.back();
+    }
+    return *it;
+}
+
+void PhaseStatistics::writeJson(std::ostream& os) const
+{
+    os << "{\"phases\": [";
+    for (std::size_t p = 0; p < phases_.size(); ++p) {
+        const auto& phase = phases_[p];
+        os << (p == 0 ? "\n" : ",\n") << "  {\"name\": ";
+        writeJsonString(os, phase.name);
+        os << ", \"calls\": " << phase.calls
+           << ", \"seconds\": " << phase.seconds
+           << ", \"peak_rss_increase_kb\": " << phase.peak_rss_increase_kb
+           << ", \"counters\": {";
+        bool first = true;
+        for (const auto& [counter, value] : phase.counters) {
+            os << (first ? "" : ", ");
+            writeJsonString(os, counter);
+            os << ": " << value;
+            first = false;
+        }
+        os << "}}";
+    }
+    os << "\n]}\n";
+}
+
+long PhaseStatistics::peakResidentSetSizeKb()
+{
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // Reported in bytes instead of kB.
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+} // namespace Opm
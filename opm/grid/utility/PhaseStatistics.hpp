@@ -0,0 +1,118 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PHASESTATISTICS_HEADER
+#define OPM_PHASESTATISTICS_HEADER
+
+#include <opm/grid/utility/StopWatch.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+
+/// \brief Wall time, memory use and counters of named phases of a computation.
+///
+/// Phases are kept in the order in which they were first entered. A phase
+/// that is entered several times accumulates its time and counters. Phases
+/// may be nested, each phase is reported on its own. All values refer to
+/// the calling process only.
+class PhaseStatistics
+{
+public:
+    struct Phase
+    {
+        std::string name;
+        /// \brief Number of times the phase was entered.
+        int calls = 0;
+        /// \brief Accumulated wall time in seconds.
+        double seconds = 0.0;
+        /// \brief Accumulated increase of the peak resident set size in kB.
+        long peak_rss_increase_kb = 0;
+        /// \brief Accumulated counters, e.g. entity counts and message volumes.
+        std::map<std::string, std::int64_t> counters;
+    };
+
+    /// \brief Times a phase from construction until stop() or destruction.
+    class Timer
+    {
+    public:
+        Timer(PhaseStatistics& statistics, const std::string& name);
+        ~Timer();
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        /// \brief Stop the timer and record the phase. Later calls do nothing.
+        void stop();
+
+    private:
+        PhaseStatistics* statistics_;
+        std::string name_;
+        time::StopWatch clock_;
+        long peak_rss_kb_;
+    };
+
+    /// \brief Start timing a phase. It ends when the returned timer is stopped
+    ///        or destroyed.
+    [[nodiscard]] Timer time(const std::string& name)
+    {
+        return Timer(*this, name);
+    }
+
+    /// \brief Add to a counter of a phase, creating the phase if needed.
+    void addCounter(const std::string& phase, const std::string& counter, std::int64_t value);
+
+    /// \brief All phases in the order in which they were first entered.
+    const std::vector<Phase>& phases() const
+    {
+        return phases_;
+    }
+
+    /// \brief Get a phase by name, or nullptr if it was never entered.
+    const Phase* find(const std::string& name) const;
+
+    /// \brief Forget all phases.
+    void clear()
+    {
+        phases_.clear();
+    }
+
+    /// \brief Write all phases as a JSON object.
+    void writeJson(std::ostream& os) const;
+
+    /// \brief The peak resident set size of this process in kB so far.
+    static long peakResidentSetSizeKb();
+
+    /// \brief Write value as a quoted JSON string, replacing control characters by spaces.
+    static void writeJsonString(std::ostream& os, const std::string& value);
+
+private:
+    Phase& phase(const std::string& name);
+
+    std::vector<Phase> phases_;
+};
+
+} // namespace Opm
+
+#endif // OPM_PHASESTATISTICS_HEADER
@@ -7,6 +7,8 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/GridPartitioning.hpp>
+#include <opm/grid/common/CommunicationUtils.hpp>
 
 
 // Warning suppression for Dune includes.
@@ -22,7 +24,9 @@
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 #include <dune/grid/common/mcmgmapper.hh>
 
+#include <algorithm>
 #include <numeric>
+#include <set>
 
 #if defined(HAVE_ZOLTAN) && defined(HAVE_METIS)
 const int partition_methods[] = {1,2};
@@ -415,6 +419,276 @@ BOOST_AUTO_TEST_CASE(testDistributedComm)
 }
 #endif
 
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(communicationPlan)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    using AttributeSet = Dune::OwnerOverlapCopyAttributeSet::AttributeSet;
+    const auto& indexSet = grid.getCellIndexSet();
+    std::vector<int> cont(grid.size(0));
+    CopyCellValues handle(cont);
+    auto plan = grid.communicationPlan(handle, Dune::InteriorBorder_All_Interface,
+                                       Dune::ForwardCommunication);
+
+    // Repeated exchanges with the same plan give the same as communicate.
+    for (int step = 0; step < 3; ++step) {
+        std::vector<int> expected(grid.size(0));
+        for ( const auto& index: indexSet) {
+            const bool owner = index.local().attribute() == AttributeSet::owner;
+            cont[index.local()] = owner ? index.global() + step : -1;
+            expected[index.local()] = index.global() + step;
+        }
+        plan.exchange(handle);
+        BOOST_CHECK(cont == expected);
+    }
+
+    std::vector<int> reference(grid.size(0), 1);
+    CopyCellValues referenceHandle(reference);
+    grid.communicate(referenceHandle, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    std::vector<int> planned(grid.size(0), 1);
+    CopyCellValues plannedHandle(planned);
+    grid.communicationPlan(plannedHandle, Dune::InteriorBorder_All_Interface,
+                           Dune::ForwardCommunication).exchange(plannedHandle);
+    BOOST_CHECK(planned == reference);
+
+    // Plans that are active at the same time never receive each other's
+    // messages, even if the processes start them in a different order.
+    std::vector<int> first(grid.size(0), -1);
+    std::vector<int> second(grid.size(0), -1);
+    for ( const auto& index: indexSet) {
+        if (index.local().attribute() == AttributeSet::owner ) {
+            first[index.local()] = index.global();
+            second[index.local()] = -index.global() - 2;
+        }
+    }
+    CopyCellValues firstHandle(first);
+    CopyCellValues secondHandle(second);
+    auto firstPlan = grid.communicationPlan(firstHandle, Dune::InteriorBorder_All_Interface,
+                                            Dune::ForwardCommunication);
+    auto secondPlan = grid.communicationPlan(secondHandle, Dune::InteriorBorder_All_Interface,
+                                             Dune::ForwardCommunication);
+    if (grid.comm().rank() % 2 == 0) {
+        firstPlan.start(firstHandle);
+        secondPlan.start(secondHandle);
+    }
+    else {
+        secondPlan.start(secondHandle);
+        firstPlan.start(firstHandle);
+    }
+    secondPlan.finish(secondHandle);
+    firstPlan.finish(firstHandle);
+    for ( const auto& index: indexSet) {
+        BOOST_CHECK_EQUAL(first[index.local()], index.global());
+        BOOST_CHECK_EQUAL(second[index.local()], -index.global() - 2);
+    }
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(cellVectorCommunicationPlan)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    using AttributeSet = Dune::OwnerOverlapCopyAttributeSet::AttributeSet;
+    const auto& indexSet = grid.getCellIndexSet();
+    constexpr std::size_t blockSize = 2;
+    std::vector<double> values(grid.size(0) * blockSize, -1.0);
+    for ( const auto& index: indexSet) {
+        if (index.local().attribute() == AttributeSet::owner ) {
+            values[index.local() * blockSize] = index.global();
+            values[index.local() * blockSize + 1] = -index.global();
+        }
+    }
+    auto reference = values;
+
+    Dune::cpgrid::CellVectorHandle<double> handle(values, blockSize);
+    static_assert(Dune::cpgrid::ContiguousDataHandle<decltype(handle)>);
+    grid.communicationPlan(handle, Dune::InteriorBorder_All_Interface,
+                           Dune::ForwardCommunication).exchange(handle);
+
+    Dune::cpgrid::CellVectorHandle<double> referenceHandle(reference, blockSize);
+    grid.communicate(referenceHandle, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    BOOST_CHECK(values == reference);
+    for ( const auto& index: indexSet)
+        BOOST_CHECK_EQUAL(values[index.local() * blockSize + 1], -index.global());
+}
+#endif
+
+#if HAVE_MPI
+/// \brief Cell values in a contiguous array, point values through gather and scatter.
+class CellAndPointValues : public Dune::cpgrid::CellVectorHandle<double>
+{
+public:
+    CellAndPointValues(std::vector<double>& cells, std::vector<double>& points)
+        : Dune::cpgrid::CellVectorHandle<double>(cells), points_(points)
+    {}
+
+    bool contains(int dim, int codim) const
+    {
+        return dim==3 && (codim==0 || codim==3);
+    }
+
+    template<class B, class T>
+    void gather(B& buffer, const T& t) const
+    {
+        if constexpr (T::codimension == 3)
+            buffer.write(points_[t.index()]);
+        else
+            Dune::cpgrid::CellVectorHandle<double>::gather(buffer, t);
+    }
+
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t s)
+    {
+        if constexpr (T::codimension == 3)
+            buffer.read(points_[t.index()]);
+        else
+            Dune::cpgrid::CellVectorHandle<double>::scatter(buffer, t, s);
+    }
+
+private:
+    std::vector<double>& points_;
+};
+
+BOOST_AUTO_TEST_CASE(contiguousCellsWithPointsCommunicationPlan)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    const int rank = grid.comm().rank();
+    std::vector<double> cells(grid.size(0));
+    std::vector<double> points(grid.size(3));
+    for (std::size_t i = 0; i < cells.size(); ++i)
+        cells[i] = 1000.0 * rank + i;
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = -1000.0 * rank - i;
+    auto referenceCells = cells;
+    auto referencePoints = points;
+
+    CellAndPointValues handle(cells, points);
+    static_assert(Dune::cpgrid::ContiguousDataHandle<decltype(handle)>);
+    grid.communicationPlan(handle, Dune::InteriorBorder_All_Interface,
+                           Dune::ForwardCommunication).exchange(handle);
+
+    CellAndPointValues referenceHandle(referenceCells, referencePoints);
+    grid.communicate(referenceHandle, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    BOOST_CHECK(cells == referenceCells);
+    BOOST_CHECK(points == referencePoints);
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(splitPhaseCommunicate)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    using AttributeSet = Dune::OwnerOverlapCopyAttributeSet::AttributeSet;
+    const auto& indexSet = grid.getCellIndexSet();
+
+    // Repeated communications reuse the cached plan and give the same
+    // values as the blocking communicate.
+    for (int step = 0; step < 3; ++step) {
+        std::vector<int> cont(grid.size(0), -1);
+        for ( const auto& index: indexSet)
+            if (index.local().attribute() == AttributeSet::owner )
+                cont[index.local()] = index.global() + step;
+
+        auto reference = cont;
+        CopyCellValues referenceHandle(reference);
+        grid.communicate(referenceHandle, Dune::InteriorBorder_All_Interface,
+                         Dune::ForwardCommunication);
+
+        CopyCellValues handle(cont);
+        auto pending = grid.startCommunicate(handle, Dune::InteriorBorder_All_Interface,
+                                             Dune::ForwardCommunication);
+        // Owner cells are not touched while the messages are in flight.
+        int owners = 0;
+        int unchanged = 0;
+        for ( const auto& index: indexSet) {
+            if (index.local().attribute() == AttributeSet::owner ) {
+                ++owners;
+                unchanged += cont[index.local()] == index.global() + step;
+            }
+        }
+        BOOST_CHECK_EQUAL(unchanged, owners);
+        grid.finishCommunicate(pending);
+        BOOST_CHECK(pending.finished());
+
+        BOOST_CHECK(cont == reference);
+        for ( const auto& index: indexSet)
+            BOOST_CHECK_EQUAL(cont[index.local()], index.global() + step);
+    }
+
+    // Communications of the same kind that are active at the same time get
+    // their own plans.
+    std::vector<int> first(grid.size(0), -1);
+    std::vector<int> second(grid.size(0), -1);
+    for ( const auto& index: indexSet) {
+        if (index.local().attribute() == AttributeSet::owner ) {
+            first[index.local()] = index.global();
+            second[index.local()] = -index.global() - 2;
+        }
+    }
+    CopyCellValues firstHandle(first);
+    CopyCellValues secondHandle(second);
+    auto firstPending = grid.startCommunicate(firstHandle, Dune::InteriorBorder_All_Interface,
+                                              Dune::ForwardCommunication);
+    auto secondPending = grid.startCommunicate(secondHandle, Dune::InteriorBorder_All_Interface,
+                                               Dune::ForwardCommunication);
+    grid.finishCommunicate(secondPending);
+    grid.finishCommunicate(firstPending);
+    for ( const auto& index: indexSet) {
+        BOOST_CHECK_EQUAL(first[index.local()], index.global());
+        BOOST_CHECK_EQUAL(second[index.local()], -index.global() - 2);
+    }
+
+    // Data with a different number of items per cell gets its own plan.
+    std::vector<double> single(grid.size(0), -1.0);
+    std::vector<double> triple(3 * grid.size(0), -1.0);
+    for ( const auto& index: indexSet) {
+        if (index.local().attribute() == AttributeSet::owner ) {
+            single[index.local()] = index.global();
+            for (int i = 0; i < 3; ++i)
+                triple[3 * index.local() + i] = index.global() + 0.5 * i;
+        }
+    }
+    auto referenceTriple = triple;
+    Dune::cpgrid::CellVectorHandle<double> referenceTripleHandle(referenceTriple, 3);
+    grid.communicate(referenceTripleHandle, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    Dune::cpgrid::CellVectorHandle<double> singleHandle(single);
+    Dune::cpgrid::CellVectorHandle<double> tripleHandle(triple, 3);
+    auto singlePending = grid.startCommunicate(singleHandle, Dune::InteriorBorder_All_Interface,
+                                               Dune::ForwardCommunication);
+    auto triplePending = grid.startCommunicate(tripleHandle, Dune::InteriorBorder_All_Interface,
+                                               Dune::ForwardCommunication);
+    grid.finishCommunicate(singlePending);
+    grid.finishCommunicate(triplePending);
+    BOOST_CHECK(triple == referenceTriple);
+    for ( const auto& index: indexSet)
+        BOOST_CHECK_EQUAL(single[index.local()], index.global());
+}
+#endif
+
 #if HAVE_MPI
 BOOST_AUTO_TEST_CASE(compareWithSequential)
 {
@@ -510,7 +784,271 @@ BOOST_AUTO_TEST_CASE(compareWithSequential)
         }
     }
 }
+
+/// \brief A data handle that sends the global ids of the corners of
+/// interior cells and counts the mismatches at the receiving end.
+class CornerIdCheckHandle
+{
+public:
+    CornerIdCheckHandle(const Dune::CpGrid::GlobalIdSet& gid_set, int& mismatches)
+        : gid_set_(gid_set), mismatches_(mismatches)
+    {}
+    typedef int DataType;
+    bool fixedSize(int, int)
+    {
+        return true;
+    }
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 8;
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        for (int corner = 0; corner < 8; ++corner)
+            buffer.write(gid_set_.subId(t, corner, 3));
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t)
+    {
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            int gid;
+            buffer.read(gid);
+            mismatches_ += (gid != gid_set_.subId(t, corner, 3));
+        }
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim==3 && codim==0;
+    }
+private:
+    const Dune::CpGrid::GlobalIdSet& gid_set_;
+    int& mismatches_;
+};
+
+BOOST_AUTO_TEST_CASE(distributeFromPillarSlabs)
+{
+    Dune::CpGrid grid;
+    Dune::CpGrid seqGrid(MPI_COMM_SELF);
+    if (grid.comm().size() == 1)
+        return;
+
+    // Vertical pillars with faults in both directions and some inactive cells.
+    const std::array<int, 3> dims = {{ 7, 4 * grid.comm().size() + 1, 5 }};
+    const auto [nx, ny, nz] = dims;
+    std::vector<double> coord;
+    for (int j = 0; j <= ny; ++j)
+        for (int i = 0; i <= nx; ++i)
+            coord.insert(coord.end(), { 1.0*i, 1.0*j, 0.0, 1.0*i, 1.0*j, 100.0 });
+    std::vector<double> zcorn(8 * nx * ny * nz);
+    for (int j = 0; j < 2 * ny; ++j)
+        for (int i = 0; i < 2 * nx; ++i)
+        {
+            double z = ((i / 2 >= nx / 2) ? 0.5 + 0.1 * (j % 3) : 0.0) + 0.05 * ((i + j) % 2);
+            for (int k = 0; k < nz; ++k)
+            {
+                zcorn[i + 2*nx*(j + 2*ny*(2*k))] = z;
+                z += 1.0 + 0.25 * ((i / 2 + j / 2 + k) % 3);
+                zcorn[i + 2*nx*(j + 2*ny*(2*k + 1))] = z;
+            }
+        }
+    std::vector<int> actnum(nx * ny * nz, 1);
+    for (std::size_t c = 0; c < actnum.size(); c += 11)
+        actnum[c] = 0;
+
+    grdecl global;
+    std::copy(dims.begin(), dims.end(), global.dims);
+    global.coord = coord.data();
+    global.zcorn = zcorn.data();
+    global.actnum = actnum.data();
+    seqGrid.processEclipseFormat(global, false);
+
+    const auto slab = Dune::cpgrid::partitionPillarSlabs(dims, grid.comm().rank(), grid.comm().size());
+    std::vector<double> slabCoord, slabZcorn;
+    std::vector<int> slabActnum;
+    grdecl slabData;
+    Dune::cpgrid::extractPillarSlab(global, slab, slabCoord, slabZcorn, slabActnum, slabData);
+    grid.processDistributedEclipseFormat(slabData, slab);
+
+    BOOST_REQUIRE(grid.logicalCartesianSize() == seqGrid.logicalCartesianSize());
+
+    const auto& idSet = grid.globalIdSet();
+    const auto& gc = grid.globalCell();
+    const auto& seqGc = seqGrid.globalCell();
+    const auto& seqGridView = seqGrid.leafGridView();
+    int interior{};
+    for (const auto& element : elements(grid.leafGridView()))
+    {
+        // Cell ids are the indices of the sequential grid.
+        const auto id = idSet.id(element);
+        BOOST_REQUIRE(id >= 0 && id < seqGrid.size(0));
+        BOOST_REQUIRE(gc[element.index()] == seqGc[id]);
+
+        const int row = (gc[element.index()] / nx) % ny;
+        const bool owned = row >= slab.owned[0] && row < slab.owned[1];
+        BOOST_REQUIRE((element.partitionType() == Dune::InteriorEntity) == owned);
+        if (!owned)
+            continue;
+        ++interior;
+
+        const auto seqElement = Dune::createEntity<0>(seqGrid, id, true);
+        BOOST_CHECK_CLOSE(element.geometry().volume(), seqElement.geometry().volume(), 1e-10);
+        for (int d = 0; d < 3; ++d)
+            BOOST_CHECK_CLOSE(element.geometry().center()[d], seqElement.geometry().center()[d], 1e-10);
+        int neighbors{};
+        for (const auto& intersection : intersections(grid.leafGridView(), element))
+            neighbors += intersection.neighbor();
+        int seqNeighbors{};
+        for (const auto& intersection : intersections(seqGridView, seqElement))
+            seqNeighbors += intersection.neighbor();
+        BOOST_CHECK_EQUAL(neighbors, seqNeighbors);
+    }
+    BOOST_REQUIRE(grid.comm().sum(interior) == seqGrid.size(0));
+
+    // All processes agree on the ids of the corners they share.
+    int mismatches{};
+    CornerIdCheckHandle handle(idSet, mismatches);
+    grid.communicate(handle, Dune::InteriorBorder_All_Interface, Dune::ForwardCommunication);
+    BOOST_REQUIRE(mismatches == 0);
+}
 #endif
+
+BOOST_AUTO_TEST_CASE(overlapCells)
+{
+    // The overlap is computed on the global grid, hence no communication is needed.
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    std::array<int, 3> dims = {{7, 5, 1}};
+    std::array<double, 3> sizes = {{ 1.0, 1.0, 1.0}};
+    std::vector<int> parts = { 0, 1, 1, 0, 0, 0, 0,
+                               0, 1, 1, 0, 0, 0, 0,
+                               0, 0, 0, 0, 0, 0, 0,
+                               0, 0, 0, 0, 0, 0, 0,
+                               0, 0, 0, 0, 0, 0, 0 };
+    grid.createCartesian(dims, sizes);
+
+    auto overlapOf = [](const std::vector<std::pair<int,int>>& overlap, int part)
+    {
+        std::vector<int> cells;
+        for (const auto& [cell, p] : overlap)
+            if (p == part)
+                cells.push_back(cell);
+        return cells;
+    };
+
+    const auto noCorners = Dune::computeOverlapCells(grid, parts, false, nullptr);
+    BOOST_CHECK(std::is_sorted(noCorners.begin(), noCorners.end()));
+    BOOST_CHECK(std::adjacent_find(noCorners.begin(), noCorners.end()) == noCorners.end());
+    BOOST_CHECK(overlapOf(noCorners, 0) == std::vector<int>({1, 2, 8, 9}));
+    BOOST_CHECK(overlapOf(noCorners, 1) == std::vector<int>({0, 3, 7, 10, 15, 16}));
+
+    const auto corners = Dune::computeOverlapCells(grid, parts, true, nullptr);
+    BOOST_CHECK(overlapOf(corners, 0) == std::vector<int>({1, 2, 8, 9}));
+    BOOST_CHECK(overlapOf(corners, 1) == std::vector<int>({0, 3, 7, 10, 14, 15, 16, 17}));
+
+    const auto twoLayers = Dune::computeOverlapCells(grid, parts, false, nullptr, 2);
+    BOOST_CHECK(overlapOf(twoLayers, 0) == std::vector<int>({1, 2, 8, 9}));
+    BOOST_CHECK(overlapOf(twoLayers, 1) == std::vector<int>({0, 3, 4, 7, 10, 11, 14, 15, 16, 17, 22, 23}));
+
+    // Without transmissibility between the partitions there is no overlap.
+    std::vector<double> trans(grid.numFaces(), 1.0);
+    for (const auto& element : Dune::elements(grid.leafGridView())) {
+        for (const auto& intersection : Dune::intersections(grid.leafGridView(), element)) {
+            if (intersection.neighbor()
+                && parts[intersection.inside().index()] != parts[intersection.outside().index()])
+                trans[intersection.id()] = 0.0;
+        }
+    }
+    BOOST_CHECK(Dune::computeOverlapCells(grid, parts, false, trans.data()).empty());
+    BOOST_CHECK(Dune::computeOverlapCells(grid, parts, true, trans.data(), 2).empty());
+
+    std::vector<std::set<int>> cell_overlap;
+    Dune::addOverlapLayer(grid, parts, cell_overlap, 1, 1);
+    for (const int cell : overlapOf(corners, 1))
+        BOOST_CHECK(cell_overlap[cell] == std::set<int>{1});
+}
+
+BOOST_AUTO_TEST_CASE(distributedOverlapCells)
+{
+    // Every rank grows the overlap of its own partition on the distributed
+    // view. The result has to be the same as the one computed on the global
+    // grid.
+    Dune::CpGrid grid;
+    std::array<int, 3> dims = {{9, 7, 2}};
+    std::array<double, 3> sizes = {{ 1.0, 1.0, 1.0}};
+    grid.createCartesian(dims, sizes);
+    const auto& cc = grid.comm();
+
+    // Stripes that are only a cell wide make the layers cross several partitions.
+    std::vector<int> parts(grid.size(0));
+    for (const auto& element : Dune::elements(grid.leafGridView())) {
+        const auto& center = element.geometry().center();
+        parts[element.index()] = (int(center[0]) + 2 * int(center[1])) % cc.size();
+    }
+    std::vector<double> trans(grid.numFaces(), 1.0);
+    for (std::size_t face = 0; face < trans.size(); face += 3)
+        trans[face] = 0.0;
+
+    std::vector<std::pair<int,int>> expectedLoadBalanced;
+    if (cc.rank() == 0)
+        expectedLoadBalanced = Dune::computeOverlapCells(grid, parts, false, nullptr);
+    std::vector<std::vector<std::pair<int,int>>> expected;
+    for (const bool withTrans : { false, true })
+        for (const bool corners : { false, true })
+            for (const int layers : { 1, 2, 3 })
+                expected.push_back(cc.rank() == 0
+                                   ? Dune::computeOverlapCells(grid, parts, corners,
+                                                               withTrans ? trans.data() : nullptr, layers)
+                                   : std::vector<std::pair<int,int>>());
+
+    grid.loadBalance(parts);
+
+    // Pairs of global id and rank of the cells stored as overlap, gathered on rank 0.
+    auto gatherOverlap = [&cc](std::vector<std::pair<int,int>> overlap)
+    {
+        std::tie(overlap, std::ignore) = Opm::gatherv(overlap, cc, 0);
+        std::sort(overlap.begin(), overlap.end());
+        return overlap;
+    };
+
+    const auto& view = grid.currentLeafData();
+    const auto& ids = view.globalIdSet();
+    std::vector<std::pair<int,int>> copies;
+    for (const auto& element : Dune::elements(grid.leafGridView(), Dune::Partitions::overlap))
+        copies.emplace_back(ids.id(element), cc.rank());
+    const auto loadBalanced = gatherOverlap(copies);
+    if (cc.rank() == 0)
+        BOOST_CHECK(loadBalanced == expectedLoadBalanced);
+
+    // The transmissibilities of the faces of the view, given by their global ids.
+    std::vector<double> localTrans(view.numFaces());
+    for (int face = 0; face < view.numFaces(); ++face)
+        localTrans[face] = ids.idLevelZero(Dune::cpgrid::EntityRep<1>(face, true)) % 3 == 0 ? 0.0 : 1.0;
+
+    auto expectedOverlap = expected.begin();
+    for (const double* faceTrans : { static_cast<const double*>(nullptr), localTrans.data() }) {
+        for (const bool corners : { false, true }) {
+            for (const int layers : { 1, 2, 3 }) {
+                const auto processes = Dune::computeDistributedOverlapProcesses(view, cc, corners,
+                                                                                faceTrans, layers);
+                std::vector<std::pair<int,int>> overlap;
+                for (const auto& element : Dune::elements(grid.leafGridView(), Dune::Partitions::interior)) {
+                    BOOST_CHECK(std::is_sorted(processes[element.index()].begin(),
+                                               processes[element.index()].end()));
+                    for (const int proc : processes[element.index()])
+                        if (proc != cc.rank())
+                            overlap.emplace_back(ids.id(element), proc);
+                }
+                overlap = gatherOverlap(overlap);
+                if (cc.rank() == 0)
+                    BOOST_CHECK(overlap == *expectedOverlap);
+                ++expectedOverlap;
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(PartitionTest)
 {
 #if HAVE_MPI
@@ -1003,6 +1541,147 @@ for (auto partition_method : partition_methods) {
 }
 }
 
+/// \brief A data handle that moves the global id of each cell when repartitioning.
+class RepartitionGlobalIdDataHandle
+{
+public:
+    RepartitionGlobalIdDataHandle(const Dune::CpGrid& grid, std::vector<int>& cell_ids)
+        : grid_(grid), cell_ids_(cell_ids)
+    {}
+
+    typedef int DataType;
+
+    bool fixedSize(int /*dim*/, int /*codim*/)
+    {
+        return true;
+    }
+
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 1;
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        buffer.write(grid_.globalIdSet().id(t));
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t)
+    {
+        int gid;
+        buffer.read(gid);
+        cell_ids_[grid_.leafIndexSet().index(t)] = gid;
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim==3 && codim==0;
+    }
+private:
+    const Dune::CpGrid& grid_;
+    std::vector<int>& cell_ids_;
+};
+
+BOOST_AUTO_TEST_CASE(repartition)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+
+    if (grid.comm().size()==1)
+    {
+        return;
+    }
+
+    grid.loadBalance(1, 0);
+
+    // Make the cells owned by rank 0 ten times more expensive.
+    auto countOwned = [&grid]() {
+        int owned = 0;
+        for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior)) {
+            static_cast<void>(element);
+            ++owned;
+        }
+        return owned;
+    };
+    const int owned_before = countOwned();
+    std::vector<double> weights(grid.size(0), grid.comm().rank() == 0 ? 10.0 : 1.0);
+
+    // Large enough for any distribution of the cells.
+    std::vector<int> cell_ids(8*4*2, -1);
+    RepartitionGlobalIdDataHandle handle(grid, cell_ids);
+    BOOST_REQUIRE(grid.repartition(handle, weights));
+
+    const int owned_after = countOwned();
+    if (grid.comm().rank() == 0) {
+        BOOST_CHECK_LT(owned_after, owned_before);
+    }
+    BOOST_CHECK_EQUAL(grid.comm().sum(owned_after), 8*4*2);
+    BOOST_CHECK(grid.phaseStatistics().find("repartition") != nullptr);
+
+    // Each cell received the data of the same cell of the old distribution.
+    const auto& gid_set = grid.globalIdSet();
+    for (const auto& element : elements(grid.leafGridView())) {
+        BOOST_CHECK_EQUAL(cell_ids[grid.leafIndexSet().index(element)], gid_set.id(element));
+    }
+
+    // The scatter/gather interface matches the new distribution.
+    auto global_grid = grid;
+    global_grid.switchToGlobalView();
+    auto scatter_handle = CheckGlobalCellHandle(global_grid.globalCell(),
+                                                grid.globalCell());
+#if HAVE_MPI
+    Dune::VariableSizeCommunicator<> scatter_gather_comm(grid.comm(), grid.cellScatterGatherInterface(), 8*4*2*8);
+    scatter_gather_comm.forward(scatter_handle);
+#else
+    (void) scatter_handle;
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(repartitionKeepsProcessesNonEmpty)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+
+    if (grid.comm().size()==1)
+    {
+        return;
+    }
+
+    grid.loadBalance(1, 0);
+
+    // Rank 1 is so expensive that it hands away most of its cells.
+    std::vector<double> weights(grid.size(0), grid.comm().rank() == 1 ? 1000.0 : 1.0);
+    BOOST_REQUIRE(grid.repartition(weights, 1.1, false, /* addCornerCells = */ true,
+                                   /* overlapLayers = */ 2));
+
+    int owned = 0;
+    const auto& gv = grid.leafGridView();
+    for (const auto& element : elements(gv, Dune::Partitions::interior)) {
+        ++owned;
+        // The overlap contains all neighbours of owned cells.
+        for (const auto& intersection : intersections(gv, element)) {
+            BOOST_CHECK(intersection.boundary() || intersection.neighbor());
+        }
+    }
+    BOOST_CHECK_GT(owned, 0);
+    BOOST_CHECK_EQUAL(grid.comm().sum(owned), 8*4*2);
+
+    // The second layer also contains all neighbours of the first one.
+    for (const auto& element : elements(gv, Dune::Partitions::interior)) {
+        for (const auto& intersection : intersections(gv, element)) {
+            if (intersection.neighbor()) {
+                for (const auto& nb_intersection : intersections(gv, intersection.outside())) {
+                    BOOST_CHECK(nb_intersection.boundary() || nb_intersection.neighbor());
+                }
+            }
+        }
+    }
+}
+
 bool
 init_unit_test_func()
 {
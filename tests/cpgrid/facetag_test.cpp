@@ -28,6 +28,7 @@
 #include <opm/grid/CpGrid.hpp>
 #include <opm/grid/cpgrid/GridHelpers.hpp>
 
+#include <algorithm>
 #include <array>
 
 BOOST_AUTO_TEST_CASE(facetag)
@@ -93,6 +94,49 @@ BOOST_AUTO_TEST_CASE(facetag)
     }
 }
 
+BOOST_AUTO_TEST_CASE(faceneighbours)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3>    dims     = { 3, 3, 3 };
+    std::array<double, 3> cellsize = { 1., 1., 1. };
+    grid.createCartesian(dims, cellsize);
+    if (grid.numCells() == 0) {
+        return; // the Cartesian grid only exists on rank 0
+    }
+
+    const auto neighbours = grid.faceNeighbours();
+    BOOST_CHECK(neighbours == grid.faceNeighbours());
+    BOOST_REQUIRE_EQUAL(neighbours->numInteriorFaces(), 3 * 2 * 3 * 3);
+    BOOST_REQUIRE_EQUAL(neighbours->numCells(), grid.numCells());
+
+    for (int i = 0; i < neighbours->numInteriorFaces(); ++i) {
+        const int face = neighbours->faces[i];
+        const auto& cells = neighbours->cells[i];
+        BOOST_CHECK(cells[0] < cells[1]);
+        const int c0 = grid.faceCell(face, 0);
+        const int c1 = grid.faceCell(face, 1);
+        BOOST_CHECK(std::min(c0, c1) == cells[0] && std::max(c0, c1) == cells[1]);
+        BOOST_CHECK_EQUAL(neighbours->orientations[i] != 0, c0 == cells[0]);
+
+        std::array<int, 3> ijk0, ijk1;
+        grid.getIJK(cells[0], ijk0);
+        grid.getIJK(cells[1], ijk1);
+        for (int dim = 0; dim < 3; ++dim) {
+            if (ijk0[dim] != ijk1[dim]) {
+                BOOST_CHECK_EQUAL(neighbours->tags[i], dim);
+            }
+        }
+    }
+
+    for (int cell = 0; cell < grid.numCells(); ++cell) {
+        const int begin = neighbours->cell_face_offsets[cell];
+        BOOST_REQUIRE_EQUAL(neighbours->cell_face_offsets[cell + 1] - begin, grid.numCellFaces(cell));
+        for (int i = 0; i < grid.numCellFaces(cell); ++i) {
+            BOOST_CHECK_EQUAL(neighbours->cell_faces[begin + i], grid.cellFace(cell, i));
+        }
+    }
+}
+
 bool
 init_unit_test_func()
 {
@@ -35,6 +35,10 @@
 #include <opm/grid/utility/OpmLog.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
 
 struct Fixture
 {
@@ -571,3 +575,121 @@ BOOST_AUTO_TEST_CASE(refine_distorted_cube)
     refine_and_check(g, {2, 3, 4});
 
 }
+
+BOOST_AUTO_TEST_CASE(geometry_arrays)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({3, 2, 4}, {1.0, 2.0, 0.5});
+
+    const auto& arrays = grid.geometryArrays();
+    BOOST_REQUIRE_EQUAL(arrays.numCells(), grid.numCells());
+    BOOST_REQUIRE_EQUAL(arrays.numFaces(), grid.numFaces());
+    for (int c = 0; c < grid.numCells(); ++c) {
+        const auto& center = grid.cellCentroid(c);
+        BOOST_CHECK_EQUAL(arrays.cell_volume[c], grid.cellVolume(c));
+        BOOST_CHECK_EQUAL(arrays.cell_centroid_x[c], center[0]);
+        BOOST_CHECK_EQUAL(arrays.cell_centroid_y[c], center[1]);
+        BOOST_CHECK_EQUAL(arrays.cell_centroid_z[c], center[2]);
+    }
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        const auto& center = grid.faceCentroid(f);
+        const auto& normal = grid.faceNormal(f);
+        BOOST_CHECK_EQUAL(arrays.face_area[f], grid.faceArea(f));
+        BOOST_CHECK_EQUAL(arrays.face_centroid_x[f], center[0]);
+        BOOST_CHECK_EQUAL(arrays.face_centroid_y[f], center[1]);
+        BOOST_CHECK_EQUAL(arrays.face_centroid_z[f], center[2]);
+        BOOST_CHECK_EQUAL(arrays.face_normal_x[f], normal[0]);
+        BOOST_CHECK_EQUAL(arrays.face_normal_y[f], normal[1]);
+        BOOST_CHECK_EQUAL(arrays.face_normal_z[f], normal[2]);
+    }
+    // later calls return the same arrays
+    BOOST_CHECK_EQUAL(&grid.geometryArrays(), &arrays);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_round_trip)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({3, 2, 4}, {1.0, 2.0, 0.5});
+    const std::string filename = "geometry_test_snapshot.bin";
+    grid.writeSnapshot(filename);
+
+    Dune::CpGrid reloaded;
+    reloaded.readSnapshot(filename);
+    if (Fixture::rank() == 0) {
+        std::remove(filename.c_str());
+    }
+
+    BOOST_CHECK(reloaded.logicalCartesianSize() == grid.logicalCartesianSize());
+    BOOST_CHECK(reloaded.globalCell() == grid.globalCell());
+    BOOST_REQUIRE_EQUAL(reloaded.numCells(), grid.numCells());
+    BOOST_REQUIRE_EQUAL(reloaded.numFaces(), grid.numFaces());
+    BOOST_REQUIRE_EQUAL(reloaded.numVertices(), grid.numVertices());
+    for (int v = 0; v < grid.numVertices(); ++v) {
+        BOOST_CHECK(reloaded.vertexPosition(v) == grid.vertexPosition(v));
+    }
+    for (int c = 0; c < grid.numCells(); ++c) {
+        BOOST_CHECK_EQUAL(reloaded.cellVolume(c), grid.cellVolume(c));
+        BOOST_CHECK(reloaded.cellCentroid(c) == grid.cellCentroid(c));
+        BOOST_REQUIRE_EQUAL(reloaded.numCellFaces(c), grid.numCellFaces(c));
+        for (int i = 0; i < grid.numCellFaces(c); ++i) {
+            BOOST_CHECK_EQUAL(reloaded.cellFace(c, i), grid.cellFace(c, i));
+        }
+    }
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        BOOST_CHECK_EQUAL(reloaded.faceArea(f), grid.faceArea(f));
+        BOOST_CHECK(reloaded.faceCentroid(f) == grid.faceCentroid(f));
+        BOOST_CHECK(reloaded.faceNormal(f) == grid.faceNormal(f));
+        BOOST_CHECK_EQUAL(reloaded.faceCell(f, 0), grid.faceCell(f, 0));
+        BOOST_CHECK_EQUAL(reloaded.faceCell(f, 1), grid.faceCell(f, 1));
+        BOOST_CHECK_EQUAL(reloaded.boundaryId(f), grid.boundaryId(f));
+        BOOST_REQUIRE_EQUAL(reloaded.numFaceVertices(f), grid.numFaceVertices(f));
+        for (int i = 0; i < grid.numFaceVertices(f); ++i) {
+            BOOST_CHECK_EQUAL(reloaded.faceVertex(f, i), grid.faceVertex(f, i));
+        }
+    }
+    const auto faces = grid.faceNeighbours();
+    const auto reloaded_faces = reloaded.faceNeighbours();
+    BOOST_CHECK(reloaded_faces->tags == faces->tags);
+
+    // The corners of the cell geometries refer to the reloaded points.
+    const auto& view = grid.leafGridView();
+    const auto& reloaded_view = reloaded.leafGridView();
+    auto it = reloaded_view.begin<0>();
+    for (const auto& element : elements(view)) {
+        const auto geom = element.geometry();
+        const auto reloaded_geom = it->geometry();
+        for (int i = 0; i < geom.corners(); ++i) {
+            BOOST_CHECK(reloaded_geom.corner(i) == geom.corner(i));
+        }
+        ++it;
+    }
+
+    BOOST_CHECK_THROW(reloaded.readSnapshot("does_not_exist.bin"), std::runtime_error);
+
+    // A face cell out of range is rejected before the grid is modified.
+    if (Fixture::rank() == 0) {
+        grid.writeSnapshot(filename);
+        std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+        // Skip the header (32 bytes) and the two cell-face sections to get to the face cells.
+        std::streamoff pos = 32;
+        for (int section = 0; section < 2; ++section) {
+            std::uint64_t section_header[2];
+            file.seekg(pos);
+            file.read(reinterpret_cast<char*>(section_header), sizeof(section_header));
+            const std::uint64_t bytes = section_header[0] * section_header[1];
+            pos += sizeof(section_header) + bytes + (8 - bytes % 8) % 8;
+        }
+        const int invalid_cell = grid.numCells() + 5;
+        file.seekp(pos + 2 * sizeof(std::uint64_t));
+        file.write(reinterpret_cast<const char*>(&invalid_cell), sizeof(invalid_cell));
+    }
+    BOOST_CHECK_THROW(reloaded.readSnapshot(filename), std::runtime_error);
+    if (Fixture::rank() == 0) {
+        std::remove(filename.c_str());
+        BOOST_CHECK_EQUAL(reloaded.numCells(), grid.numCells());
+        BOOST_CHECK_EQUAL(reloaded.numFaces(), grid.numFaces());
+        for (int f = 0; f < grid.numFaces(); ++f) {
+            BOOST_CHECK_EQUAL(reloaded.faceCell(f, 0), grid.faceCell(f, 0));
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE ImplicitRefinedLevelTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/ImplicitRefinedLevel.hpp>
+#include <opm/grid/utility/OpmLog.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+        Opm::OpmLog::setupSimpleDefaultLogging();
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+// Compare the implicitly stored refinement with the explicit refined level grid built by autoRefine().
+void checkImplicitAgainstAutoRefine(Dune::CpGrid& grid, const std::array<int,3>& nxnynz)
+{
+    const auto implicitLevel = grid.autoRefineImplicitly(nxnynz);
+    grid.autoRefine(nxnynz);
+
+    const auto& levelOne = grid.levelGridView(1);
+    BOOST_CHECK_EQUAL(implicitLevel.size(), levelOne.size(0));
+
+    const auto implicitIndex = [&implicitLevel](const Dune::cpgrid::Entity<0>& element) {
+        return implicitLevel.refinedCell(element.father().index(), element.getIdxInParentCell());
+    };
+
+    for (const auto& element : Dune::elements(levelOne)) {
+        const int cell = implicitIndex(element);
+        BOOST_CHECK_EQUAL(implicitLevel.parentCell(cell), element.father().index());
+        BOOST_CHECK_EQUAL(implicitLevel.idxInParentCell(cell), element.getIdxInParentCell());
+
+        const auto& geometry = element.geometry();
+        const auto& corners = implicitLevel.corners(cell);
+        for (int corn = 0; corn < 8; ++corn) {
+            for (int c = 0; c < 3; ++c) {
+                BOOST_CHECK_SMALL(corners[corn][c] - geometry.corner(corn)[c], 1e-12);
+            }
+        }
+        const auto& center = implicitLevel.center(cell);
+        for (int c = 0; c < 3; ++c) {
+            BOOST_CHECK_SMALL(center[c] - geometry.center()[c], 1e-12);
+        }
+        BOOST_CHECK_CLOSE(implicitLevel.volume(cell), geometry.volume(), 1e-10);
+
+        std::vector<int> expectedNeighbors;
+        for (const auto& intersection : Dune::intersections(levelOne, element)) {
+            if (intersection.neighbor()) {
+                expectedNeighbors.push_back(implicitIndex(intersection.outside()));
+            }
+        }
+        std::vector<int> neighbors;
+        for (const auto& nb : implicitLevel.neighbors(cell)) {
+            if (nb != -1) {
+                neighbors.push_back(nb);
+            }
+        }
+        std::sort(expectedNeighbors.begin(), expectedNeighbors.end());
+        std::sort(neighbors.begin(), neighbors.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(neighbors.begin(), neighbors.end(),
+                                      expectedNeighbors.begin(), expectedNeighbors.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(implicitRefinementMatchesAutoRefine)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {4,3,3}, /* cell_sizes = */ {1.0, 1.0, 1.0});
+
+    if (grid.comm().size()>1) { // distribute level zero grid, in parallel
+        grid.loadBalance();
+    }
+
+    checkImplicitAgainstAutoRefine(grid, /* nxnynz = */ {3,5,7});
+}
+
+BOOST_AUTO_TEST_CASE(implicitRefinementOfNonCubicCellsMatchesAutoRefine)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {3,2,4}, /* cell_sizes = */ {2.0, 0.5, 3.0});
+
+    if (grid.comm().size()>1) { // distribute level zero grid, in parallel
+        grid.loadBalance();
+    }
+
+    checkImplicitAgainstAutoRefine(grid, /* nxnynz = */ {3,1,3});
+}
+
+BOOST_AUTO_TEST_CASE(invalidRefinementFactorThrows)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {4,3,3}, /* cell_sizes = */ {1.0, 1.0, 1.0});
+
+    BOOST_CHECK_THROW(grid.autoRefineImplicitly(/* nxnynz = */ {4,3,5}), std::invalid_argument);
+    BOOST_CHECK_THROW(grid.autoRefineImplicitly(/* nxnynz = */ {3,0,5}), std::invalid_argument);
+    BOOST_CHECK_THROW(grid.autoRefineImplicitly(/* nxnynz = */ {3,5,-3}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(implicitRefinementOfRefinedGridThrows)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {4,3,3}, /* cell_sizes = */ {1.0, 1.0, 1.0});
+    grid.autoRefine(/* nxnynz = */ {3,3,1});
+
+    BOOST_CHECK_THROW(grid.autoRefineImplicitly(/* nxnynz = */ {3,3,3}), std::logic_error);
+}
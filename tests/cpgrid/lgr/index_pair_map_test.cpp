@@ -0,0 +1,89 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE IndexPairMapTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/cpgrid/IndexPairMap.hpp>
+#include <opm/grid/cpgrid/LgrHelpers.hpp>
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(insertFindAndOverwrite)
+{
+    Opm::Lgr::IndexPairMap<int> map;
+    BOOST_CHECK(map.empty());
+
+    // Entities not involved in any refinement have first index -1.
+    map[{-1, 4}] = 40;
+    map.insert_or_assign({7, 0}, 70);
+    map.insert_or_assign({7, 2}, 72);
+    BOOST_CHECK_EQUAL(map.size(), 3);
+
+    BOOST_CHECK_EQUAL(map.at({-1, 4}), 40);
+    BOOST_CHECK_EQUAL(map.at({7, 2}), 72);
+    BOOST_REQUIRE(map.find({7, 0}));
+    BOOST_CHECK_EQUAL(*map.find({7, 0}), 70);
+
+    // Gaps within a row, unused rows and negative or large indices are missing.
+    BOOST_CHECK(!map.contains({7, 1}));
+    BOOST_CHECK(!map.contains({7, 3}));
+    BOOST_CHECK(!map.contains({3, 0}));
+    BOOST_CHECK(!map.contains({-1, 0}));
+    BOOST_CHECK(!map.contains({100, 0}));
+    BOOST_CHECK(!map.contains({-2, 0}));
+    BOOST_CHECK_THROW(map.at({7, 1}), std::out_of_range);
+
+    // Overwriting does not add a key.
+    map.insert_or_assign({7, 2}, 27);
+    BOOST_CHECK_EQUAL(map.at({7, 2}), 27);
+    BOOST_CHECK_EQUAL(map.size(), 3);
+
+    map.reserve(9, 8);
+    BOOST_CHECK(!map.contains({9, 0}));
+    BOOST_CHECK_EQUAL(map.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(insertBidirectionalWithCounter)
+{
+    Opm::Lgr::IndexPairMap<int> elem_to_adapted;
+    std::vector<std::array<int,2>> adapted_to_elem;
+    int adapted_count = 0;
+    Opm::Lgr::insertBidirectional(elem_to_adapted, adapted_to_elem, {-1, 3}, adapted_count);
+    Opm::Lgr::insertBidirectional(elem_to_adapted, adapted_to_elem, {5, 0}, adapted_count);
+    BOOST_CHECK_EQUAL(adapted_count, 2);
+    BOOST_CHECK_EQUAL(elem_to_adapted.at({-1, 3}), 0);
+    BOOST_CHECK_EQUAL(elem_to_adapted.at({5, 0}), 1);
+    BOOST_REQUIRE_EQUAL(adapted_to_elem.size(), 2);
+    BOOST_CHECK((adapted_to_elem[1] == std::array{5, 0}));
+
+    Opm::Lgr::IndexPairMap<std::array<int,2>> elem_to_refined;
+    Opm::Lgr::IndexPairMap<std::array<int,2>> refined_to_elem;
+    int refined_count = 0;
+    const int level = 1;
+    for (int cell = 0; cell < 8; ++cell) {
+        Opm::Lgr::insertBidirectional(elem_to_refined, refined_to_elem, {5, cell}, level, refined_count);
+    }
+    BOOST_CHECK_EQUAL(refined_count, 8);
+    BOOST_CHECK((elem_to_refined.at({5, 6}) == std::array{level, 6}));
+    BOOST_CHECK((refined_to_elem.at({level, 6}) == std::array{5, 6}));
+}
@@ -110,6 +110,34 @@ void checkGlobalCellLgr(Dune::CpGrid& grid)
             }
         }
     }
+
+    // Dense maps cached in LevelCartesianIndexMapper agree with the maps above.
+    BOOST_CHECK(levelCartMapp.leafToLevelCartesianIndex() == leafIdx_to_localCartesianIdxSets);
+    for (int level = 0; level <= grid.maxLevel(); ++level)
+    {
+        const auto& cartesianToCompressed = levelCartMapp.cartesianToCompressed(level);
+        const auto& cartesianToLeaf = levelCartMapp.cartesianToLeaf(level);
+        BOOST_REQUIRE_EQUAL(static_cast<int>(cartesianToCompressed.size()), levelCartMapp.cartesianSize(level));
+        BOOST_REQUIRE_EQUAL(static_cast<int>(cartesianToLeaf.size()), levelCartMapp.cartesianSize(level));
+
+        int activeCells = 0;
+        for (int cartesianIdx = 0; cartesianIdx < levelCartMapp.cartesianSize(level); ++cartesianIdx)
+        {
+            const int compressedIdx = cartesianToCompressed[cartesianIdx];
+            if (compressedIdx >= 0) {
+                ++activeCells;
+                BOOST_CHECK_EQUAL( levelCartMapp.cartesianIndex(compressedIdx, level), cartesianIdx);
+            }
+            const auto& it = localCartesianIdxSets_to_leafIdx[level].find(cartesianIdx);
+            if (it != localCartesianIdxSets_to_leafIdx[level].end()) {
+                BOOST_CHECK_EQUAL( cartesianToLeaf[cartesianIdx], static_cast<int>(it->second));
+            }
+            else {
+                BOOST_CHECK_EQUAL( cartesianToLeaf[cartesianIdx], -1);
+            }
+        }
+        BOOST_CHECK_EQUAL( activeCells, levelCartMapp.compressedSize(level));
+    }
 }
 
 BOOST_AUTO_TEST_CASE(globalCellInAllActiveCellsGridWithLgrs)
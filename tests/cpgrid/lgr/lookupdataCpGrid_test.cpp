@@ -201,6 +201,31 @@ BOOST_AUTO_TEST_CASE(grid_with_one_lgr)
     lookup_check(grid);
 }
 
+BOOST_AUTO_TEST_CASE(lookup_throws_after_leaf_view_changed)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {4,3,3}, /* cell_sizes = */ {1.0, 1.0, 1.0});
+    const Dune::CartesianIndexMapper<Dune::CpGrid> cartMapper(grid);
+
+    const auto& leaf_view = grid.leafGridView();
+    const LookUpData lookUpData(leaf_view);
+    const LookUpCartesianData lookUpCartesianData(leaf_view, cartMapper);
+    BOOST_CHECK_EQUAL(lookUpData.getFieldPropIdx(5), 5);
+    BOOST_CHECK_EQUAL(lookUpCartesianData.getFieldPropCartesianIdx(5), 5);
+
+    grid.addLgrsUpdateLeafView( /* cells_per_dim_vec = */ {{2,2,2}},
+                                /* startIJK_vec = */{{1,0,1}},
+                                /* endIJK_vec = */ {{3,2,3}},
+                                /* lgr_name_vec = */ {"LGR1"});
+    BOOST_CHECK_THROW(lookUpData.getFieldPropIdx(5), std::logic_error);
+    BOOST_CHECK_THROW(lookUpCartesianData.getFieldPropCartesianIdx(5), std::logic_error);
+
+    // Constructed again for the new leaf grid view, the lookups work.
+    const auto& refined_leaf_view = grid.leafGridView();
+    const LookUpData refinedLookUpData(refined_leaf_view);
+    BOOST_CHECK_EQUAL(refinedLookUpData.getFieldPropIdx(0), 0);
+}
+
 BOOST_AUTO_TEST_CASE(grid_with_multiple_lgrs)
 {
     Dune::CpGrid grid;
@@ -236,6 +261,21 @@ void fieldProp_check(const Dune::CpGrid& grid, Opm::EclipseGrid eclGrid, const s
 
     const auto& porvOnLeaf = lookUpData.assignFieldPropsDoubleOnLeaf(fpm, "PORV");
 
+    // Batched lookup must give the same values as one property at a time.
+    const auto& poroPorvOnLeaf = lookUpData.assignMultipleFieldPropsDoubleOnLeaf(fpm, {"PORO", "PORV"});
+    const auto& poroOnLeafCartMultiple = lookUpCartesianData.assignMultipleFieldPropsDoubleOnLeaf(fpm, {"PORO"});
+    const auto& eqlnumOnLeafMultiple = lookUpData.assignMultipleFieldPropsIntOnLeaf<int>(fpm, {"EQLNUM", "EQLNUM"}, {true, false});
+    const auto& eqlnumOnLeafCartMultiple = lookUpCartesianData.assignMultipleFieldPropsIntOnLeaf<int>(fpm, {"EQLNUM"}, {true});
+    BOOST_REQUIRE_EQUAL(poroPorvOnLeaf.size(), 2u);
+    BOOST_CHECK(poroPorvOnLeaf[0] == poroOnLeaf);
+    BOOST_CHECK(poroPorvOnLeaf[1] == porvOnLeaf);
+    BOOST_REQUIRE_EQUAL(poroOnLeafCartMultiple.size(), 1u);
+    BOOST_CHECK(poroOnLeafCartMultiple[0] == poroOnLeafCart);
+    BOOST_REQUIRE_EQUAL(eqlnumOnLeafMultiple.size(), 2u);
+    BOOST_CHECK(eqlnumOnLeafMultiple[0] == eqlnumOnLeaf);
+    BOOST_REQUIRE_EQUAL(eqlnumOnLeafCartMultiple.size(), 1u);
+    BOOST_CHECK(eqlnumOnLeafCartMultiple[0] == eqlnumOnLeafCart);
+
     for (const auto& elem : elements(leaf_view))
     {
         const auto elemIdx = mapper.index(elem);
@@ -256,6 +296,7 @@ void fieldProp_check(const Dune::CpGrid& grid, Opm::EclipseGrid eclGrid, const s
         BOOST_CHECK_EQUAL(eqlnum[elemOriginIdx], lookUpCartesianData.fieldPropInt(fpm, "EQLNUM", elemIdx));
         BOOST_CHECK_EQUAL(eqlnum[elemOriginIdx]-true, eqlnumOnLeaf[elemIdx]);
         BOOST_CHECK_EQUAL(eqlnum[elemOriginIdx]-true, eqlnumOnLeafCart[elemIdx]);
+        BOOST_CHECK_EQUAL(eqlnum[elemOriginIdx], eqlnumOnLeafMultiple[1][elemIdx]);
 
         // PORV
         if (elem.hasFather()) {
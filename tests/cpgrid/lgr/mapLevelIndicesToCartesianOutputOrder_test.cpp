@@ -26,6 +26,8 @@
 #include <tests/cpgrid/lgr/LgrChecks.hpp>
 
 #include <algorithm> // for std::minmax_element, std::is_sorted
+#include <numeric>   // for std::iota
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -259,3 +261,32 @@ BOOST_AUTO_TEST_CASE(aFewMoreInactiveParentCellsTestCase)
     const Opm::LevelCartesianIndexMapper<Dune::CpGrid> levelCartMapp(grid);
     checkOutputOrderLevelGrids(grid, levelCartMapp);
 }
+
+BOOST_AUTO_TEST_CASE(levelCreatedByAdaptWithoutStartIJK)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(/* grid_dim = */ {4,3,3}, /* cell_sizes = */ {1.0, 1.0, 1.0});
+
+    if (grid.comm().size() == 1) {
+        // Marked cells do not form a block. The refined cells inherit the level Cartesian index
+        // of their parent cell, hence eight cells of level 1 share each Cartesian index.
+        Opm::adaptGridWithParams(grid, /* cells_per_dim = */ {2,2,2}, /* markedCells = */ {0,4,5,17});
+
+        const Opm::LevelCartesianIndexMapper<Dune::CpGrid> levelCartMapp(grid);
+        BOOST_CHECK(levelCartMapp.uniqueCartesianIndices(0));
+        BOOST_CHECK(!levelCartMapp.uniqueCartesianIndices(1));
+        BOOST_CHECK_THROW(levelCartMapp.cartesianToCompressed(1), std::logic_error);
+        BOOST_CHECK_THROW(levelCartMapp.cartesianToLeaf(1), std::logic_error);
+
+        // Each level cell is output exactly once.
+        const auto toOutput = Opm::Lgr::mapLevelIndicesToCartesianOutputOrder(grid, levelCartMapp, 1);
+        BOOST_REQUIRE_EQUAL(toOutput.size(), 32u);
+        auto sortedToOutput = toOutput;
+        std::ranges::sort(sortedToOutput);
+        std::vector<int> levelIndices(32);
+        std::iota(levelIndices.begin(), levelIndices.end(), 0);
+        BOOST_CHECK(sortedToOutput == levelIndices);
+
+        checkOutputOrderLevelGrids(grid, levelCartMapp);
+    }
+}
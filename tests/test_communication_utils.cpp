@@ -26,6 +26,7 @@
 #include <opm/grid/common/CommunicationUtils.hpp>
 #include <tuple> // Should be included via CommunicationUtils.hpp but you never know.
 #include <numeric> // Should be included via CommunicationUtils.hpp but you never know.
+#include <algorithm>
 #include <vector>
 #include <random>
 #include <iostream>
@@ -196,3 +197,81 @@ BOOST_AUTO_TEST_CASE(Gatherv)
 {
     testGatherv(Dune::MPIHelper::getCommunication());
 }
+
+template<class C>
+void testExclusiveSum(const C& comm)
+{
+    const auto [before, total] = Opm::exclusiveSum(comm.rank() + 1, comm);
+    BOOST_CHECK_EQUAL(before, comm.rank() * (comm.rank() + 1) / 2);
+    BOOST_CHECK_EQUAL(total, comm.size() * (comm.size() + 1) / 2);
+}
+
+template<class C>
+void testNeighborAllToAllv(const C& comm)
+{
+    // Ring of processes, each sending (rank+1) copies of a value to both neighbours.
+    std::vector<int> neighbors = { (comm.rank() + comm.size() - 1) % comm.size(),
+                                   (comm.rank() + 1) % comm.size() };
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+    std::vector<std::vector<double>> input;
+    for (const auto& neighbor : neighbors)
+        input.emplace_back(comm.rank() + 1, 100.0 * comm.rank() + neighbor);
+
+    const auto output = Opm::neighborAllToAllv(input, neighbors, comm);
+    BOOST_REQUIRE_EQUAL(output.size(), neighbors.size());
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        BOOST_CHECK_EQUAL(output[n].size(), static_cast<std::size_t>(neighbors[n] + 1));
+        for (const auto& value : output[n])
+            BOOST_CHECK_EQUAL(value, 100.0 * neighbors[n] + comm.rank());
+    }
+}
+
+template<class C>
+void testSparseAllToAllv(const C& comm)
+{
+    // Each process sends (destination+1) copies of a value to itself and to the
+    // process two ranks further, which does not send anything back in general.
+    std::vector<int> destinations = { (comm.rank() + 2) % comm.size(), comm.rank() };
+    if (destinations[0] == destinations[1])
+        destinations.pop_back();
+
+    std::vector<std::vector<double>> input;
+    for (const auto& destination : destinations)
+        input.emplace_back(destination + 1, 100.0 * comm.rank() + destination);
+
+    const auto [sources, output] = Opm::sparseAllToAllv(input, destinations, comm);
+    BOOST_REQUIRE_EQUAL(sources.size(), destinations.size());
+    BOOST_REQUIRE_EQUAL(output.size(), sources.size());
+    for (std::size_t n = 0; n < sources.size(); ++n) {
+        BOOST_CHECK_EQUAL(output[n].size(), static_cast<std::size_t>(comm.rank() + 1));
+        for (const auto& value : output[n])
+            BOOST_CHECK_EQUAL(value, 100.0 * sources[n] + comm.rank());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FakeExclusiveSum)
+{
+    testExclusiveSum(Dune::FakeMPIHelper::getCommunication());
+}
+BOOST_AUTO_TEST_CASE(ExclusiveSum)
+{
+    testExclusiveSum(Dune::MPIHelper::getCommunication());
+}
+BOOST_AUTO_TEST_CASE(FakeNeighborAllToAllv)
+{
+    testNeighborAllToAllv(Dune::FakeMPIHelper::getCommunication());
+}
+BOOST_AUTO_TEST_CASE(NeighborAllToAllv)
+{
+    testNeighborAllToAllv(Dune::MPIHelper::getCommunication());
+}
+BOOST_AUTO_TEST_CASE(FakeSparseAllToAllv)
+{
+    testSparseAllToAllv(Dune::FakeMPIHelper::getCommunication());
+}
+BOOST_AUTO_TEST_CASE(SparseAllToAllv)
+{
+    testSparseAllToAllv(Dune::MPIHelper::getCommunication());
+}
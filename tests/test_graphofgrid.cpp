@@ -45,6 +45,9 @@
 #endif
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
 
 // basic test to check if the graph was constructed correctly
 BOOST_AUTO_TEST_CASE(SimpleGraph)
@@ -851,6 +854,39 @@ BOOST_AUTO_TEST_CASE(ExtendAndSortImportList)
 }
 #endif // HAVE_MPI
 
+// Keys along space-filling curves are unique and the Hilbert curve
+// visits each lattice point right after one of its face neighbors.
+BOOST_AUTO_TEST_CASE(SpaceFillingCurveKeys)
+{
+    constexpr int n = 8;
+    std::map<std::uint64_t, std::array<int,3>> hilbert, morton;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            for (int k = 0; k < n; ++k) {
+                std::array<std::uint32_t,3> coords{std::uint32_t(i), std::uint32_t(j), std::uint32_t(k)};
+                hilbert[Opm::Impl::hilbertKey(coords)] = {i, j, k};
+                morton[Opm::Impl::mortonKey(coords)] = {i, j, k};
+            }
+        }
+    }
+    BOOST_REQUIRE(hilbert.size() == n*n*n);
+    BOOST_REQUIRE(morton.size() == n*n*n);
+    // the sub-cube at the origin is a contiguous part of both curves
+    BOOST_CHECK(hilbert.rbegin()->first == n*n*n - 1);
+    BOOST_CHECK(morton.rbegin()->first == n*n*n - 1);
+    BOOST_CHECK(Opm::Impl::mortonKey({1, 0, 0}) == 4);
+    BOOST_CHECK(Opm::Impl::mortonKey({0, 1, 0}) == 2);
+    BOOST_CHECK(Opm::Impl::mortonKey({0, 0, 1}) == 1);
+
+    for (auto prev = hilbert.begin(), next = std::next(prev); next != hilbert.end(); ++prev, ++next) {
+        int distance = 0;
+        for (int d = 0; d < 3; ++d) {
+            distance += std::abs(next->second[d] - prev->second[d]);
+        }
+        BOOST_CHECK(distance == 1);
+    }
+}
+
 #if HAVE_OPM_COMMON
 // getWellRanks takes wellConnections and vector gIDtoRank mapping cells to their ranks
 // and returns a vector of well ranks
@@ -40,6 +40,7 @@
 #endif
 
 #include <algorithm>
+#include <numeric>
 
 #if HAVE_MPI
 BOOST_AUTO_TEST_CASE(ExtendRootExportList)
@@ -368,6 +369,155 @@ BOOST_AUTO_TEST_CASE(SequentialZoltanSupport)
     BOOST_REQUIRE(importedCells == importSol);
 }
 #endif // HAVE_OPM_COMMON
+
+// The graph is split into contiguous blocks on all ranks and collected back on root.
+BOOST_AUTO_TEST_CASE(ScatterAndGatherGraphOfGrid)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims { 3, 3, 2 };
+    std::array<double, 3> size { 1., 1., 1. };
+    grid.createCartesian(dims, size);
+    const auto& cc = grid.comm();
+    constexpr int root = 0;
+
+    Opm::GraphOfGrid gog(grid);
+    if (cc.rank() == root) {
+        gog.addWell(std::set<int> { 0, 1, 2 });
+        gog.addWell(std::set<int> { 9, 13, 17 });
+        BOOST_REQUIRE(gog.size() == 14);
+    }
+
+    auto block = Opm::Impl::scatterGraphOfGrid(gog, cc, root);
+    BOOST_REQUIRE(cc.sum(block.size()) == 14);
+    BOOST_REQUIRE((int)block.edgeOffsets.size() == block.size() + 1);
+    BOOST_CHECK(std::ranges::is_sorted(block.gIDs));
+    for (int i = 0; i < block.size(); ++i) {
+        for (int e = block.edgeOffsets[i]; e < block.edgeOffsets[i + 1]; ++e) {
+            BOOST_CHECK(block.nborGIDs[e] != block.gIDs[i]);
+            BOOST_CHECK(block.edgeWeights[e] > 0);
+            // neighbors stored on this rank have to be found here
+            if (block.nborRanks[e] == cc.rank()) {
+                BOOST_CHECK(std::ranges::binary_search(block.gIDs, block.nborGIDs[e]));
+            } else {
+                BOOST_CHECK(!std::ranges::binary_search(block.gIDs, block.nborGIDs[e]));
+            }
+        }
+    }
+    if (cc.rank() == root) {
+        BOOST_CHECK(block.gIDs.front() == 0); // well vertex
+        BOOST_CHECK(block.weights.front() == 3.);
+    }
+
+    // move each vertex to the next rank
+    std::vector<int> parts(block.size(), (cc.rank() + 1) % cc.size());
+    auto gIDtoRank = Opm::Impl::gatherGraphOfGridParts(gog.getWells(), block, parts, grid.numCells(), cc, root);
+    if (cc.rank() == root) {
+        BOOST_REQUIRE(gIDtoRank.size() == 18);
+        BOOST_CHECK(gIDtoRank[1] == gIDtoRank[0]);
+        BOOST_CHECK(gIDtoRank[2] == gIDtoRank[0]);
+        BOOST_CHECK(gIDtoRank[13] == gIDtoRank[9]);
+        BOOST_CHECK(gIDtoRank[17] == gIDtoRank[9]);
+        BOOST_CHECK(gIDtoRank[0] == 1 % cc.size());
+    } else {
+        BOOST_CHECK(gIDtoRank.empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DistributedZoltanGraphOfGrid)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims { 6, 5, 4 };
+    std::array<double, 3> size { 1., 1., 1. };
+    grid.createCartesian(dims, size);
+    const auto& cc = grid.comm();
+    constexpr int root = 0;
+    const int numCells = cc.sum(grid.numCells());
+
+    auto [gIDtoRank, wells, exportList, importList, wellConnections]
+        = Opm::zoltanDistributedPartitioningWithGraphOfGrid(grid, nullptr, {}, nullptr, cc,
+                                                            Dune::EdgeWeightMethod::uniformEdgeWgt,
+                                                            root, 1.1, false, {});
+    // each cell is imported by exactly one rank
+    BOOST_REQUIRE(cc.sum(importList.size()) == (std::size_t)numCells);
+    for (const auto& entry : importList) {
+        BOOST_CHECK(std::get<1>(entry) == root);
+    }
+    if (cc.rank() == root) {
+        BOOST_REQUIRE((int)gIDtoRank.size() == numCells);
+        BOOST_REQUIRE((int)exportList.size() == numCells);
+        for (const auto& entry : exportList) {
+            BOOST_CHECK(gIDtoRank[std::get<0>(entry)] == std::get<1>(entry));
+        }
+    }
+    // every rank gets something
+    BOOST_CHECK(!importList.empty());
+}
+// Pieces of a curve stored in blocks on all ranks have equal weight.
+BOOST_AUTO_TEST_CASE(CutCurve)
+{
+    Dune::CpGrid grid;
+    const auto& cc = grid.comm();
+    // each rank holds rank+1 vertices of weight 1 and one of weight 3
+    std::vector<float> weights(cc.rank() + 1, 1.f);
+    weights.push_back(3.f);
+    const int numParts = 2 * cc.size();
+    auto parts = Opm::Impl::cutCurve(weights, numParts, cc);
+    BOOST_REQUIRE(parts.size() == weights.size());
+    BOOST_CHECK(std::ranges::is_sorted(parts));
+
+    std::vector<double> load(numParts, 0.);
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        BOOST_REQUIRE(parts[i] >= 0 && parts[i] < numParts);
+        load[parts[i]] += weights[i];
+    }
+    cc.sum(load.data(), numParts);
+    const double total = cc.sum(std::accumulate(weights.begin(), weights.end(), 0.));
+    for (const auto& l : load) {
+        // no piece exceeds its share by more than the largest vertex weight
+        BOOST_CHECK(l <= total / numParts + 3.);
+    }
+    // the last vertex of the last rank ends the curve
+    if (cc.rank() == cc.size() - 1) {
+        BOOST_CHECK(parts.back() == numParts - 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SpaceFillingCurveGraphOfGrid)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims { 6, 5, 4 };
+    std::array<double, 3> size { 1., 1., 1. };
+    grid.createCartesian(dims, size);
+    const auto& cc = grid.comm();
+    constexpr int root = 0;
+    const int numCells = cc.sum(grid.numCells());
+
+    for (const auto& params : { std::map<std::string, std::string>{},
+                                std::map<std::string, std::string>{{"SFC_CURVE", "MORTON"},
+                                                                   {"SFC_COORDINATES", "IJK"}} }) {
+        auto [gIDtoRank, wells, exportList, importList, wellConnections]
+            = Opm::spaceFillingCurvePartitioningWithGraphOfGrid(grid, nullptr, {}, cc, root, false, params);
+        // each cell is imported by exactly one rank
+        BOOST_REQUIRE(cc.sum(importList.size()) == (std::size_t)numCells);
+        for (const auto& entry : importList) {
+            BOOST_CHECK(std::get<1>(entry) == root);
+        }
+        if (cc.rank() == root) {
+            BOOST_REQUIRE((int)gIDtoRank.size() == numCells);
+            BOOST_REQUIRE((int)exportList.size() == numCells);
+            for (const auto& entry : exportList) {
+                BOOST_CHECK(gIDtoRank[std::get<0>(entry)] == std::get<1>(entry));
+            }
+        }
+        // all cells have weight 1, hence the pieces differ by at most one cell
+        const std::size_t average = numCells / cc.size();
+        BOOST_CHECK(importList.size() >= average && importList.size() <= average + 1);
+    }
+
+    const std::map<std::string, std::string> unknownCurve{{"SFC_CURVE", "PEANO"}};
+    BOOST_CHECK_THROW(Opm::spaceFillingCurvePartitioningWithGraphOfGrid(grid, nullptr, {}, cc, root, false, unknownCurve),
+                      std::invalid_argument);
+}
 #endif // HAVE_MPI
 
 bool init_unit_test_func()
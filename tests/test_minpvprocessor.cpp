@@ -51,7 +51,8 @@ BOOST_AUTO_TEST_CASE(GAP_MAXGAP)
 
     auto minpv_result = mp1.process(thickness, z_threshold, max_gap, pv, minpvv, actnum, fill_removed_cells, z1.data(), pinch_no_gap);
     BOOST_CHECK_EQUAL(minpv_result.nnc.size(), 1);
-    BOOST_CHECK_EQUAL(minpv_result.nnc[0], 2);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].first, 0);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].second, 2);
 
     max_gap = .29;
     minpv_result = mp1.process(thickness, z_threshold, max_gap, pv, minpvv, actnum, fill_removed_cells, z1.data(), pinch_no_gap);
@@ -82,8 +83,10 @@ BOOST_AUTO_TEST_CASE(GAP_MAXGAP_no_pinched_cells)
     auto minpv_result = mp1.process(thickness, z_threshold, max_gap, pv, minpvv, actnum, fill_removed_cells,
                                     zcorn.data(), pinch_no_gap, false, {}, [](int){ return 1; });
     BOOST_CHECK_EQUAL(minpv_result.nnc.size(), 1);
-    if (minpv_result.nnc.size() )
-      BOOST_CHECK_EQUAL(minpv_result.nnc[1], 2);
+    if (minpv_result.nnc.size() ) {
+      BOOST_CHECK_EQUAL(minpv_result.nnc[0].first, 1);
+      BOOST_CHECK_EQUAL(minpv_result.nnc[0].second, 2);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(Pinch4ALL)
@@ -185,7 +188,8 @@ BOOST_AUTO_TEST_CASE(Pinch)
     minpv_result = mp1.process(thickness, z_threshold, 1e20, pv, minpvv, actnum, fill_removed_cells, z1.data(), pinch_no_gap);
 
     BOOST_CHECK_EQUAL(minpv_result.nnc.size(), 1);
-    BOOST_CHECK_EQUAL(minpv_result.nnc[0], 2);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].first, 0);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].second, 2);
     BOOST_CHECK(minpv_result.removed_cells == std::vector<std::size_t>{1});
     BOOST_CHECK_EQUAL_COLLECTIONS(z1.begin(), z1.end(), zcornAfter.begin(), zcornAfter.end());
 
@@ -256,7 +260,8 @@ BOOST_AUTO_TEST_CASE(Pinch)
     auto exp =  std::vector<std::size_t>{1, 2};
     BOOST_CHECK(minpv_result.removed_cells == exp);
     BOOST_CHECK_EQUAL(minpv_result.nnc.size(), 1u);
-    BOOST_CHECK_EQUAL(minpv_result.nnc[0], 3);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].first, 0);
+    BOOST_CHECK_EQUAL(minpv_result.nnc[0].second, 3);
 }
 
 BOOST_AUTO_TEST_CASE(Processing)
@@ -362,7 +367,8 @@ BOOST_AUTO_TEST_CASE(Processing)
     auto z4 = zcorn;
     auto minpv_result4 = mp4.process(thicknes, z_threshold, 1e20, pv, minpvv2, actnum, !fill_removed_cells, z4.data());
     BOOST_CHECK_EQUAL(minpv_result4.nnc.size(), 1);
-    BOOST_CHECK_EQUAL(minpv_result4.nnc.at(0), 3);
+    BOOST_CHECK_EQUAL(minpv_result4.nnc.at(0).first, 0);
+    BOOST_CHECK_EQUAL(minpv_result4.nnc.at(0).second, 3);
     BOOST_CHECK(minpv_result4.removed_cells == std::vector<std::size_t>{1});
     BOOST_CHECK_EQUAL_COLLECTIONS(z4.begin(), z4.end(), zcorn4after.begin(), zcorn4after.end());
 
@@ -388,3 +394,41 @@ BOOST_AUTO_TEST_CASE(Processing)
     BOOST_CHECK_EQUAL(minpv_result7.nnc.size(), 1);
     BOOST_CHECK_EQUAL_COLLECTIONS(z7.begin(), z7.end(), zcorn7after.begin(), zcorn7after.end());
 }
+
+BOOST_AUTO_TEST_CASE(ManyColumns)
+{
+    // Same column as in GAP_MAXGAP, repeated in a 5x3 grid with varying pore volumes.
+    const int nx = 5, ny = 3, nz = 3;
+    const std::vector<double> column_zcorn = { 0, 2, 2, 2.5, 2.8, 3.5 };
+    std::vector<double> zcorn(8 * nx * ny * nz);
+    for (int k = 0; k < nz; ++k) {
+        for (int kk = 0; kk < 2; ++kk) {
+            const int slice = (2 * k + kk) * 4 * nx * ny;
+            std::fill(zcorn.begin() + slice, zcorn.begin() + slice + 4 * nx * ny, column_zcorn[2 * k + kk]);
+        }
+    }
+    std::vector<double> pv(nx * ny * nz, 2.0);
+    std::vector<double> thickness(nx * ny * nz);
+    for (int c = 0; c < nx * ny; ++c) {
+        pv[c + nx * ny] = (c % 3 == 0) ? 0.5 : 2.0;
+        thickness[c] = 2;
+        thickness[c + nx * ny] = 0.5;
+        thickness[c + 2 * nx * ny] = 0.7;
+    }
+    std::vector<double> minpvv(nx * ny * nz, 0.6);
+    std::vector<int> actnum(nx * ny * nz, 1);
+
+    Opm::MinpvProcessor mp(nx, ny, nz);
+    auto z = zcorn;
+    auto minpv_result = mp.process(thickness, 0.4, 1e20, pv, minpvv, actnum, false, z.data());
+
+    // Every third column has its middle cell removed and an NNC around it.
+    std::vector<std::size_t> expected_removed;
+    std::vector<std::pair<int,int>> expected_nnc;
+    for (int c = 0; c < nx * ny; c += 3) {
+        expected_removed.push_back(c + nx * ny);
+        expected_nnc.emplace_back(c, c + 2 * nx * ny);
+    }
+    BOOST_CHECK(minpv_result.removed_cells == expected_removed);
+    BOOST_CHECK(minpv_result.nnc == expected_nnc);
+}
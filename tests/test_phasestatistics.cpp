@@ -0,0 +1,117 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE PhaseStatisticsTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/PhaseStatistics.hpp>
+#include <opm/grid/CpGrid.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <array>
+#include <sstream>
+#include <string>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_CASE(phases_accumulate)
+{
+    Opm::PhaseStatistics statistics;
+    BOOST_CHECK(statistics.find("first") == nullptr);
+
+    for (int i = 0; i < 3; ++i) {
+        auto timer = statistics.time("first");
+        statistics.addCounter("first", "items", 2);
+    }
+    {
+        auto timer = statistics.time("second");
+        timer.stop();
+        // Stopping twice records the phase once.
+        timer.stop();
+    }
+
+    const auto& phases = statistics.phases();
+    BOOST_REQUIRE_EQUAL(phases.size(), 2u);
+    BOOST_CHECK_EQUAL(phases[0].name, "first");
+    BOOST_CHECK_EQUAL(phases[1].name, "second");
+
+    const auto* first = statistics.find("first");
+    BOOST_REQUIRE(first != nullptr);
+    BOOST_CHECK_EQUAL(first->calls, 3);
+    BOOST_CHECK(first->seconds >= 0.0);
+    BOOST_CHECK(first->peak_rss_increase_kb >= 0);
+    BOOST_CHECK_EQUAL(first->counters.at("items"), 6);
+    BOOST_CHECK_EQUAL(statistics.find("second")->calls, 1);
+
+    statistics.clear();
+    BOOST_CHECK(statistics.phases().empty());
+}
+
+BOOST_AUTO_TEST_CASE(json_output)
+{
+    Opm::PhaseStatistics statistics;
+    statistics.addCounter("say \"hi\"", "cells", 42);
+
+    std::ostringstream os;
+    statistics.writeJson(os);
+    const auto json = os.str();
+    BOOST_CHECK(json.find("\"name\": \"say \\\"hi\\\"\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"calls\": 0") != std::string::npos);
+    BOOST_CHECK(json.find("\"cells\": 42") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(cpgrid_setup_phases)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(std::array<int, 3>{4, 3, 2}, std::array<double, 3>{1.0, 1.0, 1.0});
+
+    const auto& statistics = grid.phaseStatistics();
+    if (grid.comm().rank() == 0) {
+        const auto* process = statistics.find("process_grdecl");
+        BOOST_REQUIRE(process != nullptr);
+        BOOST_CHECK_EQUAL(process->calls, 1);
+        BOOST_CHECK_EQUAL(process->counters.at("cells"), 24);
+        BOOST_CHECK(statistics.find("buildTopo") != nullptr);
+        BOOST_CHECK(statistics.find("buildGeom") != nullptr);
+    }
+
+    grid.loadBalance();
+    if (grid.comm().size() > 1) {
+        BOOST_CHECK(statistics.find("partitioning") != nullptr);
+        BOOST_CHECK(statistics.find("distributeGlobalGrid") != nullptr);
+        BOOST_CHECK(statistics.find("computeCommunicationInterfaces") != nullptr);
+    }
+
+    std::ostringstream os;
+    grid.writePhaseStatistics(os);
+    BOOST_CHECK(os.str().starts_with("{\"phases\": ["));
+}
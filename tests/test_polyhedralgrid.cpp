@@ -22,7 +22,10 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 // two hexahedrons using polygon/polyhedron format
 static const char* hexaPoly = "\
@@ -257,6 +260,32 @@ GRIDPARAMETER\n \
 closure none\n \
 #";
 
+template <class Grid>
+void checkFaceNeighbours(const Grid& grid, int numInteriorFaces)
+{
+    const UnstructuredGrid& ug = grid;
+    const auto neighbours = grid.faceNeighbours();
+    if (neighbours != grid.faceNeighbours())
+        throw std::logic_error("faceNeighbours() is not cached");
+    if (neighbours->numInteriorFaces() != numInteriorFaces || neighbours->numCells() != ug.number_of_cells)
+        throw std::logic_error("faceNeighbours() has wrong size");
+    for (int i = 0; i < neighbours->numInteriorFaces(); ++i) {
+        const int face = neighbours->faces[i];
+        const int c0 = ug.face_cells[2*face];
+        const int c1 = ug.face_cells[2*face + 1];
+        const auto& cells = neighbours->cells[i];
+        if (cells[0] != std::min(c0, c1) || cells[1] != std::max(c0, c1)
+            || (neighbours->orientations[i] != 0) != (c0 < c1))
+            throw std::logic_error("faceNeighbours() has wrong cells of face " + std::to_string(face));
+        if (ug.cell_facetag && (neighbours->tags[i] < 0 || neighbours->tags[i] > 2))
+            throw std::logic_error("faceNeighbours() has wrong tag of face " + std::to_string(face));
+    }
+    for (int hf = 0; hf < ug.cell_facepos[ug.number_of_cells]; ++hf) {
+        if (neighbours->cell_faces[hf] != ug.cell_faces[hf])
+            throw std::logic_error("faceNeighbours() has wrong cell faces");
+    }
+}
+
 int main(int argc, char** argv )
 {
     // initialize MPI
@@ -290,6 +319,7 @@ int main(int argc, char** argv )
         std::cout <<"Check 3d grid created from deck" << std::endl << std::endl;
         Grid grid(eclgrid, porv);
         gridcheck( grid );
+        checkFaceNeighbours( grid, 3*4*4*3 );
         std::cout << std::endl;
 #endif
         // test DGF grid creation capabilities
@@ -10,11 +10,16 @@
 #include <opm/grid/cpgpreprocess/make_edge_conformal.hpp>
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <initializer_list>
 #include <optional>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 namespace {
     class TestGrid
     {
@@ -220,6 +225,155 @@ namespace {
 
             .actnum({ 1, 1, });
     }
+
+    /// Faulted model with a vertical fault in the middle of the I range,
+    /// varying layer thickness, a few pinched layers and inactive cells.
+    TestGrid faultedModel(const std::array<int,3>& dims)
+    {
+        const auto [nx, ny, nz] = dims;
+
+        auto coord = std::vector<double>{};
+        for (int j = 0; j <= ny; ++j) {
+            for (int i = 0; i <= nx; ++i) {
+                coord.insert(coord.end(), {
+                        1.0*i, 1.0*j,   0.0,
+                        1.0*i, 1.0*j, 100.0,
+                    });
+            }
+        }
+
+        auto zcorn = std::vector<double>(8 * nx * ny * nz);
+        for (int j = 0; j < 2*ny; ++j) {
+            for (int i = 0; i < 2*nx; ++i) {
+                const auto throw_ = (i/2 >= nx/2) ? 0.5 + 0.1*(j % 3) : 0.0;
+
+                auto z = 1.0 + throw_ + 0.05*((i + j) % 2);
+                for (int k = 0; k < nz; ++k) {
+                    const auto dz = ((k + i/2 + j/2) % 7 == 3)
+                        ? 0.0 : 1.0 + 0.25*std::sin(1.0*(i + 2*j + 3*k));
+
+                    zcorn[i + 2*nx*(j + 2*ny*(2*k + 0))] = z;  z += dz;
+                    zcorn[i + 2*nx*(j + 2*ny*(2*k + 1))] = z;
+                }
+            }
+        }
+
+        auto actnum = std::vector<int>(nx * ny * nz, 1);
+        for (auto c = 0*actnum.size(); c < actnum.size(); c += 11) {
+            actnum[c] = 0;
+        }
+
+        return TestGrid { dims }.coord(coord).zcorn(zcorn).actnum(actnum);
+    }
+
+    /// Regular Cartesian box of unit cells.  Cells in the upper half of
+    /// the I range are moved down by 'throw_' along a vertical fault.
+    TestGrid cartesianBox(const std::array<int,3>& dims, const double throw_ = 0.0)
+    {
+        const auto [nx, ny, nz] = dims;
+
+        auto coord = std::vector<double>{};
+        for (int j = 0; j <= ny; ++j) {
+            for (int i = 0; i <= nx; ++i) {
+                coord.insert(coord.end(), {
+                        1.0*i, 1.0*j,           0.0,
+                        1.0*i, 1.0*j, nz + throw_ + 1.0,
+                    });
+            }
+        }
+
+        auto zcorn = std::vector<double>(8 * nx * ny * nz);
+        for (int k = 0; k < 2*nz; ++k) {
+            for (int j = 0; j < 2*ny; ++j) {
+                for (int i = 0; i < 2*nx; ++i) {
+                    zcorn[i + 2*nx*(j + 2*ny*k)] =
+                        (k + 1)/2 + ((i/2 >= nx/2) ? throw_ : 0.0);
+                }
+            }
+        }
+
+        return TestGrid { dims }.coord(coord).zcorn(zcorn)
+            .actnum(std::vector<int>(nx * ny * nz, 1));
+    }
+
+    /// Number of faces of each tag, I_FACE, J_FACE and K_FACE.
+    std::array<int,3> faceTagCounts(const processed_grid& g)
+    {
+        auto counts = std::array<int,3>{};
+        for (auto f = 0*g.number_of_faces; f < g.number_of_faces; ++f) {
+            ++counts[g.face_tag[f]];
+        }
+
+        return counts;
+    }
+
+    /// Check the full topology of cartesianBox(dims) without fault.
+    void checkCartesianBox(const processed_grid& g, const std::array<int,3>& dims)
+    {
+        const auto [nx, ny, nz] = dims;
+
+        BOOST_CHECK_EQUAL(g.number_of_cells, nx * ny * nz);
+        BOOST_CHECK_EQUAL(g.number_of_nodes, (nx + 1) * (ny + 1) * (nz + 1));
+
+        const auto expectTags = std::array {
+            (nx + 1) * ny * nz, nx * (ny + 1) * nz, nx * ny * (nz + 1),
+        };
+
+        const auto tags = faceTagCounts(g);
+        BOOST_CHECK_EQUAL_COLLECTIONS(tags.begin(), tags.end(),
+                                      expectTags.begin(), expectTags.end());
+
+        BOOST_REQUIRE_EQUAL(static_cast<int>(g.number_of_faces),
+                            expectTags[0] + expectTags[1] + expectTags[2]);
+
+        // Cartesian cell index stride across each kind of face
+        const auto stride = std::array { 1, nx, nx * ny };
+
+        for (auto f = 0*g.number_of_faces; f < g.number_of_faces; ++f) {
+            BOOST_CHECK_EQUAL(g.face_node_ptr[f + 1] - g.face_node_ptr[f], 4u);
+
+            const auto c1 = g.face_neighbors[2*f + 0];
+            const auto c2 = g.face_neighbors[2*f + 1];
+
+            BOOST_CHECK((c1 >= 0) || (c2 >= 0));
+
+            if ((c1 >= 0) && (c2 >= 0)) {
+                BOOST_CHECK_EQUAL(c2 - c1, stride[g.face_tag[f]]);
+            }
+        }
+
+        for (int c = 0; c < nx * ny * nz; ++c) {
+            BOOST_CHECK_EQUAL(g.local_cell_index[c], c);
+        }
+    }
+
+    void checkSameGrid(const processed_grid& g1, const processed_grid& g2)
+    {
+        BOOST_REQUIRE_EQUAL(g1.number_of_faces, g2.number_of_faces);
+        BOOST_REQUIRE_EQUAL(g1.number_of_nodes, g2.number_of_nodes);
+        BOOST_REQUIRE_EQUAL(g1.number_of_cells, g2.number_of_cells);
+
+        const auto nf = g1.number_of_faces;
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.face_node_ptr, g1.face_node_ptr + nf + 1,
+                                      g2.face_node_ptr, g2.face_node_ptr + nf + 1);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.face_nodes, g1.face_nodes + g1.face_node_ptr[nf],
+                                      g2.face_nodes, g2.face_nodes + g2.face_node_ptr[nf]);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.face_neighbors, g1.face_neighbors + 2*nf,
+                                      g2.face_neighbors, g2.face_neighbors + 2*nf);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.face_tag, g1.face_tag + nf,
+                                      g2.face_tag, g2.face_tag + nf);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.local_cell_index, g1.local_cell_index + g1.number_of_cells,
+                                      g2.local_cell_index, g2.local_cell_index + g2.number_of_cells);
+
+        // Bitwise identical coordinates expected
+        BOOST_CHECK_EQUAL_COLLECTIONS(g1.node_coordinates, g1.node_coordinates + 3*g1.number_of_nodes,
+                                      g2.node_coordinates, g2.node_coordinates + 3*g2.number_of_nodes);
+    }
 } // Anonymous namespace
 
 BOOST_AUTO_TEST_SUITE(Regular_Processing)
@@ -841,3 +995,109 @@ BOOST_AUTO_TEST_CASE(Single_Fault_Connection)
 }
 
 BOOST_AUTO_TEST_SUITE_END()     // Edge_Conformal_Processing
+
+#if defined(_OPENMP)
+
+BOOST_AUTO_TEST_SUITE(Threaded_Processing)
+
+BOOST_AUTO_TEST_CASE(Faulted_Model_Matches_Serial)
+{
+    for (const bool pinch : { false, true }) {
+        const auto numThreads = omp_get_max_threads();
+
+        omp_set_num_threads(1);
+        auto serial = faultedModel({ 13, 7, 9 }).pinchActive(pinch);
+        serial.process();
+
+        for (const int threads : { 2, 3, 8 }) {
+            omp_set_num_threads(threads);
+            auto threaded = faultedModel({ 13, 7, 9 }).pinchActive(pinch);
+            threaded.process();
+
+            BOOST_REQUIRE_EQUAL(serial.status(), 1);
+            BOOST_REQUIRE_EQUAL(threaded.status(), 1);
+
+            checkSameGrid(serial.grid(), threaded.grid());
+        }
+
+        omp_set_num_threads(numThreads);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Cartesian_Box_Topology)
+{
+    const auto numThreads = omp_get_max_threads();
+    const auto dims = std::array { 7, 5, 6 };
+
+    for (const int threads : { 1, 2, 3, 8 }) {
+        omp_set_num_threads(threads);
+
+        auto box = cartesianBox(dims);
+        box.process();
+
+        BOOST_REQUIRE_EQUAL(box.status(), 1);
+        checkCartesianBox(box.grid(), dims);
+    }
+
+    omp_set_num_threads(numThreads);
+}
+
+BOOST_AUTO_TEST_CASE(Faulted_Box_Face_Counts)
+{
+    // A throw of half a cell splits each of the nz faces along the fault
+    // into two connections, except at the top and bottom where part of
+    // the face is on the outer boundary.
+    const auto numThreads = omp_get_max_threads();
+    const auto [nx, ny, nz] = std::array { 6, 4, 5 };
+
+    for (const int threads : { 1, 2, 3, 8 }) {
+        omp_set_num_threads(threads);
+
+        auto box = cartesianBox({ nx, ny, nz }, 0.5);
+        box.process();
+
+        BOOST_REQUIRE_EQUAL(box.status(), 1);
+
+        const auto& g = box.grid();
+        BOOST_CHECK_EQUAL(g.number_of_cells, nx * ny * nz);
+
+        const auto tags = faceTagCounts(g);
+        BOOST_CHECK_EQUAL(tags[0], nx * ny * nz + ny * (2*nz + 1));
+        BOOST_CHECK_EQUAL(tags[1], nx * (ny + 1) * nz);
+        BOOST_CHECK_EQUAL(tags[2], nx * ny * (nz + 1));
+
+        // Fault pillars carry the nodes of both sides of the fault
+        BOOST_CHECK_EQUAL(g.number_of_nodes,
+                          (nx + 1) * (ny + 1) * (nz + 1) + (ny + 1) * (nz + 1));
+    }
+
+    omp_set_num_threads(numThreads);
+}
+
+BOOST_AUTO_TEST_CASE(Layered_Model_With_Tolerance_Matches_Serial)
+{
+    // Many layers and a positive tolerance exercise the merging of
+    // nearby pillar points in finduniquepoints().
+    const auto numThreads = omp_get_max_threads();
+
+    omp_set_num_threads(1);
+    auto serial = faultedModel({ 6, 5, 40 }).ztol(0.06);
+    serial.process();
+
+    for (const int threads : { 2, 3, 8 }) {
+        omp_set_num_threads(threads);
+        auto threaded = faultedModel({ 6, 5, 40 }).ztol(0.06);
+        threaded.process();
+
+        BOOST_REQUIRE_EQUAL(serial.status(), 1);
+        BOOST_REQUIRE_EQUAL(threaded.status(), 1);
+
+        checkSameGrid(serial.grid(), threaded.grid());
+    }
+
+    omp_set_num_threads(numThreads);
+}
+
+BOOST_AUTO_TEST_SUITE_END()     // Threaded_Processing
+
+#endif // _OPENMP
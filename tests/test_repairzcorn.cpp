@@ -37,7 +37,9 @@
 #include <opm/grid/RepairZCORN.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <stdexcept>
 #include <vector>
 
 namespace {
@@ -1502,3 +1504,142 @@ BOOST_AUTO_TEST_CASE (TBB_And_BBLT_And_Elevation)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE (Repair_Slabs)
+
+namespace {
+    struct SlabModel
+    {
+        std::array<std::size_t, 3> dims;
+        std::vector<double> zcorn;
+        std::vector<int> actnum;
+    };
+
+    SlabModel makeElevationModel()
+    {
+        const auto nx = std::size_t{3}, ny = std::size_t{4}, nz = std::size_t{3};
+
+        auto model = SlabModel { { nx, ny, nz }, {}, {} };
+
+        model.zcorn.resize(8 * nx * ny * nz);
+        for (auto ix = 0*model.zcorn.size(); ix < model.zcorn.size(); ++ix) {
+            const auto layer = ix / (4 * nx * ny);   // 0 .. 2*nz - 1
+
+            // Elevation, with perturbations that make some lower tops end
+            // up above their upper neighbours' bottoms.
+            model.zcorn[ix] = - static_cast<double>((layer + 1) / 2)
+                - 0.25 * static_cast<double>((ix + layer) % 3);
+        }
+
+        // Some tops below their own bottoms.
+        model.zcorn[1]                     = -5.0;
+        model.zcorn[4*nx*ny*2 + 2*nx + 3]  = -5.0;
+
+        model.actnum.assign(nx * ny * nz, 1);
+        model.actnum[nx*ny + 4]     = 0;
+        model.actnum[nx*ny + 2*nx]  = 0;
+        model.actnum[2*nx*ny + 11]  = 0;
+
+        return model;
+    }
+
+    SlabModel extractSlab(const SlabModel& model,
+                          const std::size_t j0, const std::size_t j1)
+    {
+        const auto [nx, ny, nz] = model.dims;
+
+        auto slab = SlabModel { { nx, j1 - j0, nz }, {}, {} };
+
+        for (auto layer = 0*nz; layer < 2*nz; ++layer) {
+            const auto begin = model.zcorn.begin() + 2*nx*(2*j0 + 2*ny*layer);
+
+            slab.zcorn.insert(slab.zcorn.end(), begin, begin + 2*nx*2*(j1 - j0));
+        }
+
+        for (auto k = 0*nz; k < nz; ++k) {
+            const auto begin = model.actnum.begin() + nx*(j0 + ny*k);
+
+            slab.actnum.insert(slab.actnum.end(), begin, begin + nx*(j1 - j0));
+        }
+
+        return slab;
+    }
+
+    void insertSlab(const SlabModel& slab, const std::size_t j0,
+                    SlabModel& model)
+    {
+        const auto [nx, ny, nz] = model.dims;
+        const auto nrow = 2*nx*2*slab.dims[1];
+
+        for (auto layer = 0*nz; layer < 2*nz; ++layer) {
+            std::copy_n(slab.zcorn.begin() + nrow*layer, nrow,
+                        model.zcorn.begin() + 2*nx*(2*j0 + 2*ny*layer));
+        }
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE (Slabs_Match_Full_Model)
+{
+    const auto model = makeElevationModel();
+
+    auto full = model.zcorn;
+    auto repair = ::Opm::UgGridHelpers::RepairZCORN {
+        std::move(full), model.actnum, model.dims
+    };
+
+    BOOST_CHECK_EQUAL(repair.switchedToDepth(), true);
+    BOOST_CHECK(repair.statTopBelowBottom().cells > std::size_t{0});
+    BOOST_CHECK(repair.statBottomBelowLowerTop().cells > std::size_t{0});
+
+    using Repair = ::Opm::UgGridHelpers::RepairZCORN;
+
+    const auto rows = std::vector<std::size_t>{ 0, 1, 4 };
+    auto slabs = std::vector<SlabModel>{};
+    auto orientation = Repair::Orientation{};
+    for (auto s = 0*rows.size(); s + 1 < rows.size(); ++s) {
+        slabs.push_back(extractSlab(model, rows[s], rows[s + 1]));
+        orientation += Repair::orientation(slabs.back().zcorn,
+                                           slabs.back().actnum,
+                                           slabs.back().dims);
+    }
+
+    BOOST_CHECK_EQUAL(orientation.isElevation(), true);
+
+    auto stats = Repair::SlabStatistics{};
+    auto stitched = model;
+    for (auto s = 0*slabs.size(); s < slabs.size(); ++s) {
+        stats += Repair::repairSlab(slabs[s].zcorn, slabs[s].actnum,
+                                    slabs[s].dims, orientation.isElevation());
+        insertSlab(slabs[s], rows[s], stitched);
+    }
+
+    BOOST_CHECK_EQUAL(stats.topBelowBottom.cells,
+                      repair.statTopBelowBottom().cells);
+    BOOST_CHECK_EQUAL(stats.topBelowBottom.corners,
+                      repair.statTopBelowBottom().corners);
+    BOOST_CHECK_EQUAL(stats.bottomBelowLowerTop.cells,
+                      repair.statBottomBelowLowerTop().cells);
+    BOOST_CHECK_EQUAL(stats.bottomBelowLowerTop.corners,
+                      repair.statBottomBelowLowerTop().corners);
+
+    check_is_close(stitched.zcorn, repair.destructivelyGrabSanitizedValues());
+}
+
+BOOST_AUTO_TEST_CASE (Size_Mismatch)
+{
+    using Repair = ::Opm::UgGridHelpers::RepairZCORN;
+
+    const auto cartDims = std::vector<int>{ 1, 1, 2 };
+
+    auto zcorn = std::vector<double>(8 * 2, 0.0);
+    BOOST_CHECK_THROW(Repair::orientation(zcorn, std::vector<int>{ 1 }, cartDims),
+                      std::invalid_argument);
+
+    zcorn.pop_back();
+    BOOST_CHECK_THROW(Repair::repairSlab(zcorn, std::vector<int>{}, cartDims, false),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()